@@ -106,6 +106,7 @@ public:
         const Data& chainCode,
         const Data& key) const -> UnallocatedCString;
 
+    OPENTXS_NO_EXPORT auto Internal() const noexcept -> const internal::Bip32&;
     OPENTXS_NO_EXPORT auto Internal() noexcept -> internal::Bip32&;
 
     OPENTXS_NO_EXPORT Bip32(std::unique_ptr<Imp> imp) noexcept;
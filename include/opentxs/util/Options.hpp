@@ -30,6 +30,20 @@ public:
 
     auto BlockchainBindIpv4() const noexcept -> const Set<CString>&;
     auto BlockchainBindIpv6() const noexcept -> const Set<CString>&;
+    /// Size limit in bytes of the per-chain block cache, or zero to use the
+    /// default value
+    auto BlockchainBlockCacheBytes() const noexcept -> std::size_t;
+    /// Header snapshot files to import into chains which have no headers past
+    /// the genesis block. Snapshots for chains which are not running are
+    /// ignored.
+    auto BlockchainHeaderSnapshots() const noexcept -> const Set<CString>&;
+    /// Total size in bytes of the most recent blocks to retain when pruning,
+    /// or zero to disable size based pruning. The most recent 288 blocks are
+    /// always retained.
+    auto BlockchainPruneBytes() const noexcept -> std::size_t;
+    /// Number of blocks below the chain tip to retain when pruning, or zero to
+    /// disable depth based pruning. Values below 288 are treated as 288.
+    auto BlockchainPruneDepth() const noexcept -> std::size_t;
     auto BlockchainStorageLevel() const noexcept -> int;
     auto BlockchainWalletEnabled() const noexcept -> bool;
     auto DefaultMintKeyBytes() const noexcept -> std::size_t;
@@ -60,6 +74,8 @@ public:
 
     auto AddBlockchainIpv4Bind(std::string_view endpoint) noexcept -> Options&;
     auto AddBlockchainIpv6Bind(std::string_view endpoint) noexcept -> Options&;
+    auto AddBlockchainHeaderSnapshot(std::string_view path) noexcept
+        -> Options&;
     auto AddBlockchainSyncServer(std::string_view endpoint) noexcept
         -> Options&;
     auto AddNotaryPublicEEP(std::string_view value) noexcept -> Options&;
@@ -71,6 +87,9 @@ public:
         std::string_view key,
         std::string_view value) noexcept -> Options&;
     auto ParseCommandLine(int argc, char** argv) noexcept -> Options&;
+    auto SetBlockchainBlockCacheBytes(std::size_t bytes) noexcept -> Options&;
+    auto SetBlockchainPruneBytes(std::size_t bytes) noexcept -> Options&;
+    auto SetBlockchainPruneDepth(std::size_t blocks) noexcept -> Options&;
     auto SetBlockchainStorageLevel(int value) noexcept -> Options&;
     auto SetBlockchainSyncEnabled(bool enabled) noexcept -> Options&;
     auto SetBlockchainWalletEnabled(bool enabled) noexcept -> Options&;
@@ -9,7 +9,9 @@
 
 #include <boost/algorithm/hex.hpp>
 #include <boost/multiprecision/cpp_int.hpp>
+#include <cstddef>
 #include <cstring>
+#include <iterator>
 #include <limits>
 #include <memory>
 #include <stdexcept>
@@ -20,6 +22,7 @@
 #include "internal/crypto/library/Pbkdf2.hpp"
 #include "internal/crypto/library/Ripemd160.hpp"
 #include "internal/crypto/library/Scrypt.hpp"
+#include "internal/crypto/library/Sha256.hpp"
 #include "internal/util/LogMacros.hpp"
 #include "internal/util/P0330.hpp"
 #include "opentxs/api/crypto/Encode.hpp"
@@ -301,6 +304,57 @@ auto Hash::Digest(
     }
 }
 
+auto Hash::Digest(
+    const opentxs::crypto::HashType type,
+    const Vector<ReadView>& data,
+    const AllocateOutput destination) const noexcept -> bool
+{
+    try {
+        if (false == destination.operator bool()) {
+            throw std::runtime_error{"invalid output"};
+        }
+
+        if (data.empty()) { return true; }
+
+        const auto size = Provider::HashSize(type);
+        const auto bytes = size * data.size();
+        auto out = destination(bytes);
+
+        if (false == out.valid(bytes)) {
+            throw std::runtime_error{"failed to allocate space for output"};
+        }
+
+        auto* it = static_cast<std::byte*>(out.data());
+
+        const auto sha256 = (opentxs::crypto::HashType::Sha256 == type) ||
+                            (opentxs::crypto::HashType::Sha256D == type);
+
+        if (sha256 && opentxs::crypto::sha256::Accelerated()) {
+            opentxs::crypto::sha256::Digest(
+                data, opentxs::crypto::HashType::Sha256D == type, it);
+
+            return true;
+        }
+
+        // NOTE other hash types, and cpus without an accelerated kernel, are
+        // handled one input at a time by the existing providers
+        for (const auto& item : data) {
+            if (false == Digest(type, item, preallocated(size, it))) {
+
+                throw std::runtime_error{"failed to calculate hash"};
+            }
+
+            std::advance(it, size);
+        }
+
+        return true;
+    } catch (const std::exception& e) {
+        LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+
+        return false;
+    }
+}
+
 auto Hash::HMAC(
     const opentxs::crypto::HashType type,
     const ReadView key,
@@ -71,6 +71,10 @@ public:
         const std::uint32_t type,
         const ReadView data,
         const AllocateOutput destination) const noexcept -> bool final;
+    auto Digest(
+        const opentxs::crypto::HashType hashType,
+        const Vector<ReadView>& data,
+        const AllocateOutput destination) const noexcept -> bool final;
     auto HMAC(
         const opentxs::crypto::HashType type,
         const ReadView key,
@@ -367,6 +367,14 @@ auto BlockchainImp::Init(
 
     base_config_->disable_wallet_ = !options.BlockchainWalletEnabled();
 
+    if (const auto bytes = options.BlockchainBlockCacheBytes(); 0u < bytes) {
+        base_config_->block_cache_bytes_ = bytes;
+    }
+
+    base_config_->block_prune_depth_ = options.BlockchainPruneDepth();
+    base_config_->block_prune_bytes_ = options.BlockchainPruneBytes();
+    base_config_->header_snapshots_ = options.BlockchainHeaderSnapshots();
+
     if (base_config_->use_sync_server_) { sync_client_.emplace(api_); }
 
     init_promise_.set_value();
@@ -10,19 +10,27 @@
 #include <boost/container/flat_map.hpp>
 #include <boost/multiprecision/cpp_int.hpp>
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
 #include <cstddef>
 #include <cstring>
 #include <iterator>
 #include <limits>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string_view>
 #include <thread>
 #include <utility>
 
+#include "internal/api/network/Asio.hpp"
 #include "internal/blockchain/Params.hpp"
 #include "internal/blockchain/node/Types.hpp"
 #include "internal/util/LogMacros.hpp"
 #include "internal/util/P0330.hpp"
+#include "opentxs/api/network/Asio.hpp"
+#include "opentxs/api/network/Network.hpp"
 #include "opentxs/api/session/Factory.hpp"
 #include "opentxs/api/session/Session.hpp"
 #include "opentxs/blockchain/Blockchain.hpp"
@@ -39,6 +47,7 @@
 #include "opentxs/network/blockchain/bitcoin/CompactSize.hpp"
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/Pimpl.hpp"
+#include "util/Thread.hpp"
 
 constexpr auto BITMASK(std::uint64_t n) noexcept -> std::uint64_t
 {
@@ -291,7 +300,8 @@ auto DecodeSerializedCfilter(const ReadView bytes) noexcept(false)
     -> std::pair<std::uint32_t, ReadView>
 {
     auto output = std::pair<std::uint32_t, ReadView>{};
-    const auto* it = reinterpret_cast<const std::byte*>(bytes.data());
+    const auto* const begin = reinterpret_cast<const std::byte*>(bytes.data());
+    const auto* it = begin;
     auto expectedSize = 1_uz;
 
     if (expectedSize > bytes.size()) {
@@ -299,9 +309,8 @@ auto DecodeSerializedCfilter(const ReadView bytes) noexcept(false)
     }
 
     auto elementCount = 0_uz;
-    auto csBytes = 0_uz;
     const auto haveElementCount = network::blockchain::bitcoin::DecodeSize(
-        it, expectedSize, bytes.size(), elementCount, csBytes);
+        it, expectedSize, bytes.size(), elementCount);
 
     if (false == haveElementCount) {
         throw std::runtime_error("Failed to decode CompactSize");
@@ -315,7 +324,13 @@ auto DecodeSerializedCfilter(const ReadView bytes) noexcept(false)
     }
 #pragma GCC diagnostic pop
 
-    const auto dataSize = bytes.size() - (1u + csBytes);
+    // NOTE measure the bytes actually consumed since a peer may have used a
+    // non-canonical encoding for the element count
+    const auto consumed = static_cast<std::size_t>(std::distance(begin, it));
+
+    OT_ASSERT(consumed <= bytes.size());
+
+    const auto dataSize = bytes.size() - consumed;
     output.first = static_cast<std::uint32_t>(elementCount);
     output.second = {reinterpret_cast<const char*>(it), dataSize};
 
@@ -393,6 +408,48 @@ auto FilterHashToHeader(
     return output;
 }
 
+auto FilterHashesToHeaders(
+    const api::Session& api,
+    const Vector<cfilter::Hash>& hashes,
+    const ReadView previous,
+    alloc::Default alloc) noexcept(false) -> Vector<cfilter::Header>
+{
+    static constexpr auto size = cfilter::Header::payload_size_;
+    static_assert(cfilter::Hash::payload_size_ == size);
+    auto output = Vector<cfilter::Header>{alloc};
+    output.reserve(hashes.size());
+    // NOTE every preimage consists of a filter hash followed by the previous
+    // cfheader so a single buffer is reused for the entire chain and each
+    // calculated cfheader is written directly into the next preimage
+    auto preimage = std::array<std::byte, 2_uz * size>{};
+    auto* const hash = preimage.data();
+    auto* const parent = std::next(preimage.data(), size);
+
+    if (0u < previous.size()) {
+        if (size != previous.size()) {
+            throw std::invalid_argument{"invalid previous cfheader"};
+        }
+
+        std::memcpy(parent, previous.data(), size);
+    }
+
+    for (const auto& filterHash : hashes) {
+        std::memcpy(hash, filterHash.data(), size);
+        auto& header = output.emplace_back();
+
+        const auto rc = FilterHash(
+            api, Type::Bitcoin, reader(preimage), header.WriteInto());
+
+        if (false == rc) {
+            throw std::runtime_error{"failed to calculate cfheader"};
+        }
+
+        std::memcpy(parent, header.data(), size);
+    }
+
+    return output;
+}
+
 auto FilterToHash(const api::Session& api, const ReadView filter) noexcept
     -> cfilter::Hash
 {
@@ -402,6 +459,29 @@ auto FilterToHash(const api::Session& api, const ReadView filter) noexcept
     return output;
 }
 
+auto FiltersToHashes(
+    const api::Session& api,
+    const Vector<ReadView>& filters,
+    alloc::Default alloc) noexcept(false) -> Vector<cfilter::Hash>
+{
+    static constexpr auto size = cfilter::Hash::payload_size_;
+    auto output = Vector<cfilter::Hash>{alloc};
+    output.resize(filters.size());
+    auto digests = Vector<std::byte>{alloc};
+    const auto rc = FilterHashes(api, Type::Bitcoin, filters, writer(digests));
+
+    if ((false == rc) || (digests.size() != (size * filters.size()))) {
+        throw std::runtime_error{"failed to calculate filter hashes"};
+    }
+
+    for (auto i = 0_uz; i < output.size(); ++i) {
+        const auto* digest = std::next(digests.data(), size * i);
+        std::memcpy(output[i].data(), digest, size);
+    }
+
+    return output;
+}
+
 auto FilterToHeader(
     const api::Session& api,
     const ReadView filter,
@@ -410,6 +490,101 @@ auto FilterToHeader(
     return FilterHashToHeader(api, FilterToHash(api, filter).Bytes(), previous);
 }
 
+// Work shared between the calling thread and the thread pool. Jobs which start
+// after every index has been claimed return without touching the callback,
+// which may no longer exist.
+struct ParallelJob {
+    const std::function<void(std::size_t, std::size_t)>& job_;
+    const std::size_t count_;
+    const std::size_t chunk_;
+    std::atomic<std::size_t> next_;
+    std::atomic<std::size_t> done_;
+    std::mutex lock_;
+    std::condition_variable cv_;
+
+    auto run() noexcept -> void
+    {
+        while (true) {
+            const auto first = next_.fetch_add(chunk_);
+
+            if (first >= count_) { return; }
+
+            const auto last = std::min(first + chunk_, count_);
+            job_(first, last);
+            const auto finished = last - first;
+
+            if (count_ == (done_.fetch_add(finished) + finished)) {
+                auto lock = std::lock_guard<std::mutex>{lock_};
+                cv_.notify_all();
+            }
+        }
+    }
+    auto wait() noexcept -> void
+    {
+        auto lock = std::unique_lock<std::mutex>{lock_};
+        cv_.wait(lock, [this] { return done_.load() == count_; });
+    }
+
+    ParallelJob(
+        const std::function<void(std::size_t, std::size_t)>& job,
+        const std::size_t count,
+        const std::size_t chunk) noexcept
+        : job_(job)
+        , count_(count)
+        , chunk_(chunk)
+        , next_(0)
+        , done_(0)
+        , lock_()
+        , cv_()
+    {
+    }
+};
+
+auto ForEachParallel(
+    const api::Session& api,
+    const std::size_t count,
+    const std::function<void(std::size_t, std::size_t)>& job,
+    const std::size_t chunk) noexcept -> void
+{
+    ForEachParallel(api, ThreadPool::Blockchain, count, job, chunk);
+}
+
+auto ForEachParallel(
+    const api::Session& api,
+    const ThreadPool pool,
+    const std::size_t count,
+    const std::function<void(std::size_t, std::size_t)>& job,
+    const std::size_t chunk) noexcept -> void
+{
+    OT_ASSERT(0_uz < chunk);
+
+    if (0_uz == count) { return; }
+
+    const auto chunks = (count + chunk - 1_uz) / chunk;
+    const auto helpers = std::min<std::size_t>(
+        chunks, std::max(1u, std::thread::hardware_concurrency())) - 1_uz;
+
+    if (0_uz == helpers) {
+        job(0_uz, count);
+
+        return;
+    }
+
+    auto shared = std::make_shared<ParallelJob>(job, count, chunk);
+
+    for (auto n = 0_uz; n < helpers; ++n) {
+        const auto posted = api.Network().Asio().Internal().Post(
+            pool,
+            [shared] { shared->run(); },
+            blockchainParallelThreadName);
+
+        if (false == posted) { break; }
+    }
+
+    shared->run();
+    shared->wait();
+}
+
 auto GetFilterParams(const cfilter::Type type) noexcept(false) -> FilterParams
 {
     static const auto gcs_bits_ = UnallocatedMap<cfilter::Type, std::uint8_t>{
@@ -12,6 +12,7 @@
 #include <string_view>
 #include <type_traits>
 
+#include "internal/api/crypto/Hash.hpp"
 #include "opentxs/api/crypto/Hash.hpp"
 #include "opentxs/api/session/Crypto.hpp"
 #include "opentxs/api/session/Session.hpp"
@@ -431,6 +432,69 @@ auto BlankHash() noexcept -> pHash
 
 namespace opentxs::blockchain::internal
 {
+auto BlockHashes(
+    const api::Session& api,
+    const Type chain,
+    const Vector<ReadView>& inputs,
+    const AllocateOutput output) noexcept -> bool
+{
+    switch (chain) {
+        case Type::Unknown:
+        case Type::Bitcoin:
+        case Type::Bitcoin_testnet3:
+        case Type::BitcoinCash:
+        case Type::BitcoinCash_testnet3:
+        case Type::Ethereum_frontier:
+        case Type::Ethereum_ropsten:
+        case Type::Litecoin:
+        case Type::Litecoin_testnet4:
+        case Type::PKT:
+        case Type::PKT_testnet:
+        case Type::BitcoinSV:
+        case Type::BitcoinSV_testnet3:
+        case Type::eCash:
+        case Type::eCash_testnet3:
+        case Type::Casper:
+        case Type::Casper_testnet:
+        case Type::UnitTest:
+        default: {
+            return api.Crypto().Hash().InternalHash().Digest(
+                opentxs::crypto::HashType::Sha256D, inputs, output);
+        }
+    }
+}
+
+auto FilterHashes(
+    const api::Session& api,
+    const Type chain,
+    const Vector<ReadView>& inputs,
+    const AllocateOutput output) noexcept -> bool
+{
+    switch (chain) {
+        case Type::Unknown:
+        case Type::Bitcoin:
+        case Type::Bitcoin_testnet3:
+        case Type::BitcoinCash:
+        case Type::BitcoinCash_testnet3:
+        case Type::Ethereum_frontier:
+        case Type::Ethereum_ropsten:
+        case Type::Litecoin:
+        case Type::Litecoin_testnet4:
+        case Type::PKT:
+        case Type::PKT_testnet:
+        case Type::BitcoinSV:
+        case Type::BitcoinSV_testnet3:
+        case Type::eCash:
+        case Type::eCash_testnet3:
+        case Type::Casper:
+        case Type::Casper_testnet:
+        case Type::UnitTest:
+        default: {
+            return BlockHashes(api, chain, inputs, output);
+        }
+    }
+}
+
 auto Format(const Type chain, const opentxs::Amount& amount) noexcept
     -> UnallocatedCString
 {
@@ -444,6 +508,68 @@ auto Format(const Type chain, const opentxs::Amount& amount) noexcept
         return {};
     }
 }
+
+auto MerkleHashes(
+    const api::Session& api,
+    const Type chain,
+    const Vector<ReadView>& inputs,
+    const AllocateOutput output) noexcept -> bool
+{
+    switch (chain) {
+        case Type::Unknown:
+        case Type::Bitcoin:
+        case Type::Bitcoin_testnet3:
+        case Type::BitcoinCash:
+        case Type::BitcoinCash_testnet3:
+        case Type::Ethereum_frontier:
+        case Type::Ethereum_ropsten:
+        case Type::Litecoin:
+        case Type::Litecoin_testnet4:
+        case Type::PKT:
+        case Type::PKT_testnet:
+        case Type::BitcoinSV:
+        case Type::BitcoinSV_testnet3:
+        case Type::eCash:
+        case Type::eCash_testnet3:
+        case Type::Casper:
+        case Type::Casper_testnet:
+        case Type::UnitTest:
+        default: {
+            return BlockHashes(api, chain, inputs, output);
+        }
+    }
+}
+
+auto TransactionHashes(
+    const api::Session& api,
+    const Type chain,
+    const Vector<ReadView>& inputs,
+    const AllocateOutput output) noexcept -> bool
+{
+    switch (chain) {
+        case Type::Unknown:
+        case Type::Bitcoin:
+        case Type::Bitcoin_testnet3:
+        case Type::BitcoinCash:
+        case Type::BitcoinCash_testnet3:
+        case Type::Ethereum_frontier:
+        case Type::Ethereum_ropsten:
+        case Type::Litecoin:
+        case Type::Litecoin_testnet4:
+        case Type::PKT:
+        case Type::PKT_testnet:
+        case Type::BitcoinSV:
+        case Type::BitcoinSV_testnet3:
+        case Type::eCash:
+        case Type::eCash_testnet3:
+        case Type::Casper:
+        case Type::Casper_testnet:
+        case Type::UnitTest:
+        default: {
+            return BlockHashes(api, chain, inputs, output);
+        }
+    }
+}
 }  // namespace opentxs::blockchain::internal
 
 namespace opentxs::blockchain::params
@@ -10,8 +10,8 @@
 #include <boost/endian/buffers.hpp>
 #include <cstddef>
 #include <cstdint>
-#include <iterator>
 #include <memory>
+#include <optional>
 
 #include "internal/blockchain/Blockchain.hpp"
 #include "internal/blockchain/Params.hpp"
@@ -37,20 +37,10 @@ auto NumericHashNBits(const std::uint32_t input) noexcept
     -> std::unique_ptr<blockchain::NumericHash>
 {
     using ReturnType = blockchain::implementation::NumericHash;
-    using ArgumentType = ReturnType::Type;
-    using MantissaType = bmp::checked_cpp_int;
 
-    const auto mantissa = std::uint32_t{input & 0x007fffff};
-    const auto exponent = static_cast<std::uint8_t>((input & 0xff000000) >> 24);
-    auto target = ArgumentType{};
+    const auto target = ReturnType::Type::FromCompact(input);
 
-    try {
-        if (exponent > 3) {
-            target = MantissaType{mantissa} << (8 * (exponent - 3));
-        } else {
-            target = MantissaType{mantissa} << (8 * (3 - exponent));
-        }
-    } catch (...) {
+    if (false == target.has_value()) {
         LogError()("opentxs::factory::")(__func__)(
             ": Failed to calculate target")
             .Flush();
@@ -58,28 +48,27 @@ auto NumericHashNBits(const std::uint32_t input) noexcept
         return std::make_unique<ReturnType>();
     }
 
-    return std::make_unique<ReturnType>(target);
+    return std::make_unique<ReturnType>(target.value());
 }
 
 auto NumericHash(const Data& hash) noexcept
     -> std::unique_ptr<blockchain::NumericHash>
 {
     using ReturnType = blockchain::implementation::NumericHash;
-    ReturnType::Type value{};
 
     if (hash.IsNull()) { return std::make_unique<ReturnType>(); }
 
-    try {
-        // Interpret hash as little endian
-        bmp::import_bits(value, hash.begin(), hash.end(), 8, false);
-    } catch (...) {
+    // Interpret hash as little endian
+    const auto value = ReturnType::Type::FromLittleEndian(hash.Bytes());
+
+    if (false == value.has_value()) {
         LogError()("opentxs::factory::")(__func__)(": Failed to decode hash")
             .Flush();
 
         return std::make_unique<ReturnType>();
     }
 
-    return std::make_unique<ReturnType>(value);
+    return std::make_unique<ReturnType>(value.value());
 }
 }  // namespace opentxs::factory
 
@@ -207,20 +196,7 @@ auto NumericHash::operator<=(const blockchain::NumericHash& rhs) const noexcept
 auto NumericHash::asHex(const std::size_t minimumBytes) const noexcept
     -> UnallocatedCString
 {
-    UnallocatedVector<unsigned char> bytes;
-
-    try {
-        // Export as big endian
-        bmp::export_bits(data_, std::back_inserter(bytes), 8, true);
-    } catch (...) {
-        LogError()(OT_PRETTY_CLASS())("Failed to encode number").Flush();
-
-        return {};
-    }
-
-    while (minimumBytes > bytes.size()) { bytes.insert(bytes.begin(), 0x0); }
-
-    return opentxs::Data::Factory(bytes.data(), bytes.size())->asHex();
+    return data_.asHex(minimumBytes);
 }
 }  // namespace opentxs::blockchain::implementation
 // NOLINTEND(clang-analyzer-cplusplus.NewDeleteLeaks)
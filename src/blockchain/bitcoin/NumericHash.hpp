@@ -5,21 +5,19 @@
 
 #pragma once
 
-#include <boost/multiprecision/cpp_int.hpp>
 #include <cstddef>
 #include <iosfwd>
 
+#include "internal/blockchain/bitcoin/UInt256.hpp"
 #include "opentxs/blockchain/bitcoin/NumericHash.hpp"
 #include "opentxs/util/Container.hpp"
 
-namespace bmp = boost::multiprecision;
-
 namespace opentxs::blockchain::implementation
 {
 class NumericHash final : public blockchain::NumericHash
 {
 public:
-    using Type = bmp::checked_cpp_int;
+    using Type = bitcoin::UInt256;
 
     auto operator==(const blockchain::NumericHash& rhs) const noexcept
         -> bool final;
@@ -34,8 +32,9 @@ public:
         -> UnallocatedCString final;
     auto Decimal() const noexcept -> UnallocatedCString final
     {
-        return data_.str();
+        return data_.Decimal();
     }
+    auto Value() const noexcept -> const Type& { return data_; }
 
     NumericHash(const Type& data) noexcept;
     NumericHash() noexcept;
@@ -7,13 +7,12 @@
 #include "1_Internal.hpp"               // IWYU pragma: associated
 #include "blockchain/bitcoin/Work.hpp"  // IWYU pragma: associated
 
-#include <boost/exception/exception.hpp>
-#include <iterator>
+#include <cstdint>
 #include <memory>
-#include <utility>
+#include <optional>
 
+#include "blockchain/bitcoin/NumericHash.hpp"
 #include "internal/blockchain/Blockchain.hpp"
-#include "internal/util/LogMacros.hpp"
 #include "opentxs/blockchain/BlockchainType.hpp"
 #include "opentxs/blockchain/bitcoin/NumericHash.hpp"
 #include "opentxs/blockchain/bitcoin/Work.hpp"
@@ -27,53 +26,44 @@ namespace opentxs::factory
 auto Work(const UnallocatedCString& hex) -> blockchain::Work*
 {
     using ReturnType = blockchain::implementation::Work;
-    using ValueType = ReturnType::Type;
     auto bytes = Data::Factory();
     bytes->DecodeHex(hex);
 
     if (bytes->empty()) { return new ReturnType(); }
 
-    ValueType value{};
-    bmp::cpp_int i;
+    // Interpret bytes as big endian
+    const auto value = ReturnType::Type::FromBigEndian(bytes->Bytes());
 
-    try {
-        // Interpret bytes as big endian
-        bmp::import_bits(i, bytes->begin(), bytes->end(), 8, true);
-        value = ValueType{i};
-    } catch (...) {
+    if (false == value.has_value()) {
         LogError()("opentxs::factory::")(__func__)(": Failed to decode work")
             .Flush();
 
         return new ReturnType();
     }
 
-    return new ReturnType(std::move(value));
+    return new ReturnType(value.value());
+}
+
+auto Work(const blockchain::bitcoin::UInt256& value) -> blockchain::Work*
+{
+    using ReturnType = blockchain::implementation::Work;
+
+    return new ReturnType(value);
 }
 
 auto Work(const blockchain::Type chain, const blockchain::NumericHash& input)
     -> blockchain::Work*
 {
     using ReturnType = blockchain::implementation::Work;
-    using TargetType = bmp::checked_cpp_int;
     using ValueType = ReturnType::Type;
+    using TargetType = blockchain::implementation::NumericHash;
 
-    auto value = ValueType{};
-
-    try {
-        const auto maxTarget = factory::NumericHashNBits(
-            blockchain::NumericHash::MaxTarget(chain));
-
-        OT_ASSERT(maxTarget);
-
-        const auto max = TargetType{maxTarget->Decimal()};
-        const auto incoming = TargetType{input.Decimal()};
+    const auto max = ValueType::FromCompact(static_cast<std::uint32_t>(
+        blockchain::NumericHash::MaxTarget(chain)));
+    const auto* incoming = dynamic_cast<const TargetType*>(&input);
 
-        if (incoming > max) {
-            value = ValueType{1};
-        } else {
-            value = ValueType{max} / ValueType{incoming};
-        }
-    } catch (...) {
+    if ((false == max.has_value()) || (nullptr == incoming) ||
+        incoming->Value().IsZero()) {
         LogError()("opentxs::factory::")(__func__)(
             ": Failed to calculate difficulty")
             .Flush();
@@ -81,7 +71,15 @@ auto Work(const blockchain::Type chain, const blockchain::NumericHash& input)
         return new ReturnType();
     }
 
-    return new ReturnType(std::move(value));
+    const auto& target = incoming->Value();
+
+    if (target > max.value()) {
+
+        return new ReturnType(ValueType{1});
+    } else {
+
+        return new ReturnType(max.value() / target);
+    }
 }
 }  // namespace opentxs::factory
 
@@ -126,9 +124,9 @@ auto operator+(const OTWork& lhs, const blockchain::Work& rhs) noexcept
 
 namespace opentxs::blockchain::implementation
 {
-Work::Work(Type&& data) noexcept
+Work::Work(const Type& data) noexcept
     : blockchain::Work()
-    , data_(std::move(data))
+    , data_(data)
 {
 }
 
@@ -138,7 +136,7 @@ Work::Work() noexcept
 }
 
 Work::Work(const Work& rhs) noexcept
-    : Work(Type{rhs.data_})
+    : Work(rhs.data_)
 {
 }
 
@@ -193,18 +191,6 @@ auto Work::operator+(const blockchain::Work& rhs) const noexcept -> OTWork
 
 auto Work::asHex() const noexcept -> UnallocatedCString
 {
-    UnallocatedVector<unsigned char> bytes;
-
-    try {
-        // Export as big endian
-        bmp::export_bits(
-            bmp::cpp_int(data_), std::back_inserter(bytes), 8, true);
-    } catch (...) {
-        LogError()(OT_PRETTY_CLASS())("Failed to encode number").Flush();
-
-        return {};
-    }
-
-    return opentxs::Data::Factory(bytes.data(), bytes.size())->asHex();
+    return data_.asHex();
 }
 }  // namespace opentxs::blockchain::implementation
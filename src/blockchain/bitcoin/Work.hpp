@@ -5,9 +5,7 @@
 
 #pragma once
 
-#include <boost/multiprecision/cpp_bin_float.hpp>
-#include <boost/multiprecision/cpp_int.hpp>
-
+#include "internal/blockchain/bitcoin/UInt256.hpp"
 #include "opentxs/blockchain/bitcoin/Work.hpp"
 #include "opentxs/util/Container.hpp"
 
@@ -21,14 +19,12 @@ class Factory;
 }  // namespace opentxs
 // NOLINTEND(modernize-concat-nested-namespaces)
 
-namespace bmp = boost::multiprecision;
-
 namespace opentxs::blockchain::implementation
 {
 class Work final : public blockchain::Work
 {
 public:
-    using Type = bmp::cpp_bin_float_double;
+    using Type = bitcoin::UInt256;
 
     auto operator==(const blockchain::Work& rhs) const noexcept -> bool final;
     auto operator!=(const blockchain::Work& rhs) const noexcept -> bool final;
@@ -41,10 +37,11 @@ public:
     auto asHex() const noexcept -> UnallocatedCString final;
     auto Decimal() const noexcept -> UnallocatedCString final
     {
-        return data_.str();
+        return data_.Decimal();
     }
+    auto Value() const noexcept -> const Type& { return data_; }
 
-    Work(Type&& data) noexcept;
+    Work(const Type& data) noexcept;
     Work() noexcept;
     Work(const Work& rhs) noexcept;
     Work(Work&& rhs) = delete;
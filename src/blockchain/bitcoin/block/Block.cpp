@@ -10,6 +10,7 @@
 #include <boost/endian/buffers.hpp>
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
@@ -24,6 +25,7 @@
 
 #include "blockchain/bitcoin/block/BlockParser.hpp"
 #include "blockchain/block/Block.hpp"
+#include "internal/blockchain/Blockchain.hpp"
 #include "internal/blockchain/bitcoin/block/Factory.hpp"
 #include "internal/blockchain/bitcoin/block/Transaction.hpp"
 #include "internal/util/LogMacros.hpp"
@@ -81,8 +83,8 @@ auto BitcoinBlock(
 
         {
             const auto& id = gen.ID();
-            index.emplace_back(id.begin(), id.end());
-            const auto& item = index.back();
+            auto& item = index.emplace_back();
+            std::memcpy(item.data(), id.data(), item.size());
             map.emplace(reader(item), pGen);
         }
 
@@ -97,8 +99,8 @@ auto BitcoinBlock(
             }
 
             const auto& id = tx->ID();
-            index.emplace_back(id.begin(), id.end());
-            const auto& item = index.back();
+            auto& item = index.emplace_back();
+            std::memcpy(item.data(), id.data(), item.size());
             map.emplace(reader(item), tx);
         }
 
@@ -224,7 +226,7 @@ auto parse_normal_block(
     const auto& header = *pHeader;
     auto sizeData = BlockReturnType::CalculatedSize{
         in.size(), network::blockchain::bitcoin::CompactSize{}};
-    auto [index, transactions] =
+    auto [index, ranges] =
         parse_transactions(api, chain, in, header, sizeData, it, expectedSize);
 
     return std::make_shared<BlockReturnType>(
@@ -232,7 +234,8 @@ auto parse_normal_block(
         chain,
         std::move(pHeader),
         std::move(index),
-        std::move(transactions),
+        std::move(ranges),
+        space(in.substr(0, sizeData.first)),
         std::move(sizeData));
 }
 }  // namespace opentxs::factory
@@ -252,21 +255,61 @@ Block::Block(
     : blockchain::block::implementation::Block(api, *header)
     , header_p_(std::move(header))
     , header_(*header_p_)
+    , chain_(chain)
     , index_(std::move(index))
+    , ranges_()
+    , serialized_()
     , transactions_(std::move(transactions))
     , size_(std::move(size))
 {
-    if (index_.size() != transactions_.size()) {
+    if (false == bool(header_p_)) {
+        throw std::runtime_error("Invalid header");
+    }
+
+    const auto handle = transactions_.lock();
+    const auto& map = *handle;
+
+    if (index_.size() != map.size()) {
         throw std::runtime_error("Invalid transaction index");
     }
 
+    for (const auto& [txid, tx] : map) {
+        if (false == bool(tx)) {
+            throw std::runtime_error("Invalid transaction");
+        }
+    }
+}
+
+Block::Block(
+    const api::Session& api,
+    const blockchain::Type chain,
+    std::unique_ptr<const blockchain::bitcoin::block::Header> header,
+    TxidIndex&& index,
+    TransactionRanges&& ranges,
+    Space&& serialized,
+    CalculatedSize&& size) noexcept(false)
+    : blockchain::block::implementation::Block(api, *header)
+    , header_p_(std::move(header))
+    , header_(*header_p_)
+    , chain_(chain)
+    , index_(std::move(index))
+    , ranges_(std::move(ranges))
+    , serialized_(std::move(serialized))
+    , transactions_()
+    , size_(std::move(size))
+{
     if (false == bool(header_p_)) {
         throw std::runtime_error("Invalid header");
     }
 
-    for (const auto& [txid, tx] : transactions_) {
-        if (false == bool(tx)) {
-            throw std::runtime_error("Invalid transaction");
+    if (index_.size() != ranges_.size()) {
+        throw std::runtime_error("Invalid transaction index");
+    }
+
+    for (const auto& [offset, bytes] : ranges_) {
+        if ((offset > serialized_.size()) ||
+            (bytes > (serialized_.size() - offset))) {
+            throw std::runtime_error("Invalid transaction range");
         }
     }
 }
@@ -278,7 +321,7 @@ auto Block::at(const std::size_t index) const noexcept -> const value_type&
             throw std::out_of_range("invalid index " + std::to_string(index));
         }
 
-        return at(reader(index_.at(index)));
+        return get_transaction(index);
     } catch (const std::exception& e) {
         LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
 
@@ -288,47 +331,36 @@ auto Block::at(const std::size_t index) const noexcept -> const value_type&
 
 auto Block::at(const ReadView txid) const noexcept -> const value_type&
 {
-    try {
+    {
+        const auto handle = transactions_.lock();
+        const auto& map = *handle;
 
-        return transactions_.at(txid);
-    } catch (...) {
-        LogError()(OT_PRETTY_CLASS())("transaction ")(
-            api_.Factory().DataFromBytes(txid)->asHex())(
-            " not found in block ")(header_.Hash().asHex())
-            .Flush();
-
-        return null_tx_;
+        if (auto i = map.find(txid); map.end() != i) { return i->second; }
     }
-}
 
-template <typename HashType>
-auto Block::calculate_merkle_hash(
-    const api::Session& api,
-    const Type chain,
-    const HashType& lhs,
-    const HashType& rhs,
-    AllocateOutput out) -> bool
-{
-    auto preimage = std::array<std::byte, 64>{};
-    constexpr auto chunk = preimage.size() / 2u;
+    const auto match = std::find_if(
+        index_.begin(), index_.end(), [&](const auto& item) {
+            return reader(item) == txid;
+        });
 
-    if (chunk != lhs.size()) {
-        throw std::runtime_error("Invalid lhs hash size");
-    }
-    if (chunk != rhs.size()) {
-        throw std::runtime_error("Invalid rhs hash size");
+    if (index_.end() != match) {
+        try {
+
+            return get_transaction(static_cast<std::size_t>(
+                std::distance(index_.begin(), match)));
+        } catch (const std::exception& e) {
+            LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+
+            return null_tx_;
+        }
     }
 
-    auto* it = preimage.data();
-    std::memcpy(it, lhs.data(), chunk);
-    std::advance(it, chunk);
-    std::memcpy(it, rhs.data(), chunk);
+    LogError()(OT_PRETTY_CLASS())("transaction ")(
+        api_.Factory().DataFromBytes(txid)->asHex())(" not found in block ")(
+        header_.Hash().asHex())
+        .Flush();
 
-    return MerkleHash(
-        api,
-        chain,
-        {reinterpret_cast<const char*>(preimage.data()), preimage.size()},
-        out);
+    return null_tx_;
 }
 
 template <typename InputContainer, typename OutputContainer>
@@ -338,23 +370,52 @@ auto Block::calculate_merkle_row(
     const InputContainer& in,
     OutputContainer& out) -> bool
 {
-    out.clear();
     const auto count{in.size()};
+    out.clear();
+    out.resize((count + 1_uz) / 2_uz);
+    auto failed = std::atomic<bool>{false};
+    // NOTE every pair in a row is independent of the others
+    blockchain::internal::ForEachParallel(
+        api,
+        out.size(),
+        [&](const std::size_t first, const std::size_t last) {
+            static constexpr auto chunk = 32_uz;
+            auto preimages = UnallocatedVector<std::array<std::byte, 64>>{};
+            auto views = Vector<ReadView>{};
+            preimages.resize(last - first);
+            views.reserve(preimages.size());
+
+            for (auto n = first; n < last; ++n) {
+                const auto i = 2_uz * n;
+                const auto offset = (1_uz == (count - i)) ? 0_uz : 1_uz;
+                const auto& lhs = in[i];
+                const auto& rhs = in[i + offset];
+
+                if ((chunk != lhs.size()) || (chunk != rhs.size())) {
+                    failed.store(true);
+
+                    return;
+                }
+
+                auto& preimage = preimages[n - first];
+                auto* it = std::next(preimage.data(), chunk);
+                std::memcpy(preimage.data(), lhs.data(), chunk);
+                std::memcpy(it, rhs.data(), chunk);
+                views.emplace_back(
+                    reinterpret_cast<const char*>(preimage.data()),
+                    preimage.size());
+            }
 
-    for (auto i = 0_uz; i < count; i += 2_uz) {
-        const auto offset = (1_uz == (count - i)) ? 0_uz : 1_uz;
-        auto& next = out.emplace_back();
-        const auto hashed = calculate_merkle_hash(
-            api,
-            chain,
-            in.at(i),
-            in.at(i + offset),
-            preallocated(next.size(), next.data()));
+            const auto hashed = blockchain::internal::MerkleHashes(
+                api,
+                chain,
+                views,
+                preallocated(chunk * views.size(), out[first].data()));
 
-        if (false == hashed) { return false; }
-    }
+            if (false == hashed) { failed.store(true); }
+        });
 
-    return true;
+    return false == failed.load();
 }
 
 auto Block::calculate_merkle_value(
@@ -373,14 +434,16 @@ auto Block::calculate_merkle_value(
     a.reserve(txids.size());
     b.reserve(txids.size());
     auto counter{0};
-    calculate_merkle_row(api, chain, txids, a);
+
+    if (false == calculate_merkle_row(api, chain, txids, a)) { return {}; }
 
     if (1u == a.size()) { return reader(a.at(0)); }
 
     while (true) {
         const auto& src = (1 == (++counter % 2)) ? a : b;
         auto& dst = (0 == (counter % 2)) ? a : b;
-        calculate_merkle_row(api, chain, src, dst);
+
+        if (false == calculate_merkle_row(api, chain, src, dst)) { return {}; }
 
         if (1u == dst.size()) { return reader(dst.at(0)); }
     }
@@ -389,14 +452,23 @@ auto Block::calculate_merkle_value(
 auto Block::calculate_size() const noexcept -> CalculatedSize
 {
     auto output = CalculatedSize{
-        0, network::blockchain::bitcoin::CompactSize(transactions_.size())};
+        0, network::blockchain::bitcoin::CompactSize(index_.size())};
     auto& [bytes, cs] = output;
+
+    if (false == serialized_.empty()) {
+        bytes = serialized_.size();
+
+        return output;
+    }
+
     auto cb = [](const auto& previous, const auto& in) -> std::size_t {
         return previous + in.second->Internal().CalculateSize();
     };
+    const auto handle = transactions_.lock();
+    const auto& map = *handle;
     bytes = std::accumulate(
-        std::begin(transactions_),
-        std::end(transactions_),
+        std::begin(map),
+        std::end(map),
         header_bytes_ + cs.Size() + extra_bytes(),
         cb);
 
@@ -404,14 +476,22 @@ auto Block::calculate_size() const noexcept -> CalculatedSize
 }
 
 auto Block::ExtractElements(const cfilter::Type style) const noexcept
-    -> Vector<Vector<std::byte>>
+    -> std::optional<Vector<Vector<std::byte>>>
 {
     auto output = Vector<Vector<std::byte>>{};
-    LogTrace()(OT_PRETTY_CLASS())("processing ")(transactions_.size())(
-        " transactions")
+    LogTrace()(OT_PRETTY_CLASS())("processing ")(size())(" transactions")
         .Flush();
 
-    for (const auto& [txid, tx] : transactions_) {
+    for (const auto& tx : *this) {
+        if (false == bool(tx)) {
+            LogError()(OT_PRETTY_CLASS())("failed to deserialize transaction "
+                                          "in block ")
+                .asHex(ID())
+                .Flush();
+
+            return std::nullopt;
+        }
+
         auto temp = tx->Internal().ExtractElements(style);
         output.insert(
             output.end(),
@@ -430,20 +510,31 @@ auto Block::FindMatches(
     const cfilter::Type style,
     const blockchain::block::Patterns& outpoints,
     const blockchain::block::Patterns& patterns,
-    const Log& log) const noexcept -> blockchain::block::Matches
+    const Log& log) const noexcept -> std::optional<blockchain::block::Matches>
 {
-    if (0 == (outpoints.size() + patterns.size())) { return {}; }
+    if (0 == (outpoints.size() + patterns.size())) {
+
+        return blockchain::block::Matches{};
+    }
 
     log(OT_PRETTY_CLASS())("Verifying ")(patterns.size() + outpoints.size())(
-        " potential matches in ")(transactions_.size())(
-        " transactions of block ")
+        " potential matches in ")(size())(" transactions of block ")
         .asHex(ID())
         .Flush();
     auto output = blockchain::block::Matches{};
     auto& [inputs, outputs] = output;
     const auto parsed = blockchain::block::ParsedPatterns{patterns};
 
-    for (const auto& [txid, tx] : transactions_) {
+    for (const auto& tx : *this) {
+        if (false == bool(tx)) {
+            LogError()(OT_PRETTY_CLASS())("failed to deserialize transaction "
+                                          "in block ")
+                .asHex(ID())
+                .Flush();
+
+            return std::nullopt;
+        }
+
         auto temp = tx->Internal().FindMatches(style, outpoints, parsed, log);
         inputs.insert(
             inputs.end(),
@@ -470,6 +561,38 @@ auto Block::get_or_calculate_size() const noexcept -> CalculatedSize
     return size_.value();
 }
 
+auto Block::get_transaction(const std::size_t index) const noexcept(false)
+    -> const value_type&
+{
+    const auto& txid = index_.at(index);
+    auto handle = transactions_.lock();
+    auto& map = *handle;
+
+    if (auto i = map.find(reader(txid)); map.end() != i) { return i->second; }
+
+    if (ranges_.empty()) {
+        throw std::out_of_range("transaction " + std::to_string(index) +
+                                " not found in block");
+    }
+
+    const auto& [offset, bytes] = ranges_.at(index);
+    const auto view = ReadView{
+        reinterpret_cast<const char*>(serialized_.data()) + offset, bytes};
+    auto tx = factory::BitcoinTransaction(
+        api_,
+        chain_,
+        index,
+        header_.Timestamp(),
+        EncodedTransaction::Deserialize(api_, chain_, view));
+
+    if (false == bool(tx)) {
+        throw std::runtime_error(
+            "failed to instantiate transaction " + std::to_string(index));
+    }
+
+    return map.emplace(reader(txid), std::move(tx)).first->second;
+}
+
 auto Block::Print() const noexcept -> UnallocatedCString
 {
     auto out = std::stringstream{};
@@ -503,6 +626,14 @@ auto Block::Serialize(AllocateOutput bytes) const noexcept -> bool
         return false;
     }
 
+    if (false == serialized_.empty()) {
+        OT_ASSERT(serialized_.size() == size);
+
+        std::memcpy(out.data(), serialized_.data(), size);
+
+        return true;
+    }
+
     LogInsane()(OT_PRETTY_CLASS())("Serializing ")(txCount.Value())(
         " transactions into ")(size)(" bytes.")
         .Flush();
@@ -535,9 +666,9 @@ auto Block::Serialize(AllocateOutput bytes) const noexcept -> bool
     remaining -= txCount.Size();
     std::advance(it, txCount.Size());
 
-    for (const auto& txid : index_) {
+    for (auto i = 0_uz; i < index_.size(); ++i) {
         try {
-            const auto& pTX = transactions_.at(reader(txid));
+            const auto& pTX = get_transaction(i);
 
             OT_ASSERT(pTX);
 
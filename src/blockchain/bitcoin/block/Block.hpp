@@ -5,6 +5,8 @@
 
 #pragma once
 
+#include <cs_plain_guarded.h>
+#include <array>
 #include <cstddef>
 #include <iosfwd>
 #include <memory>
@@ -72,18 +74,14 @@ class Block : public block::Block,
 public:
     using CalculatedSize =
         std::pair<std::size_t, network::blockchain::bitcoin::CompactSize>;
-    using TxidIndex = UnallocatedVector<Space>;
+    using TxidIndex = UnallocatedVector<std::array<std::byte, 32>>;
     using TransactionMap = UnallocatedMap<ReadView, value_type>;
+    /// Offset and size of each transaction within the serialized block
+    using TransactionRanges =
+        UnallocatedVector<std::pair<std::size_t, std::size_t>>;
 
     static const std::size_t header_bytes_;
 
-    template <typename HashType>
-    static auto calculate_merkle_hash(
-        const api::Session& api,
-        const Type chain,
-        const HashType& lhs,
-        const HashType& rhs,
-        AllocateOutput out) -> bool;
     template <typename InputContainer, typename OutputContainer>
     static auto calculate_merkle_row(
         const api::Session& api,
@@ -109,12 +107,13 @@ public:
     }
     auto end() const noexcept -> const_iterator final { return cend(); }
     auto ExtractElements(const cfilter::Type style) const noexcept
-        -> Vector<Vector<std::byte>> final;
+        -> std::optional<Vector<Vector<std::byte>>> final;
     auto FindMatches(
         const cfilter::Type type,
         const blockchain::block::Patterns& outpoints,
         const blockchain::block::Patterns& scripts,
-        const Log& log) const noexcept -> blockchain::block::Matches final;
+        const Log& log) const noexcept
+        -> std::optional<blockchain::block::Matches> final;
     auto Print() const noexcept -> UnallocatedCString override;
     auto Serialize(AllocateOutput bytes) const noexcept -> bool final;
     auto size() const noexcept -> std::size_t final { return index_.size(); }
@@ -126,6 +125,18 @@ public:
         TxidIndex&& index,
         TransactionMap&& transactions,
         std::optional<CalculatedSize>&& size = {}) noexcept(false);
+    /// Construct a block which instantiates its transactions on demand
+    ///
+    /// The serialized block is retained and each transaction is deserialized
+    /// the first time it is accessed.
+    Block(
+        const api::Session& api,
+        const blockchain::Type chain,
+        std::unique_ptr<const blockchain::bitcoin::block::Header> header,
+        TxidIndex&& index,
+        TransactionRanges&& ranges,
+        Space&& serialized,
+        CalculatedSize&& size) noexcept(false);
     Block() = delete;
     Block(const Block&) = delete;
     Block(Block&&) = delete;
@@ -142,13 +153,20 @@ private:
 
     const std::unique_ptr<const blockchain::bitcoin::block::Header> header_p_;
     const blockchain::bitcoin::block::Header& header_;
+    const blockchain::Type chain_;
     const TxidIndex index_;
-    const TransactionMap transactions_;
+    const TransactionRanges ranges_;
+    const Space serialized_;
+    // NOTE entries are never removed so references to them remain valid
+    // after the lock is released
+    mutable libguarded::plain_guarded<TransactionMap> transactions_;
     mutable std::optional<CalculatedSize> size_;
 
     auto calculate_size() const noexcept -> CalculatedSize;
     virtual auto extra_bytes() const noexcept -> std::size_t { return 0; }
     auto get_or_calculate_size() const noexcept -> CalculatedSize;
+    auto get_transaction(const std::size_t index) const noexcept(false)
+        -> const value_type&;
     virtual auto serialize_post_header(ByteIterator& it, std::size_t& remaining)
         const noexcept -> bool;
 };
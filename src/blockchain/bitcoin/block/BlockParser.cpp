@@ -7,13 +7,21 @@
 #include "1_Internal.hpp"                            // IWYU pragma: associated
 #include "blockchain/bitcoin/block/BlockParser.hpp"  // IWYU pragma: associated
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <iterator>
 #include <limits>
+#include <memory>
+#include <optional>
 #include <stdexcept>
 
+#include "internal/blockchain/Blockchain.hpp"
 #include "internal/blockchain/bitcoin/Bitcoin.hpp"
 #include "internal/blockchain/bitcoin/block/Factory.hpp"
-#include "internal/blockchain/bitcoin/block/Transaction.hpp"  // IWYU pragma: keep
+#include "internal/util/P0330.hpp"
 #include "opentxs/blockchain/bitcoin/block/Header.hpp"
 #include "opentxs/blockchain/block/Hash.hpp"
 #include "opentxs/core/FixedByteArray.hpp"
@@ -22,6 +30,199 @@
 
 namespace opentxs::factory
 {
+static constexpr auto version_bytes_ = 4_uz;
+static constexpr auto segwit_bytes_ = 2_uz;
+static constexpr auto outpoint_bytes_ = 36_uz;
+static constexpr auto sequence_bytes_ = 4_uz;
+static constexpr auto value_bytes_ = 8_uz;
+static constexpr auto locktime_bytes_ = 4_uz;
+// version, input count, output count, and lock time
+static constexpr auto min_transaction_bytes_ =
+    version_bytes_ + 1_uz + 1_uz + locktime_bytes_;
+
+struct TransactionLayout {
+    std::size_t bytes_;
+    // position of the first witness byte in segwit transactions
+    std::optional<std::size_t> witness_;
+};
+
+static auto skip(
+    ByteIterator& it,
+    const ByteIterator end,
+    const std::size_t bytes,
+    const char* item) noexcept(false) -> void
+{
+    if (static_cast<std::size_t>(std::distance(it, end)) < bytes) {
+        throw std::runtime_error(
+            UnallocatedCString{"Partial transaction ("} + item + ")");
+    }
+
+    std::advance(it, bytes);
+}
+
+// Decodes a CompactSize without allocating
+static auto scan_size(ByteIterator& it, const ByteIterator end) noexcept(false)
+    -> std::size_t
+{
+    if (it == end) { throw std::runtime_error("Partial compact size"); }
+
+    const auto first = std::to_integer<std::uint8_t>(*it);
+    std::advance(it, 1);
+    const auto extra = [&]() -> std::size_t {
+        switch (first) {
+            case 0xfd: {
+
+                return 2;
+            }
+            case 0xfe: {
+
+                return 4;
+            }
+            case 0xff: {
+
+                return 8;
+            }
+            default: {
+
+                return 0;
+            }
+        }
+    }();
+
+    if (0 == extra) { return first; }
+
+    if (static_cast<std::size_t>(std::distance(it, end)) < extra) {
+        throw std::runtime_error("Partial compact size");
+    }
+
+    auto value = std::uint64_t{0};
+
+    for (auto i = 0_uz; i < extra; ++i) {
+        value |= std::uint64_t{std::to_integer<std::uint8_t>(it[i])} << (8 * i);
+    }
+
+    std::advance(it, extra);
+
+    if (value > std::numeric_limits<std::size_t>::max()) {
+        throw std::runtime_error("Compact size too large");
+    }
+
+    return static_cast<std::size_t>(value);
+}
+
+// Finds the boundaries of a serialized transaction without decoding it
+static auto scan_transaction(const ReadView in) noexcept(false)
+    -> TransactionLayout
+{
+    const auto* const start = reinterpret_cast<ByteIterator>(in.data());
+    const auto* const end = std::next(start, in.size());
+    const auto* it = start;
+    skip(it, end, version_bytes_, "version");
+    auto expectedSize = version_bytes_;
+    const auto segwit =
+        blockchain::bitcoin::HasSegwit(it, expectedSize, in.size())
+            .has_value();
+    const auto inputs = scan_size(it, end);
+
+    for (auto i = 0_uz; i < inputs; ++i) {
+        skip(it, end, outpoint_bytes_, "outpoint");
+        skip(it, end, scan_size(it, end), "input script");
+        skip(it, end, sequence_bytes_, "sequence");
+    }
+
+    const auto outputs = scan_size(it, end);
+
+    for (auto i = 0_uz; i < outputs; ++i) {
+        skip(it, end, value_bytes_, "value");
+        skip(it, end, scan_size(it, end), "output script");
+    }
+
+    auto output = TransactionLayout{};
+
+    if (segwit) {
+        output.witness_ = static_cast<std::size_t>(std::distance(start, it));
+
+        for (auto i = 0_uz; i < inputs; ++i) {
+            const auto items = scan_size(it, end);
+
+            for (auto j = 0_uz; j < items; ++j) {
+                skip(it, end, scan_size(it, end), "witness item");
+            }
+        }
+    }
+
+    skip(it, end, locktime_bytes_, "lock time");
+    output.bytes_ = static_cast<std::size_t>(std::distance(start, it));
+
+    return output;
+}
+
+// Calculates the txids of a range of serialized transactions, excluding the
+// segwit marker, flag and witnesses where present
+static auto hash_transactions(
+    const api::Session& api,
+    const blockchain::Type chain,
+    const ReadView in,
+    const BlockReturnType::TransactionRanges& ranges,
+    const UnallocatedVector<std::optional<std::size_t>>& witnesses,
+    const std::size_t first,
+    const std::size_t last,
+    BlockReturnType::TxidIndex& index) noexcept -> bool
+{
+    static_assert(sizeof(BlockReturnType::TxidIndex::value_type) == 32_uz);
+
+    auto preimages = Space{};
+    auto views = Vector<ReadView>{};
+    views.reserve(last - first);
+
+    // NOTE the preimage buffer must not reallocate once views into it exist
+    {
+        auto bytes = 0_uz;
+
+        for (auto i = first; i < last; ++i) {
+            if (witnesses[i].has_value()) {
+                bytes +=
+                    witnesses[i].value() - segwit_bytes_ + locktime_bytes_;
+            }
+        }
+
+        preimages.reserve(bytes);
+    }
+
+    for (auto i = first; i < last; ++i) {
+        const auto& [offset, bytes] = ranges[i];
+        const auto tx = in.substr(offset, bytes);
+        const auto& witness = witnesses[i];
+
+        if (false == witness.has_value()) {
+            views.emplace_back(tx);
+
+            continue;
+        }
+
+        const auto* data = reinterpret_cast<ByteIterator>(tx.data());
+        const auto start = preimages.size();
+        preimages.insert(
+            preimages.end(), data, std::next(data, version_bytes_));
+        preimages.insert(
+            preimages.end(),
+            std::next(data, version_bytes_ + segwit_bytes_),
+            std::next(data, witness.value()));
+        preimages.insert(
+            preimages.end(),
+            std::next(data, tx.size() - locktime_bytes_),
+            std::next(data, tx.size()));
+        views.emplace_back(
+            reinterpret_cast<const char*>(std::next(preimages.data(), start)),
+            preimages.size() - start);
+    }
+
+    auto* out = index[first].data();
+
+    return blockchain::internal::TransactionHashes(
+        api, chain, views, preallocated(32_uz * (last - first), out));
+}
+
 auto parse_header(
     const api::Session& api,
     const blockchain::Type chain,
@@ -85,26 +286,44 @@ auto parse_transactions(
         throw std::runtime_error("too many transactions");
     }
 
-    auto counter = int{-1};
     auto output = ParsedTransactions{};
-    auto& [index, transactions] = output;
-
-    while (transactions.size() < transactionCount) {
-        auto data = blockchain::bitcoin::EncodedTransaction::Deserialize(
-            api,
-            chain,
-            ReadView{
-                reinterpret_cast<const char*>(it), in.size() - expectedSize});
-        const auto txBytes = data.size();
+    auto& [index, ranges] = output;
+    // NOTE every transaction occupies at least min_transaction_bytes_ so the
+    // reservation is bounded by the size of the input
+    const auto reserve = std::min<std::size_t>(
+        transactionCount,
+        (in.size() - expectedSize) / min_transaction_bytes_ + 1_uz);
+    index.reserve(reserve);
+    ranges.reserve(reserve);
+    auto witnesses = UnallocatedVector<std::optional<std::size_t>>{};
+    witnesses.reserve(reserve);
+
+    while (ranges.size() < transactionCount) {
+        const auto view = ReadView{
+            reinterpret_cast<const char*>(it), in.size() - expectedSize};
+        const auto [txBytes, witness] = scan_transaction(view);
+        ranges.emplace_back(expectedSize, txBytes);
+        witnesses.emplace_back(witness);
         std::advance(it, txBytes);
         expectedSize += txBytes;
-        auto& txid = index.emplace_back(data.txid_);
-        transactions.emplace(
-            reader(txid),
-            BitcoinTransaction(
-                api, chain, ++counter, header.Timestamp(), std::move(data)));
     }
 
+    // NOTE the boundaries of every transaction are known at this point so the
+    // txids can be calculated independently
+    index.resize(ranges.size());
+    auto failed = std::atomic<bool>{false};
+    blockchain::internal::ForEachParallel(
+        api,
+        index.size(),
+        [&](const std::size_t first, const std::size_t last) {
+            const auto hashed = hash_transactions(
+                api, chain, in, ranges, witnesses, first, last, index);
+
+            if (false == hashed) { failed.store(true); }
+        });
+
+    if (failed.load()) { throw std::runtime_error("Failed to calculate txid"); }
+
     const auto merkle =
         BlockReturnType::calculate_merkle_value(api, chain, index);
 
@@ -112,6 +331,8 @@ auto parse_transactions(
         throw std::runtime_error("Invalid merkle hash");
     }
 
+    size = expectedSize;
+
     return output;
 }
 }  // namespace opentxs::factory
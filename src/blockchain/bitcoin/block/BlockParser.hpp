@@ -83,7 +83,7 @@ namespace opentxs::factory
 using BlockReturnType = blockchain::bitcoin::block::implementation::Block;
 using ByteIterator = const std::byte*;
 using ParsedTransactions =
-    std::pair<BlockReturnType::TxidIndex, BlockReturnType::TransactionMap>;
+    std::pair<BlockReturnType::TxidIndex, BlockReturnType::TransactionRanges>;
 
 auto parse_header(
     const api::Session& api,
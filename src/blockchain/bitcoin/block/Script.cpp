@@ -13,7 +13,6 @@
 #include <cstdint>
 #include <cstring>
 #include <iterator>
-#include <numeric>
 #include <sstream>
 #include <stdexcept>
 #include <string_view>
@@ -51,15 +50,14 @@ auto BitcoinScript(
     -> std::unique_ptr<blockchain::bitcoin::block::internal::Script>
 {
     using ReturnType = blockchain::bitcoin::block::implementation::Script;
-    auto elements = blockchain::bitcoin::block::ScriptElements{};
+    auto elements = ReturnType::Elements{};
 
     if ((nullptr == bytes.data()) || (0 == bytes.size()) ||
         (ReturnType::Position::Coinbase == role)) {
         return std::make_unique<ReturnType>(
-            chain, role, std::move(elements), 0);
+            chain, role, ReturnType::Bytes{}, std::move(elements));
     }
 
-    elements.reserve(bytes.size());
     const auto* it = reinterpret_cast<const std::byte*>(bytes.data());
     auto read = 0_uz;
     const auto target = bytes.size();
@@ -68,14 +66,15 @@ auto BitcoinScript(
     try {
         while (read < target) {
             auto& element = elements.emplace_back();
-            auto& [opcode, invalid, size, data] = element;
+            element.offset_ = static_cast<std::uint32_t>(read);
 
             try {
-                opcode = ReturnType::decode(*it);
+                element.opcode_ = ReturnType::decode(*it);
             } catch (...) {
                 if (allowInvalidOpcodes) {
-                    opcode = blockchain::bitcoin::block::OP::INVALIDOPCODE;
-                    invalid = *it;
+                    element.opcode_ =
+                        blockchain::bitcoin::block::OP::INVALIDOPCODE;
+                    element.invalid_ = true;
                 } else {
                     throw;
                 }
@@ -83,7 +82,7 @@ auto BitcoinScript(
 
             read += 1;
             std::advance(it, 1);
-            const auto direct = ReturnType::is_direct_push(opcode);
+            const auto direct = ReturnType::is_direct_push(element.opcode_);
 
             if (direct.has_value()) {
                 const auto& pushSize = direct.value();
@@ -100,19 +99,15 @@ auto BitcoinScript(
                     return {};
                 }
 
-                data = space(effectiveSize);
-
-                if (0u < effectiveSize) {
-                    std::memcpy(data.value().data(), it, effectiveSize);
-                }
-
+                element.data_ = true;
+                element.data_bytes_ = static_cast<std::uint32_t>(effectiveSize);
                 read += effectiveSize;
                 std::advance(it, effectiveSize);
 
                 continue;
             }
 
-            const auto push = ReturnType::is_push(opcode);
+            const auto push = ReturnType::is_push(element.opcode_);
 
             if (push.has_value()) {
                 auto buf = be::little_uint32_buf_t{};
@@ -137,14 +132,12 @@ auto BitcoinScript(
                     }
 
                     if (0u < effectiveSize) {
-                        size = space(effectiveSize);
-                        std::memcpy(size.value().data(), it, effectiveSize);
+                        element.push_bytes_ =
+                            static_cast<std::uint8_t>(effectiveSize);
+                        std::memcpy(
+                            static_cast<void*>(&buf), it, effectiveSize);
                         read += effectiveSize;
                         std::advance(it, effectiveSize);
-                        std::memcpy(
-                            static_cast<void*>(&buf),
-                            size.value().data(),
-                            effectiveSize);
                     }
                 }
 
@@ -164,8 +157,9 @@ auto BitcoinScript(
                     }
 
                     if (0u < effectiveSize) {
-                        data = space(effectiveSize);
-                        std::memcpy(data.value().data(), it, effectiveSize);
+                        element.data_ = true;
+                        element.data_bytes_ =
+                            static_cast<std::uint32_t>(effectiveSize);
                     }
 
                     read += effectiveSize;
@@ -181,11 +175,14 @@ auto BitcoinScript(
         return {};
     }
 
-    elements.shrink_to_fit();
-
     try {
+        const auto* start = reinterpret_cast<const std::byte*>(bytes.data());
+
         return std::make_unique<ReturnType>(
-            chain, role, std::move(elements), bytes.size());
+            chain,
+            role,
+            ReturnType::Bytes{start, std::next(start, target)},
+            std::move(elements));
     } catch (const std::exception& e) {
         LogVerbose()("opentxs::factory::")(__func__)(": ")(e.what()).Flush();
 
@@ -214,9 +211,7 @@ auto BitcoinScript(
         return {};
     }
 
-    elements.shrink_to_fit();
-
-    return std::make_unique<ReturnType>(chain, role, std::move(elements));
+    return std::make_unique<ReturnType>(chain, role, elements);
 }
 }  // namespace opentxs::factory
 
@@ -246,65 +241,66 @@ namespace opentxs::blockchain::bitcoin::block::implementation
 Script::Script(
     const blockchain::Type chain,
     const Position role,
-    ScriptElements&& elements,
-    std::optional<std::size_t> size) noexcept
+    Bytes&& script,
+    Elements&& elements) noexcept
     : chain_(chain)
     , role_(role)
-    , elements_(std::move(elements))
+    , script_(std::move(script))
+    , elements_(mark_data_pushes(script_, std::move(elements)))
     , type_(get_type(role_, elements_))
-    , size_(size)
+    , materialized_()
+{
+}
+
+Script::Script(
+    const blockchain::Type chain,
+    const Position role,
+    const ScriptElements& elements) noexcept
+    : Script(chain, role, flatten(elements), index(elements))
 {
 }
 
 Script::Script(const Script& rhs) noexcept
     : chain_(rhs.chain_)
     , role_(rhs.role_)
+    , script_(rhs.script_)
     , elements_(rhs.elements_)
     , type_(rhs.type_)
-    , size_(rhs.size_)
+    , materialized_()
 {
 }
 
-auto Script::bytes(const value_type& element) noexcept -> std::size_t
+auto Script::at(const std::size_t position) const noexcept(false)
+    -> const value_type&
 {
-    const auto& [opcode, invalid, bytes, data] = element;
-
-    return (invalid.has_value() ? sizeof(invalid.value()) : sizeof(opcode)) +
-           (bytes.has_value() ? bytes.value().size() : 0u) +
-           (data.has_value() ? data.value().size() : 0u);
-}
+    // NOTE the owning representation is only built for callers which inspect
+    // individual elements. Once populated it is never modified so references
+    // into it remain valid after the lock is released.
+    auto handle = materialized_.lock();
+    auto& elements = *handle;
+
+    if (elements.size() != elements_.size()) {
+        elements.clear();
+        elements.reserve(elements_.size());
+
+        for (const auto& element : elements_) {
+            elements.emplace_back(materialize(element));
+        }
+    }
 
-auto Script::bytes(const ScriptElements& script) noexcept -> std::size_t
-{
-    return std::accumulate(
-        std::begin(script),
-        std::end(script),
-        0_uz,
-        [](const std::size_t& lhs, const value_type& rhs) -> std::size_t {
-            return lhs + bytes(rhs);
-        });
+    return elements.at(position);
 }
 
 auto Script::CalculateHash160(
     const api::Session& api,
     const AllocateOutput output) const noexcept -> bool
 {
-    auto preimage = Space{};
-
-    if (false == Serialize(writer(preimage))) {
-        LogError()(OT_PRETTY_CLASS())("Failed to serialize script").Flush();
-
-        return false;
-    }
-
-    return blockchain::ScriptHash(api, chain_, reader(preimage), output);
+    return blockchain::ScriptHash(api, chain_, view(script_), output);
 }
 
 auto Script::CalculateSize() const noexcept -> std::size_t
 {
-    if (false == size_.has_value()) { size_ = bytes(elements_); }
-
-    return size_.value();
+    return script_.size();
 }
 
 auto Script::decode(const std::byte in) noexcept(false) -> OP
@@ -506,7 +502,7 @@ auto Script::decode(const std::byte in) noexcept(false) -> OP
     return map.at(std::to_integer<std::uint8_t>(in));
 }
 
-auto Script::evaluate_data(const ScriptElements& script) noexcept -> Pattern
+auto Script::evaluate_data(const Elements& script) noexcept -> Pattern
 {
     OT_ASSERT(2 <= script.size());
 
@@ -517,7 +513,7 @@ auto Script::evaluate_data(const ScriptElements& script) noexcept -> Pattern
     return Pattern::NullData;
 }
 
-auto Script::evaluate_multisig(const ScriptElements& script) noexcept -> Pattern
+auto Script::evaluate_multisig(const Elements& script) noexcept -> Pattern
 {
     OT_ASSERT(4 <= script.size());
 
@@ -544,7 +540,7 @@ auto Script::evaluate_multisig(const ScriptElements& script) noexcept -> Pattern
     return Pattern::PayToMultisig;
 }
 
-auto Script::evaluate_pubkey(const ScriptElements& script) noexcept -> Pattern
+auto Script::evaluate_pubkey(const Elements& script) noexcept -> Pattern
 {
     OT_ASSERT(2 == script.size());
 
@@ -553,8 +549,7 @@ auto Script::evaluate_pubkey(const ScriptElements& script) noexcept -> Pattern
     return Pattern::Custom;
 }
 
-auto Script::evaluate_pubkey_hash(const ScriptElements& script) noexcept
-    -> Pattern
+auto Script::evaluate_pubkey_hash(const Elements& script) noexcept -> Pattern
 {
     OT_ASSERT(5 == script.size());
 
@@ -577,8 +572,7 @@ auto Script::evaluate_pubkey_hash(const ScriptElements& script) noexcept
     return Pattern::PayToPubkeyHash;
 }
 
-auto Script::evaluate_script_hash(const ScriptElements& script) noexcept
-    -> Pattern
+auto Script::evaluate_script_hash(const Elements& script) noexcept -> Pattern
 {
     OT_ASSERT(3 == script.size());
 
@@ -594,16 +588,16 @@ auto Script::evaluate_script_hash(const ScriptElements& script) noexcept
     return Pattern::PayToScriptHash;
 }
 
-auto Script::evaluate_segwit(const ScriptElements& script) noexcept -> Pattern
+auto Script::evaluate_segwit(const Elements& script) noexcept -> Pattern
 {
     OT_ASSERT(2 == script.size());
 
     const auto& opcode = script.at(0).opcode_;
-    const auto& program = script.at(1).data_.value();
+    const auto program = std::size_t{script.at(1).data_bytes_};
 
     switch (to_number(opcode)) {
         case 0: {
-            switch (program.size()) {
+            switch (program) {
                 case 20: {
                     return Pattern::PayToWitnessPubkeyHash;
                 }
@@ -615,7 +609,7 @@ auto Script::evaluate_segwit(const ScriptElements& script) noexcept -> Pattern
             }
         } break;
         case 1: {
-            switch (program.size()) {
+            switch (program) {
                 case 32: {
                     return Pattern::PayToTaproot;
                 }
@@ -645,10 +639,12 @@ auto Script::ExtractElements(const cfilter::Type style) const noexcept
         case cfilter::Type::ES: {
             LogTrace()(OT_PRETTY_CLASS())("processing data pushes").Flush();
 
-            for (const auto& element : *this) {
+            for (const auto& element : elements_) {
                 if (is_data_push(element)) {
-                    const auto& data = element.data_.value();
-                    const auto* it{data.data()};
+                    const auto data = get_data(element);
+                    const auto* start =
+                        reinterpret_cast<const std::byte*>(data.data());
+                    const auto* it{start};
 
                     switch (data.size()) {
                         case 65: {
@@ -664,7 +660,8 @@ auto Script::ExtractElements(const cfilter::Type style) const noexcept
                         case 33:
                         case 32:
                         case 20: {
-                            output.emplace_back(data.cbegin(), data.cend());
+                            output.emplace_back(
+                                start, std::next(start, data.size()));
                         } break;
                         default: {
                         }
@@ -692,8 +689,7 @@ auto Script::ExtractElements(const cfilter::Type style) const noexcept
 
             LogTrace()(OT_PRETTY_CLASS())("processing serialized script")
                 .Flush();
-            auto& script = output.emplace_back();
-            Serialize(writer(script));
+            output.emplace_back(script_.cbegin(), script_.cend());
         }
     }
 
@@ -720,21 +716,49 @@ auto Script::ExtractPatterns(const api::Session& api) const noexcept
     return output;
 }
 
-auto Script::first_opcode(const ScriptElements& script) noexcept -> OP
+auto Script::first_opcode(const Elements& script) noexcept -> OP
 {
     return script.cbegin()->opcode_;
 }
 
+auto Script::flatten(const ScriptElements& elements) noexcept -> Bytes
+{
+    auto output = Bytes{};
+
+    for (const auto& [opcode, invalid, bytes, data] : elements) {
+        if (invalid.has_value()) {
+            output.emplace_back(invalid.value());
+        } else {
+            output.emplace_back(static_cast<std::byte>(opcode));
+        }
+
+        if (bytes.has_value()) {
+            output.insert(output.end(), bytes->cbegin(), bytes->cend());
+        }
+
+        if (data.has_value()) {
+            output.insert(output.end(), data->cbegin(), data->cend());
+        }
+    }
+
+    return output;
+}
+
 auto Script::get_data(const std::size_t position) const noexcept(false)
     -> ReadView
 {
-    const auto& data = elements_.at(position).data_;
+    const auto& element = elements_.at(position);
 
-    if (false == data.has_value()) {
+    if (false == element.data_) {
         throw std::out_of_range("No data at specified script position");
     }
 
-    return reader(data.value());
+    return get_data(element);
+}
+
+auto Script::get_data(const Element& element) const noexcept -> ReadView
+{
+    return view(script_).substr(element.data_offset(), element.data_bytes_);
 }
 
 auto Script::get_opcode(const std::size_t position) const noexcept(false) -> OP
@@ -742,9 +766,8 @@ auto Script::get_opcode(const std::size_t position) const noexcept(false) -> OP
     return elements_.at(position).opcode_;
 }
 
-auto Script::get_type(
-    const Position role,
-    const ScriptElements& script) noexcept -> Pattern
+auto Script::get_type(const Position role, const Elements& script) noexcept
+    -> Pattern
 {
     if (0 == script.size()) { return Pattern::Empty; }
 
@@ -781,6 +804,28 @@ auto Script::get_type(
     }
 }
 
+auto Script::index(const ScriptElements& elements) noexcept -> Elements
+{
+    auto output = Elements{};
+    output.reserve(elements.size());
+    auto offset = 0_uz;
+
+    for (const auto& [opcode, invalid, bytes, data] : elements) {
+        auto& element = output.emplace_back();
+        element.offset_ = static_cast<std::uint32_t>(offset);
+        element.opcode_ = opcode;
+        element.invalid_ = invalid.has_value();
+        element.push_bytes_ =
+            static_cast<std::uint8_t>(bytes.has_value() ? bytes->size() : 0u);
+        element.data_ = data.has_value();
+        element.data_bytes_ =
+            static_cast<std::uint32_t>(data.has_value() ? data->size() : 0u);
+        offset = element.data_offset() + element.data_bytes_;
+    }
+
+    return output;
+}
+
 auto Script::IsNotification(
     const std::uint8_t version,
     const PaymentCode& recipient) const noexcept -> bool
@@ -806,9 +851,37 @@ auto Script::IsNotification(
     return 0 == std::memcmp(expect.data(), std::next(bytes.data()), 32);
 }
 
-auto Script::is_data_push(const value_type& element) noexcept -> bool
+auto Script::is_data_push(const Element& element) noexcept -> bool
 {
-    return validate(element, true);
+    return element.data_push_;
+}
+
+auto Script::is_data_push(
+    const Element& element,
+    const ReadView script) noexcept -> bool
+{
+    if (element.invalid_ || (false == element.data_)) { return false; }
+
+    if (auto size = is_direct_push(element.opcode_); size.has_value()) {
+        if (0u != element.push_bytes_) { return false; }
+
+        return size.value() == element.data_bytes_;
+    } else if (auto push = is_push(element.opcode_); push.has_value()) {
+        const auto& pushBytes = push.value();
+
+        if (pushBytes != element.push_bytes_) { return false; }
+
+        auto buf = be::little_uint32_buf_t{};
+        std::memcpy(
+            static_cast<void*>(&buf),
+            std::next(script.data(), element.offset_ + 1_uz),
+            pushBytes);
+
+        return buf.value() == element.data_bytes_;
+    } else {
+
+        return false;
+    }
 }
 
 auto Script::is_direct_push(const OP opcode) noexcept(false)
@@ -835,23 +908,23 @@ auto Script::is_push(const OP opcode) noexcept(false)
     return std::nullopt;
 }
 
-auto Script::is_hash160(const value_type& element) noexcept -> bool
+auto Script::is_hash160(const Element& element) noexcept -> bool
 {
     if (false == is_data_push(element)) { return false; }
 
-    return 20 == element.data_->size();
+    return 20 == element.data_bytes_;
 }
 
-auto Script::is_public_key(const value_type& element) noexcept -> bool
+auto Script::is_public_key(const Element& element) noexcept -> bool
 {
     if (false == is_data_push(element)) { return false; }
 
-    const auto size = element.data_->size();
+    const auto size = element.data_bytes_;
 
     return (33 == size) || (65 == size);
 }
 
-auto Script::last_opcode(const ScriptElements& script) noexcept -> OP
+auto Script::last_opcode(const Elements& script) noexcept -> OP
 {
     return script.crbegin()->opcode_;
 }
@@ -901,19 +974,12 @@ auto Script::LikelyPubkeyHashes(const api::Session& api) const noexcept
         default: {
             for (const auto& element : elements_) {
                 if (is_hash160(element)) {
-                    OT_ASSERT(element.data_.has_value());
-
-                    output.emplace_back(api.Factory().DataFromBytes(
-                        reader(element.data_.value())));
+                    output.emplace_back(
+                        api.Factory().DataFromBytes(get_data(element)));
                 } else if (is_public_key(element)) {
-                    OT_ASSERT(element.data_.has_value());
-
                     auto hash = api.Factory().Data();
                     blockchain::PubkeyHash(
-                        api,
-                        chain_,
-                        reader(element.data_.value()),
-                        hash->WriteInto());
+                        api, chain_, get_data(element), hash->WriteInto());
                     output.emplace_back(std::move(hash));
                 }
             }
@@ -923,6 +989,42 @@ auto Script::LikelyPubkeyHashes(const api::Session& api) const noexcept
     return output;
 }
 
+auto Script::mark_data_pushes(
+    const Bytes& script,
+    Elements&& elements) noexcept -> Elements
+{
+    const auto bytes = view(script);
+
+    for (auto& element : elements) {
+        element.data_push_ = is_data_push(element, bytes);
+    }
+
+    return std::move(elements);
+}
+
+auto Script::materialize(const Element& element) const noexcept
+    -> ScriptElement
+{
+    auto output = ScriptElement{};
+    auto& [opcode, invalid, bytes, data] = output;
+    const auto* start = std::next(script_.data(), element.offset_);
+    opcode = element.opcode_;
+
+    if (element.invalid_) { invalid = *start; }
+
+    if (0u < element.push_bytes_) {
+        const auto* it = std::next(start, 1);
+        bytes.emplace(it, std::next(it, element.push_bytes_));
+    }
+
+    if (element.data_) {
+        const auto* it = std::next(script_.data(), element.data_offset());
+        data.emplace(it, std::next(it, element.data_bytes_));
+    }
+
+    return output;
+}
+
 auto Script::M() const noexcept -> std::optional<std::uint8_t>
 {
     if (Pattern::PayToMultisig != type_) { return {}; }
@@ -949,35 +1051,33 @@ auto Script::N() const noexcept -> std::optional<std::uint8_t>
     return to_number(get_opcode(elements_.size() - 2));
 }
 
-auto Script::potential_data(const ScriptElements& script) noexcept -> bool
+auto Script::potential_data(const Elements& script) noexcept -> bool
 {
     return (OP::RETURN == first_opcode(script)) && (2 <= script.size());
 }
 
-auto Script::potential_multisig(const ScriptElements& script) noexcept -> bool
+auto Script::potential_multisig(const Elements& script) noexcept -> bool
 {
     return (OP::CHECKMULTISIG == last_opcode(script)) && (4 <= script.size());
 }
 
-auto Script::potential_pubkey(const ScriptElements& script) noexcept -> bool
+auto Script::potential_pubkey(const Elements& script) noexcept -> bool
 {
     return (OP::CHECKSIG == last_opcode(script)) && (2 == script.size());
 }
 
-auto Script::potential_pubkey_hash(const ScriptElements& script) noexcept
-    -> bool
+auto Script::potential_pubkey_hash(const Elements& script) noexcept -> bool
 {
     return (OP::CHECKSIG == last_opcode(script)) && (5 == script.size());
 }
 
-auto Script::potential_script_hash(const ScriptElements& script) noexcept
-    -> bool
+auto Script::potential_script_hash(const Elements& script) noexcept -> bool
 {
     return (OP::HASH160 == first_opcode(script)) &&
            (OP::EQUAL == last_opcode(script)) && (3 == script.size());
 }
 
-auto Script::potential_segwit(const ScriptElements& script) noexcept -> bool
+auto Script::potential_segwit(const Elements& script) noexcept -> bool
 {
     if (2 != script.size()) { return false; }
 
@@ -1008,39 +1108,39 @@ auto Script::potential_segwit(const ScriptElements& script) noexcept -> bool
 
     const auto& element = script.at(1);
 
-    if (false == element.data_.has_value()) { return false; }
+    if (false == element.data_) { return false; }
 
-    const auto& program = element.data_.value();
+    const auto program = element.data_bytes_;
 
-    return (1u < program.size()) && (41u > program.size());
+    return (1u < program) && (41u > program);
 }
 
 auto Script::Print() const noexcept -> UnallocatedCString
 {
     auto output = std::stringstream{};
 
-    for (const auto& [opcode, invalid, push, data] : elements_) {
+    for (const auto& element : elements_) {
         output << "      op: "
-               << std::to_string(static_cast<std::uint8_t>(opcode));
+               << std::to_string(static_cast<std::uint8_t>(element.opcode_));
 
-        if (invalid) {
+        if (element.invalid_) {
             output << " invalid: "
-                   << std::to_string(
-                          std::to_integer<std::uint8_t>(invalid.value()));
+                   << std::to_string(std::to_integer<std::uint8_t>(
+                          script_.at(element.offset_)));
         }
 
-        if (push) {
+        if (0u < element.push_bytes_) {
             auto bytes = std::uint64_t{};
             std::memcpy(
                 &bytes,
-                push.value().data(),
-                std::min(push.value().size(), sizeof(bytes)));
+                std::next(script_.data(), element.offset_ + 1u),
+                std::min<std::size_t>(element.push_bytes_, sizeof(bytes)));
             output << " push bytes: " << bytes;
         }
 
-        if (data) {
+        if (element.data_) {
             auto item = Data::Factory();
-            item->Assign(reader(data.value()));
+            item->Assign(get_data(element));
             output << " (" << item->size() << ") bytes : " << item->asHex();
         }
 
@@ -1091,7 +1191,7 @@ auto Script::RedeemScript() const noexcept
     if (false == is_data_push(element)) { return {}; }
 
     return factory::BitcoinScript(
-        chain_, reader(element.data_.value()), Position::Redeem, true, true);
+        chain_, get_data(element), Position::Redeem, true, true);
 }
 
 auto Script::ScriptHash() const noexcept -> std::optional<ReadView>
@@ -1128,36 +1228,7 @@ auto Script::Serialize(const AllocateOutput destination) const noexcept -> bool
         return false;
     }
 
-    auto* it = static_cast<std::byte*>(output.data());
-
-    for (const auto& element : elements_) {
-        const auto& [opcode, invalid, bytes, data] = element;
-
-        if (invalid.has_value()) {
-            const auto& code = invalid.value();
-            std::memcpy(static_cast<void*>(it), &code, sizeof(code));
-            std::advance(it, sizeof(code));
-        } else {
-            std::memcpy(static_cast<void*>(it), &opcode, sizeof(opcode));
-            std::advance(it, sizeof(opcode));
-        }
-
-        if (bytes.has_value()) {
-            const auto& value = bytes.value();
-            std::memcpy(static_cast<void*>(it), value.data(), value.size());
-            std::advance(it, value.size());
-        }
-
-        if (data.has_value()) {
-            const auto& value = data.value();
-
-            if (0u < value.size()) {
-                std::memcpy(static_cast<void*>(it), value.data(), value.size());
-            }
-
-            std::advance(it, value.size());
-        }
-    }
+    std::memcpy(output.data(), script_.data(), size);
 
     return true;
 }
@@ -1175,7 +1246,7 @@ auto Script::SigningSubscript(const blockchain::Type chain) const noexcept
             elements.emplace_back(internal::Opcode(OP::CHECKSIG));
 
             return std::make_unique<Script>(
-                chain_, Position::Output, std::move(elements));
+                chain_, Position::Output, elements);
         }
         default: {
             // TODO handle OP_CODESEPERATOR shit
@@ -1251,6 +1322,11 @@ auto Script::validate(
     }
 }
 
+auto Script::view(const Bytes& script) noexcept -> ReadView
+{
+    return {reinterpret_cast<const char*>(script.data()), script.size()};
+}
+
 auto Script::Value(const std::size_t position) const noexcept
     -> std::optional<ReadView>
 {
@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <boost/container/small_vector.hpp>
+#include <cs_plain_guarded.h>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -47,6 +49,27 @@ namespace opentxs::blockchain::bitcoin::block::implementation
 class Script final : public internal::Script
 {
 public:
+    // Location of one element within the serialized script
+    struct Element {
+        std::uint32_t offset_{};
+        std::uint32_t data_bytes_{};
+        OP opcode_{};
+        std::uint8_t push_bytes_{};
+        bool invalid_{};
+        bool data_{};
+        bool data_push_{};
+
+        auto data_offset() const noexcept -> std::size_t
+        {
+            return std::size_t{offset_} + 1u + push_bytes_;
+        }
+    };
+
+    // NOTE the standard output patterns have at most five elements and 34
+    // bytes so neither table needs a heap allocation for the common case
+    using Bytes = boost::container::small_vector<std::byte, 40>;
+    using Elements = boost::container::small_vector<Element, 5>;
+
     static auto decode(const std::byte in) noexcept(false) -> OP;
     static auto is_direct_push(const OP opcode) noexcept(false)
         -> std::optional<std::size_t>;
@@ -55,10 +78,7 @@ public:
     static auto validate(const ScriptElements& elements) noexcept -> bool;
 
     auto at(const std::size_t position) const noexcept(false)
-        -> const value_type& final
-    {
-        return elements_.at(position);
-    }
+        -> const value_type& final;
     auto begin() const noexcept -> const_iterator final { return cbegin(); }
     auto CalculateHash160(const api::Session& api, const AllocateOutput output)
         const noexcept -> bool final;
@@ -107,8 +127,12 @@ public:
     Script(
         const blockchain::Type chain,
         const Position role,
-        ScriptElements&& elements,
-        std::optional<std::size_t> size = {}) noexcept;
+        Bytes&& script,
+        Elements&& elements) noexcept;
+    Script(
+        const blockchain::Type chain,
+        const Position role,
+        const ScriptElements& elements) noexcept;
     Script() = delete;
     Script(const Script&) noexcept;
     Script(Script&&) = delete;
@@ -120,46 +144,51 @@ public:
 private:
     const blockchain::Type chain_;
     const Position role_;
-    const ScriptElements elements_;
+    const Bytes script_;
+    const Elements elements_;
     const Pattern type_;
-    mutable std::optional<std::size_t> size_;
-
-    static auto bytes(const value_type& element) noexcept -> std::size_t;
-    static auto bytes(const ScriptElements& script) noexcept -> std::size_t;
-    static auto is_data_push(const value_type& element) noexcept -> bool;
-    static auto is_hash160(const value_type& element) noexcept -> bool;
-    static auto is_public_key(const value_type& element) noexcept -> bool;
-    static auto evaluate_data(const ScriptElements& script) noexcept -> Pattern;
-    static auto evaluate_multisig(const ScriptElements& script) noexcept
-        -> Pattern;
-    static auto evaluate_pubkey(const ScriptElements& script) noexcept
-        -> Pattern;
-    static auto evaluate_pubkey_hash(const ScriptElements& script) noexcept
+    mutable libguarded::plain_guarded<ScriptElements> materialized_;
+
+    static auto flatten(const ScriptElements& elements) noexcept -> Bytes;
+    static auto index(const ScriptElements& elements) noexcept -> Elements;
+    static auto is_data_push(const Element& element) noexcept -> bool;
+    static auto is_data_push(
+        const Element& element,
+        const ReadView script) noexcept -> bool;
+    static auto is_hash160(const Element& element) noexcept -> bool;
+    static auto is_public_key(const Element& element) noexcept -> bool;
+    static auto evaluate_data(const Elements& script) noexcept -> Pattern;
+    static auto evaluate_multisig(const Elements& script) noexcept -> Pattern;
+    static auto evaluate_pubkey(const Elements& script) noexcept -> Pattern;
+    static auto evaluate_pubkey_hash(const Elements& script) noexcept
         -> Pattern;
-    static auto evaluate_script_hash(const ScriptElements& script) noexcept
+    static auto evaluate_script_hash(const Elements& script) noexcept
         -> Pattern;
-    static auto evaluate_segwit(const ScriptElements& script) noexcept
+    static auto evaluate_segwit(const Elements& script) noexcept -> Pattern;
+    static auto first_opcode(const Elements& script) noexcept -> OP;
+    static auto get_type(const Position role, const Elements& script) noexcept
         -> Pattern;
-    static auto first_opcode(const ScriptElements& script) noexcept -> OP;
-    static auto get_type(
-        const Position role,
-        const ScriptElements& script) noexcept -> Pattern;
-    static auto last_opcode(const ScriptElements& script) noexcept -> OP;
-    static auto potential_data(const ScriptElements& script) noexcept -> bool;
-    static auto potential_multisig(const ScriptElements& script) noexcept
-        -> bool;
-    static auto potential_pubkey(const ScriptElements& script) noexcept -> bool;
-    static auto potential_pubkey_hash(const ScriptElements& script) noexcept
+    static auto last_opcode(const Elements& script) noexcept -> OP;
+    static auto mark_data_pushes(
+        const Bytes& script,
+        Elements&& elements) noexcept -> Elements;
+    static auto potential_data(const Elements& script) noexcept -> bool;
+    static auto potential_multisig(const Elements& script) noexcept -> bool;
+    static auto potential_pubkey(const Elements& script) noexcept -> bool;
+    static auto potential_pubkey_hash(const Elements& script) noexcept
         -> bool;
-    static auto potential_script_hash(const ScriptElements& script) noexcept
+    static auto potential_script_hash(const Elements& script) noexcept
         -> bool;
-    static auto potential_segwit(const ScriptElements& script) noexcept -> bool;
+    static auto potential_segwit(const Elements& script) noexcept -> bool;
     static auto to_number(const OP opcode) noexcept -> std::uint8_t;
     static auto validate(
         const ScriptElement& element,
         const bool checkForData = false) noexcept -> bool;
+    static auto view(const Bytes& script) noexcept -> ReadView;
 
     auto get_data(const std::size_t position) const noexcept(false) -> ReadView;
+    auto get_data(const Element& element) const noexcept -> ReadView;
     auto get_opcode(const std::size_t position) const noexcept(false) -> OP;
+    auto materialize(const Element& element) const noexcept -> ScriptElement;
 };
 }  // namespace opentxs::blockchain::bitcoin::block::implementation
@@ -15,6 +15,7 @@
 #include <ctime>
 #include <iomanip>
 #include <limits>
+#include <optional>
 #include <sstream>
 #include <stdexcept>
 #include <string_view>
@@ -22,7 +23,9 @@
 
 #include "Proto.hpp"
 #include "internal/blockchain/Blockchain.hpp"
+#include "internal/blockchain/bitcoin/UInt256.hpp"
 #include "internal/blockchain/bitcoin/block/Factory.hpp"
+#include "internal/blockchain/block/HeaderRecord.hpp"
 #include "internal/blockchain/node/Types.hpp"
 #include "internal/util/LogMacros.hpp"
 #include "opentxs/api/session/Factory.hpp"
@@ -139,6 +142,25 @@ auto BitcoinBlockHeader(
     }
 }
 
+auto BitcoinBlockHeader(
+    const api::Session& api,
+    const blockchain::block::internal::HeaderRecord& record) noexcept
+    -> std::unique_ptr<blockchain::bitcoin::block::Header>
+{
+    using ReturnType = blockchain::bitcoin::block::implementation::Header;
+
+    try {
+        auto imp = std::make_unique<ReturnType>(api, record);
+
+        return std::make_unique<blockchain::bitcoin::block::Header>(
+            imp.release());
+    } catch (const std::exception& e) {
+        LogError()("opentxs::factory::")(__func__)(": ")(e.what()).Flush();
+
+        return std::make_unique<blockchain::bitcoin::block::Header>();
+    }
+}
+
 auto BitcoinBlockHeader(
     const api::Session& api,
     const blockchain::Type chain,
@@ -363,6 +385,41 @@ Header::Header(
 {
 }
 
+Header::Header(
+    const api::Session& api,
+    const blockchain::block::internal::HeaderRecord& record) noexcept(false)
+    : Header(api, record.Type(), record.Raw(), record.local_, preimage(record))
+{
+}
+
+Header::Header(
+    const api::Session& api,
+    const blockchain::Type chain,
+    const ReadView raw,
+    const blockchain::block::internal::LocalRecord& local,
+    const BitcoinFormat& fields) noexcept(false)
+    : Header(
+          api,
+          default_version_,
+          chain,
+          calculate_hash(api, chain, raw),
+          calculate_pow(api, chain, raw),
+          ReadView{fields.previous_.data(), fields.previous_.size()},
+          local.height_.value(),
+          local.Status(),
+          local.InheritStatus(),
+          OTWork{factory::Work(local.Work())},
+          OTWork{factory::Work(local.InheritWork())},
+          subversion_default_,
+          fields.version_.value(),
+          ReadView{fields.merkle_.data(), fields.merkle_.size()},
+          Clock::from_time_t(std::time_t(fields.time_.value())),
+          fields.nbits_.value(),
+          fields.nonce_.value(),
+          true)
+{
+}
+
 Header::Header(const Header& rhs) noexcept
     : ot_super(rhs)
     , subversion_(rhs.subversion_)
@@ -505,7 +562,11 @@ auto Header::calculate_work(
 
 auto Header::check_pow() const noexcept -> bool
 {
-    return NumericHash() < Target();
+    const auto target = bitcoin::UInt256::FromCompact(nbits_);
+    const auto pow = bitcoin::UInt256::FromLittleEndian(pow_->Bytes());
+
+    return target.has_value() && pow.has_value() &&
+           (pow.value() < target.value());
 }
 
 auto Header::Encode() const noexcept -> OTData
@@ -544,6 +605,17 @@ auto Header::find_nonce() noexcept(false) -> void
     hash = calculate_hash(api_, type_, view);
 }
 
+auto Header::preimage(const blockchain::block::internal::HeaderRecord& in)
+    -> BitcoinFormat
+{
+    static_assert(sizeof(BitcoinFormat) == sizeof(in.raw_));
+
+    auto output = BitcoinFormat{};
+    std::memcpy(static_cast<void*>(&output), in.raw_.data(), in.raw_.size());
+
+    return output;
+}
+
 auto Header::preimage(const SerializedType& in) -> BitcoinFormat
 {
     return BitcoinFormat{
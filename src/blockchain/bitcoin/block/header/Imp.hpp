@@ -54,6 +54,12 @@ class Header;
 
 namespace block
 {
+namespace internal
+{
+struct HeaderRecord;
+struct LocalRecord;
+}  // namespace internal
+
 class Header;
 }  // namespace block
 }  // namespace blockchain
@@ -158,6 +164,10 @@ public:
         const blockchain::block::Height height) noexcept(false);
     Header(const api::Session& api, const SerializedType& serialized) noexcept(
         false);
+    Header(
+        const api::Session& api,
+        const blockchain::block::internal::HeaderRecord& record) noexcept(
+        false);
     Header() = delete;
     Header(const Header& rhs) noexcept;
     Header(Header&&) = delete;
@@ -185,6 +195,8 @@ private:
     static auto calculate_work(
         const blockchain::Type chain,
         const std::uint32_t nbits) -> OTWork;
+    static auto preimage(
+        const blockchain::block::internal::HeaderRecord& in) -> BitcoinFormat;
     static auto preimage(const SerializedType& in) -> BitcoinFormat;
 
     auto check_pow() const noexcept -> bool;
@@ -210,5 +222,11 @@ private:
         const std::uint32_t nbits,
         const std::uint32_t nonce,
         const bool validate) noexcept(false);
+    Header(
+        const api::Session& api,
+        const blockchain::Type chain,
+        const ReadView raw,
+        const blockchain::block::internal::LocalRecord& local,
+        const BitcoinFormat& fields) noexcept(false);
 };
 }  // namespace opentxs::blockchain::bitcoin::block::implementation
@@ -20,6 +20,7 @@
 #include <optional>
 #include <stdexcept>
 #include <string_view>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 
@@ -32,8 +33,6 @@
 #include "internal/util/BoostPMR.hpp"
 #include "internal/util/LogMacros.hpp"
 #include "internal/util/P0330.hpp"
-#include "opentxs/api/crypto/Hash.hpp"
-#include "opentxs/api/session/Crypto.hpp"
 #include "opentxs/api/session/Session.hpp"
 #include "opentxs/blockchain/bitcoin/cfilter/FilterType.hpp"
 #include "opentxs/blockchain/bitcoin/cfilter/Hash.hpp"
@@ -41,7 +40,6 @@
 #include "opentxs/blockchain/block/Block.hpp"
 #include "opentxs/blockchain/block/Hash.hpp"
 #include "opentxs/core/Data.hpp"
-#include "opentxs/crypto/HashType.hpp"
 #include "opentxs/network/blockchain/bitcoin/CompactSize.hpp"
 #include "opentxs/util/Allocator.hpp"
 #include "opentxs/util/Container.hpp"
@@ -237,7 +235,13 @@ auto GCS(
     try {
         const auto params = blockchain::internal::GetFilterParams(type);
         // TODO allocator
-        const auto input = block.Internal().ExtractElements(type);
+        const auto extracted = block.Internal().ExtractElements(type);
+
+        if (false == extracted.has_value()) {
+            throw std::runtime_error("Failed to extract elements from block");
+        }
+
+        const auto& input = extracted.value();
         auto elements = blockchain::GCS::Targets{alloc};
         std::transform(
             std::begin(input), std::end(input), std::back_inserter(elements), [
@@ -279,19 +283,19 @@ auto GCS(
 
 namespace opentxs::gcs
 {
-using BitReader = blockchain::internal::BitReader;
 using BitWriter = blockchain::internal::BitWriter;
 
-static auto golomb_decode(const std::uint8_t P, BitReader& stream) noexcept(
-    false) -> Delta
+static auto hash_to_range(const Range range, const Hash hash) noexcept
+    -> Element
 {
-    auto quotient = Delta{0};
+#if defined(__SIZEOF_INT128__)
+    using Wide = unsigned __int128;
 
-    while (1 == stream.read(1)) { quotient++; }
-
-    auto remainder = stream.read(P);
-
-    return Delta{(quotient << P) + remainder};
+    return static_cast<Element>((Wide{hash} * Wide{range}) >> 64u);
+#else
+    return ((bmp::uint128_t{hash} * bmp::uint128_t{range}) >> 64u)
+        .convert_to<Element>();
+#endif
 }
 
 static auto golomb_encode(
@@ -311,26 +315,6 @@ static auto golomb_encode(
     stream.write(P, remainder);
 }
 
-auto GolombDecode(
-    const std::uint32_t N,
-    const std::uint8_t P,
-    const Vector<std::byte>& encoded,
-    alloc::Default alloc) noexcept(false) -> Elements
-{
-    auto output = Elements{alloc};
-    auto stream = BitReader{encoded};
-    auto last = Element{0};
-
-    for (auto i = 0_uz; i < N; ++i) {
-        auto delta = golomb_decode(P, stream);
-        auto value = last + delta;
-        output.emplace_back(value);
-        last = value;
-    }
-
-    return output;
-}
-
 auto GolombEncode(
     const std::uint8_t P,
     const Elements& hashedSet,
@@ -365,48 +349,39 @@ auto HashToRange(
 
 auto HashToRange(const Range range, const Hash hash) noexcept(false) -> Element
 {
-    return ((bmp::uint128_t{hash} * bmp::uint128_t{range}) >> 64u)
-        .convert_to<Element>();
+    return hash_to_range(range, hash);
+}
+
+auto HashToRange(
+    const Range range,
+    const Hashes& hashes,
+    alloc::Default alloc) noexcept -> Elements
+{
+    auto output = Elements{hashes.size(), alloc};
+    auto* out = output.data();
+    const auto* in = hashes.data();
+    const auto count = hashes.size();
+
+    for (auto i = 0_uz; i < count; ++i) {
+        out[i] = hash_to_range(range, in[i]);
+    }
+
+    return output;
 }
 
 auto HashedSetConstruct(
-    const api::Session& api,
+    const api::Session&,
     const ReadView key,
     const std::uint32_t N,
     const std::uint32_t M,
     const blockchain::GCS::Targets& items,
     alloc::Default alloc) noexcept(false) -> Elements
 {
-    auto output = Elements{alloc};
-    std::transform(
-        std::begin(items),
-        std::end(items),
-        std::back_inserter(output),
-        [&](const auto& item) {
-            return HashToRange(api, key, range(N, M), item);
-        });
+    auto output = HashToRange(range(N, M), Siphash(key, items, {}), alloc);
     std::sort(output.begin(), output.end());
 
     return output;
 }
-
-auto Siphash(
-    const api::Session& api,
-    const ReadView key,
-    const ReadView item) noexcept(false) -> Hash
-{
-    if (16 != key.size()) { throw std::runtime_error("Invalid key"); }
-
-    auto output = Hash{};
-    auto writer = preallocated(sizeof(output), &output);
-
-    if (false == api.Crypto().Hash().HMAC(
-                     crypto::HashType::SipHash24, key, item, writer)) {
-        throw std::runtime_error("siphash failed");
-    }
-
-    return output;
-}
 }  // namespace opentxs::gcs
 
 namespace opentxs::blockchain::implementation
@@ -528,20 +503,20 @@ GCS::GCS(const GCS& rhs, allocator_type alloc) noexcept
 {
 }
 
-auto GCS::Compressed(AllocateOutput out) const noexcept -> bool
+auto GCS::CalculateSize() const noexcept -> std::size_t
 {
-    return copy(reader(compressed_), out);
-}
+    auto output = sizeof(*this) + compressed_.size();
 
-auto GCS::decompress() const noexcept -> const gcs::Elements&
-{
-    if (false == elements_.has_value()) {
-        auto& set = elements_;
-        set = gcs::GolombDecode(count_, bits_, compressed_, alloc_);
-        std::sort(set.value().begin(), set.value().end());
+    if (elements_.has_value()) {
+        output += elements_->size() * sizeof(gcs::Element);
     }
 
-    return elements_.value();
+    return output;
+}
+
+auto GCS::Compressed(AllocateOutput out) const noexcept -> bool
+{
+    return copy(reader(compressed_), out);
 }
 
 auto GCS::Encode(AllocateOutput cb) const noexcept -> bool
@@ -609,14 +584,8 @@ auto GCS::hashed_set_construct(
 auto GCS::hashed_set_construct(const gcs::Hashes& targets, allocator_type alloc)
     const noexcept -> gcs::Elements
 {
-    auto out = gcs::Elements{alloc};
-    out.reserve(targets.size());
-    const auto range = Range();
-    std::transform(
-        targets.begin(),
-        targets.end(),
-        std::back_inserter(out),
-        [&](const auto& hash) { return gcs::HashToRange(range, hash); });
+    auto out = gcs::HashToRange(Range(), targets, alloc);
+    dedup(out);
 
     return out;
 }
@@ -628,6 +597,49 @@ auto GCS::hashed_set_construct(const Targets& elements, allocator_type alloc)
         api_, reader(key_), count_, false_positive_rate_, elements, alloc);
 }
 
+auto GCS::intersect(
+    const gcs::Elements& targets,
+    const bool firstOnly,
+    gcs::Elements& out) const noexcept -> void
+{
+    if (elements_.has_value()) {
+        const auto& set = elements_.value();
+
+        if (firstOnly) {
+            auto t = targets.cbegin();
+            auto e = set.cbegin();
+
+            while ((t != targets.cend()) && (e != set.cend())) {
+                if (*t < *e) {
+                    ++t;
+                } else if (*e < *t) {
+                    ++e;
+                } else {
+                    out.emplace_back(*t);
+
+                    return;
+                }
+            }
+        } else {
+            std::set_intersection(
+                std::begin(targets),
+                std::end(targets),
+                std::begin(set),
+                std::end(set),
+                std::back_inserter(out));
+        }
+
+        return;
+    }
+
+    try {
+        gcs::GolombIntersect(
+            count_, bits_, compressed_, targets, firstOnly, out);
+    } catch (const std::exception& e) {
+        LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+    }
+}
+
 auto GCS::hash_to_range(const ReadView in) const noexcept -> gcs::Range
 {
     return gcs::HashToRange(api_, reader(key_), Range(), in);
@@ -667,13 +679,7 @@ auto GCS::Match(const Targets& targets, allocator_type alloc) const noexcept
     }
 
     dedup(hashed);
-    const auto& set = decompress();
-    std::set_intersection(
-        std::begin(hashed),
-        std::end(hashed),
-        std::begin(set),
-        std::end(set),
-        std::back_inserter(matches));
+    intersect(hashed, false, matches);
 
     for (const auto& match : matches) {
         auto& values = map.at(match);
@@ -708,13 +714,7 @@ auto GCS::Match(const gcs::Hashes& prehashed) const noexcept -> PrehashedMatches
     }
 
     dedup(hashed);
-    const auto& set = decompress();
-    std::set_intersection(
-        std::begin(hashed),
-        std::end(hashed),
-        std::begin(set),
-        std::end(set),
-        std::back_inserter(matches));
+    intersect(hashed, false, matches);
 
     for (const auto& match : matches) {
         auto& values = map.at(match);
@@ -724,6 +724,66 @@ auto GCS::Match(const gcs::Hashes& prehashed) const noexcept -> PrehashedMatches
     return output;
 }
 
+auto GCS::Match(const PrehashedSets& sets, allocator_type alloc) const noexcept
+    -> Vector<PrehashedMatches>
+{
+    auto output = Vector<PrehashedMatches>{alloc};
+    output.reserve(sets.size());
+    auto total = 0_uz;
+
+    for (const auto* set : sets) {
+        OT_ASSERT(nullptr != set);
+
+        output.emplace_back();
+        total += set->size();
+    }
+
+    using Target =
+        std::tuple<gcs::Element, std::size_t, gcs::Hashes::const_iterator>;
+    static constexpr auto bytesPerTarget =
+        sizeof(Target) + (2 * sizeof(gcs::Element));
+    auto monotonic = alloc::BoostMonotonic{(total + 1_uz) * bytesPerTarget};
+    auto targets = Vector<Target>{&monotonic};
+    targets.reserve(total);
+    const auto range = Range();
+
+    for (auto n = 0_uz; n < sets.size(); ++n) {
+        const auto& set = *sets[n];
+
+        for (auto i = set.cbegin(); i != set.cend(); ++i) {
+            targets.emplace_back(gcs::HashToRange(range, *i), n, i);
+        }
+    }
+
+    std::sort(targets.begin(), targets.end(), [](const auto& l, const auto& r) {
+        return std::get<0>(l) < std::get<0>(r);
+    });
+    auto hashed = gcs::Elements{&monotonic};
+    hashed.reserve(targets.size());
+
+    for (const auto& target : targets) {
+        const auto& element = std::get<0>(target);
+
+        if (hashed.empty() || (hashed.back() != element)) {
+            hashed.emplace_back(element);
+        }
+    }
+
+    auto matches = gcs::Elements{&monotonic};
+    intersect(hashed, false, matches);
+    auto match = matches.cbegin();
+
+    for (const auto& [element, n, i] : targets) {
+        while ((matches.cend() != match) && (*match < element)) { ++match; }
+
+        if (matches.cend() == match) { break; }
+
+        if (*match == element) { output[n].emplace_back(i); }
+    }
+
+    return output;
+}
+
 auto GCS::Range() const noexcept -> gcs::Range
 {
     return range(count_, false_positive_rate_);
@@ -760,7 +820,7 @@ auto GCS::Test(const ReadView target) const noexcept -> bool
 {
     auto buf = std::array<
         std::byte,
-        sizeof(target) + sizeof(ReadView) + sizeof(gcs::Element)>{};
+        sizeof(target) + sizeof(ReadView) + (2 * sizeof(gcs::Element))>{};
     auto alloc = alloc::BoostMonotonic{buf.data(), buf.size()};
 
     auto input = Targets{&alloc};
@@ -770,19 +830,10 @@ auto GCS::Test(const ReadView target) const noexcept -> bool
 
     OT_ASSERT(1 == set.size());
 
-    const auto& hash = set.front();
-
-    for (const auto& element : decompress()) {
-        if (element == hash) {
+    auto match = gcs::Elements{&alloc};
+    intersect(set, true, match);
 
-            return true;
-        } else if (element > hash) {
-
-            return false;
-        }
-    }
-
-    return false;
+    return false == match.empty();
 }
 
 auto GCS::Test(const Vector<OTData>& targets) const noexcept -> bool
@@ -814,15 +865,10 @@ auto GCS::Test(const gcs::Hashes& targets) const noexcept -> bool
 
 auto GCS::test(const gcs::Elements& targets) const noexcept -> bool
 {
-    const auto& set = decompress();
-    auto alloc = alloc::BoostMonotonic{1024};
-    auto matches = Vector<gcs::Element>{&alloc};
-    std::set_intersection(
-        std::begin(targets),
-        std::end(targets),
-        std::begin(set),
-        std::end(set),
-        std::back_inserter(matches));
+    auto buf = std::array<std::byte, 4 * sizeof(gcs::Element)>{};
+    auto alloc = alloc::BoostMonotonic{buf.data(), buf.size()};
+    auto matches = gcs::Elements{&alloc};
+    intersect(targets, true, matches);
 
     return 0 < matches.size();
 }
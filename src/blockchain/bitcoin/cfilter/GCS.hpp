@@ -53,6 +53,7 @@ public:
 
     const allocator_type alloc_;
 
+    auto CalculateSize() const noexcept -> std::size_t override { return {}; }
     virtual auto clone(allocator_type alloc) const noexcept
         -> std::unique_ptr<Imp>
     {
@@ -87,6 +88,11 @@ public:
     {
         return {};
     }
+    auto Match(const PrehashedSets& sets, allocator_type alloc) const noexcept
+        -> Vector<PrehashedMatches> override
+    {
+        return Vector<PrehashedMatches>{sets.size(), alloc};
+    }
     auto Range() const noexcept -> gcs::Range override { return {}; }
     auto Serialize(proto::GCS& out) const noexcept -> bool override
     {
@@ -133,6 +139,7 @@ public:
     {
         return std::make_unique<GCS>(*this, alloc);
     }
+    auto CalculateSize() const noexcept -> std::size_t final;
     auto Compressed(AllocateOutput out) const noexcept -> bool final;
     auto ElementCount() const noexcept -> std::uint32_t final { return count_; }
     auto Encode(AllocateOutput out) const noexcept -> bool final;
@@ -143,6 +150,8 @@ public:
     auto Match(const Targets&, allocator_type) const noexcept -> Matches final;
     auto Match(const gcs::Hashes& prehashed) const noexcept
         -> PrehashedMatches final;
+    auto Match(const PrehashedSets& sets, allocator_type alloc) const noexcept
+        -> Vector<PrehashedMatches> final;
     auto Range() const noexcept -> gcs::Range final;
     auto Serialize(proto::GCS& out) const noexcept -> bool final;
     auto Serialize(AllocateOutput out) const noexcept -> bool final;
@@ -196,7 +205,6 @@ private:
         const Vector<Space>& in,
         allocator_type alloc) noexcept -> Targets;
 
-    auto decompress() const noexcept -> const gcs::Elements&;
     auto hashed_set_construct(
         const Vector<OTData>& elements,
         allocator_type alloc) const noexcept -> gcs::Elements;
@@ -207,6 +215,10 @@ private:
         const noexcept -> gcs::Elements;
     auto hashed_set_construct(const Targets& elements, allocator_type alloc)
         const noexcept -> gcs::Elements;
+    auto intersect(
+        const gcs::Elements& targets,
+        const bool firstOnly,
+        gcs::Elements& out) const noexcept -> void;
     auto test(const gcs::Elements& targetHashes) const noexcept -> bool;
     auto hash_to_range(const ReadView in) const noexcept -> gcs::Range;
 
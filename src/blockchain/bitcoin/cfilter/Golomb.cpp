@@ -0,0 +1,298 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"    // IWYU pragma: associated
+#include "1_Internal.hpp"  // IWYU pragma: associated
+#include "internal/blockchain/bitcoin/cfilter/GCS.hpp"  // IWYU pragma: associated
+
+#include <boost/endian/conversion.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "internal/util/LogMacros.hpp"
+#include "internal/util/P0330.hpp"
+#include "opentxs/util/Container.hpp"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define OT_GOLOMB_BMI2 1
+#else
+#define OT_GOLOMB_BMI2 0
+#endif
+
+namespace be = boost::endian;
+
+namespace opentxs::gcs
+{
+// Reads a Golomb-Rice coded bitstream one machine word at a time
+//
+// The behavior at the end of the input matches blockchain::internal::BitReader
+// exactly: a unary run is terminated by the end of the stream, and a
+// fixed-width read which can not be satisfied consumes the remaining bits and
+// returns zero.
+class GolombReader
+{
+public:
+    auto Next() noexcept -> Delta
+    {
+        const auto quotient = unary();
+
+        return Delta{(quotient << P_) + read(P_)};
+    }
+
+    GolombReader(const std::uint8_t P, const Vector<std::byte>& in) noexcept
+        : P_(P)
+        , data_(reinterpret_cast<const std::uint8_t*>(in.data()))
+        , end_(data_ + in.size())
+        , buf_(0)
+        , bits_(0)
+    {
+        OT_ASSERT(P_ < 32u);
+    }
+
+private:
+    static constexpr auto all_ = ~std::uint64_t{0};
+
+    const std::uint8_t P_;
+    const std::uint8_t* data_;
+    const std::uint8_t* const end_;
+    // unread bits are left aligned, all other bits are zero
+    std::uint64_t buf_;
+    unsigned bits_;
+
+    static auto leading_ones(const std::uint64_t value) noexcept -> unsigned
+    {
+        const auto inverted = ~value;
+
+        if (0u == inverted) { return 64u; }
+
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<unsigned>(__builtin_clzll(inverted));
+#else
+        auto out = 0u;
+
+        for (auto mask = std::uint64_t{1} << 63u; 0u != (value & mask);
+             mask >>= 1u) {
+            ++out;
+        }
+
+        return out;
+#endif
+    }
+
+    auto consume(const unsigned bits) noexcept -> void
+    {
+        buf_ <<= bits;
+        bits_ -= bits;
+    }
+    auto read(const unsigned bits) noexcept -> std::uint64_t
+    {
+        if (0u == bits) { return 0u; }
+
+        if (bits_ < bits) {
+            refill();
+
+            if (bits_ < bits) {
+                data_ = end_;
+                buf_ = 0u;
+                bits_ = 0u;
+
+                return 0u;
+            }
+        }
+
+        const auto out = buf_ >> (64u - bits);
+        consume(bits);
+
+        return out;
+    }
+    auto refill() noexcept -> void
+    {
+        static constexpr auto word = sizeof(std::uint64_t);
+
+        if (word <= static_cast<std::size_t>(end_ - data_)) {
+            auto next = std::uint64_t{};
+            std::memcpy(&next, data_, word);
+            buf_ |= be::big_to_native(next) >> bits_;
+            const auto bytes = (63u - bits_) >> 3u;
+            data_ += bytes;
+            bits_ += bytes * 8u;
+            buf_ &= ~(all_ >> bits_);
+        } else {
+            while ((56u >= bits_) && (data_ != end_)) {
+                buf_ |= std::uint64_t{*data_} << (56u - bits_);
+                ++data_;
+                bits_ += 8u;
+            }
+        }
+    }
+    auto unary() noexcept -> Delta
+    {
+        auto out = Delta{0};
+
+        while (true) {
+            if (0u == bits_) {
+                refill();
+
+                if (0u == bits_) { return out; }
+            }
+
+            const auto ones = std::min(leading_ones(buf_), bits_);
+            out += ones;
+
+            if (ones < bits_) {
+                consume(ones + 1u);
+
+                return out;
+            } else {
+                consume(ones);
+            }
+        }
+    }
+};
+
+template <typename Reader>
+static auto golomb_decode(
+    const std::uint32_t N,
+    const std::uint8_t P,
+    const Vector<std::byte>& encoded,
+    Elements& out) noexcept -> void
+{
+    // NOTE a valid element consumes at least P + 1 bits, so a malformed
+    // element count can not cause an oversized allocation
+    const auto limit = ((encoded.size() * 8_uz) / (P + 1_uz)) + 1_uz;
+    out.reserve(std::min<std::size_t>(N, limit));
+    auto stream = Reader{P, encoded};
+    auto last = Element{0};
+
+    for (auto i = 0_uz; i < N; ++i) {
+        last += stream.Next();
+        out.emplace_back(last);
+    }
+}
+
+template <typename Reader>
+static auto golomb_intersect(
+    const std::uint32_t N,
+    const std::uint8_t P,
+    const Vector<std::byte>& encoded,
+    const Elements& targets,
+    const bool firstOnly,
+    Elements& out) noexcept -> void
+{
+    if (targets.empty()) { return; }
+
+    auto stream = Reader{P, encoded};
+    auto target = targets.cbegin();
+    const auto end = targets.cend();
+    auto value = Element{0};
+
+    for (auto i = 0_uz; i < N; ++i) {
+        value += stream.Next();
+
+        while (*target < value) {
+            if (++target == end) { return; }
+        }
+
+        if (*target == value) {
+            out.emplace_back(value);
+
+            if (firstOnly) { return; }
+
+            if (++target == end) { return; }
+        }
+    }
+}
+
+static auto decode_portable(
+    const std::uint32_t N,
+    const std::uint8_t P,
+    const Vector<std::byte>& encoded,
+    Elements& out) noexcept -> void
+{
+    golomb_decode<GolombReader>(N, P, encoded, out);
+}
+
+static auto intersect_portable(
+    const std::uint32_t N,
+    const std::uint8_t P,
+    const Vector<std::byte>& encoded,
+    const Elements& targets,
+    const bool firstOnly,
+    Elements& out) noexcept -> void
+{
+    golomb_intersect<GolombReader>(N, P, encoded, targets, firstOnly, out);
+}
+
+#if OT_GOLOMB_BMI2
+// NOTE every cpu which supports bmi2 also supports lzcnt
+[[gnu::target("bmi,bmi2,lzcnt"), gnu::flatten]] static auto decode_bmi2(
+    const std::uint32_t N,
+    const std::uint8_t P,
+    const Vector<std::byte>& encoded,
+    Elements& out) noexcept -> void
+{
+    golomb_decode<GolombReader>(N, P, encoded, out);
+}
+
+[[gnu::target("bmi,bmi2,lzcnt"), gnu::flatten]] static auto intersect_bmi2(
+    const std::uint32_t N,
+    const std::uint8_t P,
+    const Vector<std::byte>& encoded,
+    const Elements& targets,
+    const bool firstOnly,
+    Elements& out) noexcept -> void
+{
+    golomb_intersect<GolombReader>(N, P, encoded, targets, firstOnly, out);
+}
+#endif  // OT_GOLOMB_BMI2
+
+struct GolombDecoder {
+    decltype(&decode_portable) decode_;
+    decltype(&intersect_portable) intersect_;
+};
+
+static auto golomb_decoder() noexcept -> const GolombDecoder&
+{
+    static const auto decoder = []() -> GolombDecoder {
+#if OT_GOLOMB_BMI2
+        __builtin_cpu_init();
+
+        if (__builtin_cpu_supports("bmi2")) {
+
+            return {decode_bmi2, intersect_bmi2};
+        }
+#endif  // OT_GOLOMB_BMI2
+
+        return {decode_portable, intersect_portable};
+    }();
+
+    return decoder;
+}
+
+auto GolombDecode(
+    const std::uint32_t N,
+    const std::uint8_t P,
+    const Vector<std::byte>& encoded,
+    alloc::Default alloc) noexcept(false) -> Elements
+{
+    auto output = Elements{alloc};
+    golomb_decoder().decode_(N, P, encoded, output);
+
+    return output;
+}
+
+auto GolombIntersect(
+    const std::uint32_t N,
+    const std::uint8_t P,
+    const Vector<std::byte>& encoded,
+    const Elements& targets,
+    const bool firstOnly,
+    Elements& out) noexcept(false) -> void
+{
+    golomb_decoder().intersect_(N, P, encoded, targets, firstOnly, out);
+}
+}  // namespace opentxs::gcs
@@ -0,0 +1,313 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"    // IWYU pragma: associated
+#include "1_Internal.hpp"  // IWYU pragma: associated
+#include "internal/blockchain/bitcoin/cfilter/GCS.hpp"  // IWYU pragma: associated
+
+#include <boost/endian/conversion.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+
+#include "internal/util/P0330.hpp"
+#include "opentxs/util/Container.hpp"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define OT_SIPHASH_AVX2 1
+#include <immintrin.h>
+#else
+#define OT_SIPHASH_AVX2 0
+#endif
+
+namespace be = boost::endian;
+
+namespace opentxs::gcs
+{
+// SipHash-2-4 with a 64 bit output, as specified by BIP-158
+//
+// Hashing many short items under the same key is the dominant cost of both
+// cfilter construction and wallet prehashing. The generic hash provider is
+// designed for single large messages and costs a virtual dispatch, a key
+// schedule and an output buffer per item, so the hashed set code calls these
+// kernels directly instead.
+struct SiphashKey {
+    std::uint64_t k0_;
+    std::uint64_t k1_;
+};
+
+static constexpr auto siphash_c0_ = std::uint64_t{0x736f6d6570736575};
+static constexpr auto siphash_c1_ = std::uint64_t{0x646f72616e646f6d};
+static constexpr auto siphash_c2_ = std::uint64_t{0x6c7967656e657261};
+static constexpr auto siphash_c3_ = std::uint64_t{0x7465646279746573};
+
+static auto load64(const std::uint8_t* in) noexcept -> std::uint64_t
+{
+    auto out = std::uint64_t{};
+    std::memcpy(&out, in, sizeof(out));
+
+    return be::little_to_native(out);
+}
+
+static auto make_key(const ReadView key) noexcept(false) -> SiphashKey
+{
+    if (16 != key.size()) { throw std::runtime_error("Invalid key"); }
+
+    const auto* in = reinterpret_cast<const std::uint8_t*>(key.data());
+
+    return {load64(in), load64(std::next(in, 8))};
+}
+
+// The final compression block contains the trailing bytes of the message
+// followed by the low byte of its length
+static auto last_block(const ReadView item) noexcept -> std::uint64_t
+{
+    const auto size = item.size();
+    const auto tail = size & 7_uz;
+    const auto* in = std::next(
+        reinterpret_cast<const std::uint8_t*>(item.data()), size - tail);
+    auto out = std::uint64_t{size} << 56u;
+
+    for (auto i = 0_uz; i < tail; ++i) {
+        out |= std::uint64_t{in[i]} << (8u * i);
+    }
+
+    return out;
+}
+
+static constexpr auto rotl(const std::uint64_t x, const unsigned b) noexcept
+    -> std::uint64_t
+{
+    return (x << b) | (x >> (64u - b));
+}
+
+static auto siphash_round(
+    std::uint64_t& v0,
+    std::uint64_t& v1,
+    std::uint64_t& v2,
+    std::uint64_t& v3) noexcept -> void
+{
+    v0 += v1;
+    v1 = rotl(v1, 13u);
+    v1 ^= v0;
+    v0 = rotl(v0, 32u);
+    v2 += v3;
+    v3 = rotl(v3, 16u);
+    v3 ^= v2;
+    v0 += v3;
+    v3 = rotl(v3, 21u);
+    v3 ^= v0;
+    v2 += v1;
+    v1 = rotl(v1, 17u);
+    v1 ^= v2;
+    v2 = rotl(v2, 32u);
+}
+
+static auto siphash(const SiphashKey& key, const ReadView item) noexcept
+    -> Hash
+{
+    auto v0 = key.k0_ ^ siphash_c0_;
+    auto v1 = key.k1_ ^ siphash_c1_;
+    auto v2 = key.k0_ ^ siphash_c2_;
+    auto v3 = key.k1_ ^ siphash_c3_;
+    const auto* in = reinterpret_cast<const std::uint8_t*>(item.data());
+    const auto blocks = item.size() / 8_uz;
+    const auto compress = [&](const std::uint64_t m) {
+        v3 ^= m;
+        siphash_round(v0, v1, v2, v3);
+        siphash_round(v0, v1, v2, v3);
+        v0 ^= m;
+    };
+
+    for (auto i = 0_uz; i < blocks; ++i) {
+        compress(load64(std::next(in, 8 * i)));
+    }
+
+    compress(last_block(item));
+    v2 ^= 0xff;
+    siphash_round(v0, v1, v2, v3);
+    siphash_round(v0, v1, v2, v3);
+    siphash_round(v0, v1, v2, v3);
+    siphash_round(v0, v1, v2, v3);
+
+    return v0 ^ v1 ^ v2 ^ v3;
+}
+
+static auto siphash_portable(
+    const SiphashKey& key,
+    const blockchain::GCS::Targets& items,
+    Hashes& out) noexcept -> void
+{
+    for (const auto& item : items) { out.emplace_back(siphash(key, item)); }
+}
+
+#if OT_SIPHASH_AVX2
+template <int B>
+[[gnu::target("avx2"), gnu::always_inline]] static inline auto rotl4(
+    const __m256i x) noexcept -> __m256i
+{
+    if constexpr (32 == B) {
+
+        return _mm256_shuffle_epi32(x, 0xb1);
+    } else {
+
+        return _mm256_or_si256(
+            _mm256_slli_epi64(x, B), _mm256_srli_epi64(x, 64 - B));
+    }
+}
+
+[[gnu::target("avx2"), gnu::always_inline]] static inline auto siphash_round4(
+    __m256i& v0,
+    __m256i& v1,
+    __m256i& v2,
+    __m256i& v3) noexcept -> void
+{
+    v0 = _mm256_add_epi64(v0, v1);
+    v1 = rotl4<13>(v1);
+    v1 = _mm256_xor_si256(v1, v0);
+    v0 = rotl4<32>(v0);
+    v2 = _mm256_add_epi64(v2, v3);
+    v3 = rotl4<16>(v3);
+    v3 = _mm256_xor_si256(v3, v2);
+    v0 = _mm256_add_epi64(v0, v3);
+    v3 = rotl4<21>(v3);
+    v3 = _mm256_xor_si256(v3, v0);
+    v2 = _mm256_add_epi64(v2, v1);
+    v1 = rotl4<17>(v1);
+    v1 = _mm256_xor_si256(v1, v2);
+    v2 = rotl4<32>(v2);
+}
+
+[[gnu::target("avx2"), gnu::always_inline]] static inline auto siphash_compress4(
+    const __m256i m,
+    __m256i& v0,
+    __m256i& v1,
+    __m256i& v2,
+    __m256i& v3) noexcept -> void
+{
+    v3 = _mm256_xor_si256(v3, m);
+    siphash_round4(v0, v1, v2, v3);
+    siphash_round4(v0, v1, v2, v3);
+    v0 = _mm256_xor_si256(v0, m);
+}
+
+// Hashes four items of identical length, one per 64 bit lane
+[[gnu::target("avx2")]] static auto siphash4(
+    const SiphashKey& key,
+    const ReadView* items,
+    std::uint64_t* out) noexcept -> void
+{
+    const auto k0 = _mm256_set1_epi64x(static_cast<long long>(key.k0_));
+    const auto k1 = _mm256_set1_epi64x(static_cast<long long>(key.k1_));
+    auto v0 = _mm256_xor_si256(
+        k0, _mm256_set1_epi64x(static_cast<long long>(siphash_c0_)));
+    auto v1 = _mm256_xor_si256(
+        k1, _mm256_set1_epi64x(static_cast<long long>(siphash_c1_)));
+    auto v2 = _mm256_xor_si256(
+        k0, _mm256_set1_epi64x(static_cast<long long>(siphash_c2_)));
+    auto v3 = _mm256_xor_si256(
+        k1, _mm256_set1_epi64x(static_cast<long long>(siphash_c3_)));
+    const auto blocks = items[0].size() / 8_uz;
+    const auto lane = [&](const std::size_t i, const std::size_t offset) {
+        return static_cast<long long>(load64(std::next(
+            reinterpret_cast<const std::uint8_t*>(items[i].data()), offset)));
+    };
+
+    for (auto b = 0_uz; b < blocks; ++b) {
+        const auto offset = 8_uz * b;
+        const auto m = _mm256_set_epi64x(
+            lane(3, offset), lane(2, offset), lane(1, offset), lane(0, offset));
+        siphash_compress4(m, v0, v1, v2, v3);
+    }
+
+    const auto last = _mm256_set_epi64x(
+        static_cast<long long>(last_block(items[3])),
+        static_cast<long long>(last_block(items[2])),
+        static_cast<long long>(last_block(items[1])),
+        static_cast<long long>(last_block(items[0])));
+    siphash_compress4(last, v0, v1, v2, v3);
+    v2 = _mm256_xor_si256(v2, _mm256_set1_epi64x(0xff));
+    siphash_round4(v0, v1, v2, v3);
+    siphash_round4(v0, v1, v2, v3);
+    siphash_round4(v0, v1, v2, v3);
+    siphash_round4(v0, v1, v2, v3);
+    const auto result = _mm256_xor_si256(
+        _mm256_xor_si256(v0, v1), _mm256_xor_si256(v2, v3));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), result);
+}
+
+[[gnu::target("avx2")]] static auto siphash_avx2(
+    const SiphashKey& key,
+    const blockchain::GCS::Targets& items,
+    Hashes& out) noexcept -> void
+{
+    static constexpr auto lanes = 4_uz;
+    const auto count = items.size();
+    auto i = 0_uz;
+
+    // NOTE wallet targets and block elements are dominated by runs of items
+    // with the same length (hashes, public keys, outpoints), which is what
+    // allows them to be processed in lockstep
+    while ((i + lanes) <= count) {
+        const auto* group = std::next(items.data(), i);
+        const auto size = group[0].size();
+
+        if ((size == group[1].size()) && (size == group[2].size()) &&
+            (size == group[3].size())) {
+            auto hashes = std::array<std::uint64_t, lanes>{};
+            siphash4(key, group, hashes.data());
+            out.insert(out.end(), hashes.begin(), hashes.end());
+            i += lanes;
+        } else {
+            out.emplace_back(siphash(key, group[0]));
+            ++i;
+        }
+    }
+
+    for (; i < count; ++i) { out.emplace_back(siphash(key, items[i])); }
+}
+#endif  // OT_SIPHASH_AVX2
+
+using SiphashBatch = decltype(&siphash_portable);
+
+static auto siphash_batch() noexcept -> SiphashBatch
+{
+    static const auto batch = []() -> SiphashBatch {
+#if OT_SIPHASH_AVX2
+        __builtin_cpu_init();
+
+        if (__builtin_cpu_supports("avx2")) { return siphash_avx2; }
+#endif  // OT_SIPHASH_AVX2
+
+        return siphash_portable;
+    }();
+
+    return batch;
+}
+
+auto Siphash(
+    const api::Session&,
+    const ReadView key,
+    const ReadView item) noexcept(false) -> Hash
+{
+    return siphash(make_key(key), item);
+}
+
+auto Siphash(
+    const ReadView key,
+    const blockchain::GCS::Targets& items,
+    alloc::Default alloc) noexcept(false) -> Hashes
+{
+    const auto k = make_key(key);
+    auto output = Hashes{alloc};
+    output.reserve(items.size());
+    siphash_batch()(k, items, output);
+
+    return output;
+}
+}  // namespace opentxs::gcs
@@ -33,6 +33,7 @@
 #include "internal/blockchain/database/Types.hpp"
 #include "internal/blockchain/node/BlockBatch.hpp"
 #include "internal/blockchain/node/BlockOracle.hpp"
+#include "internal/blockchain/node/Config.hpp"
 #include "internal/blockchain/node/HeaderOracle.hpp"
 #include "internal/blockchain/node/Manager.hpp"
 #include "internal/blockchain/node/Mempool.hpp"
@@ -42,6 +43,7 @@
 #include "internal/blockchain/p2p/bitcoin/Factory.hpp"
 #include "internal/blockchain/p2p/bitcoin/message/Message.hpp"
 #include "internal/util/LogMacros.hpp"
+#include "internal/util/P0330.hpp"
 #include "opentxs/OT.hpp"
 #include "opentxs/api/crypto/Util.hpp"
 #include "opentxs/api/session/Crypto.hpp"
@@ -217,7 +219,13 @@ Peer::Peer(
     , protocol_((0 == protocol) ? default_protocol_version_ : protocol)
     , nonce_(nonce(api_))
     , local_services_(
-          get_local_services(protocol_, chain_, policy, localServices))
+          get_local_services(
+              protocol_,
+              chain_,
+              policy,
+              (0_uz < config.block_prune_depth_) ||
+                  (0_uz < config.block_prune_bytes_),
+              localServices))
     , relay_(relay)
     , get_headers_()
 {
@@ -324,6 +332,7 @@ auto Peer::get_local_services(
     const ProtocolVersion version,
     const blockchain::Type network,
     const database::BlockStorage policy,
+    const bool pruning,
     const UnallocatedSet<p2p::Service>& input) noexcept
     -> UnallocatedSet<p2p::Service>
 {
@@ -358,7 +367,9 @@ auto Peer::get_local_services(
 
     switch (policy) {
         case database::BlockStorage::All: {
-            output.emplace(p2p::Service::Network);
+            // NOTE a pruning node can not serve the full chain
+            output.emplace(
+                pruning ? p2p::Service::Limited : p2p::Service::Network);
             output.emplace(p2p::Service::CompactFilters);
         } break;
         case database::BlockStorage::Cache: {
@@ -1077,21 +1088,13 @@ auto Peer::process_getcfilters(
         return;
     }
 
-    // TODO allocator
-    auto data = Vector<GCS>{};
-    data.reserve(count);
-    const auto& filters = network_.FilterOracle();
     const auto type = message.Type();
     const auto hashes = headers_.BestHashes(startHeight, stopHash);
+    // TODO allocator
+    const auto data =
+        network_.FilterOracleInternal().LoadSerializedFilters(type, hashes, {});
 
-    for (const auto& hash : hashes) {
-        const auto& cfilter = data.emplace_back(
-            filters.LoadFilter(type, hash, data.get_allocator()));
-
-        if (false == cfilter.IsValid()) { break; }
-    }
-
-    if (data.size() != count) {
+    if ((data.size() != count) || (hashes.size() != count)) {
         LogError()(OT_PRETTY_CLASS())(
             "Failed to load all filters, requested (")(count)("), loaded (")(
             data.size())(")")
@@ -1100,13 +1103,11 @@ auto Peer::process_getcfilters(
         return;
     }
 
-    OT_ASSERT(data.size() == hashes.size());
-
     auto h{hashes.begin()};
 
     for (auto g{data.begin()}; g != data.end(); ++g, ++h) {
         auto pOut = std::unique_ptr<message::internal::Cfilter>{
-            factory::BitcoinP2PCfilter(api_, chain_, type, *h, *g)};
+            factory::BitcoinP2PCfilter(api_, chain_, type, *h, reader(*g))};
 
         if (false == bool(pOut)) {
             LogError()(OT_PRETTY_CLASS())("Failed to construct reply").Flush();
@@ -1171,9 +1172,19 @@ auto Peer::process_getdata(
                 }
             } break;
             case Type::MsgBlock: {
-                const auto& oracle = network_.BlockOracle();
+                const auto& oracle = network_.BlockOracle().Internal();
+                const auto hash = block::Hash{inv.hash_->Bytes()};
+
+                if (oracle.IsPruned(hash)) {
+                    // NOTE pruned blocks are not downloaded again on behalf of
+                    // peers
+                    notFound.emplace_back(inv);
+
+                    break;
+                }
+
                 auto future =
-                    oracle.LoadBitcoin(block::Hash{inv.hash_->Bytes()});
+                    oracle.LoadBitcoin(hash, node::BlockCacheConsumer::peer);
                 const auto have =
                     std::future_status::ready == future.wait_for(0ms);
 
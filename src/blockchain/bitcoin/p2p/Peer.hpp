@@ -172,6 +172,7 @@ private:
         const ProtocolVersion version,
         const blockchain::Type network,
         const database::BlockStorage policy,
+        const bool pruning,
         const UnallocatedSet<p2p::Service>& input) noexcept
         -> UnallocatedSet<p2p::Service>;
     static auto nonce(const api::Session& api) noexcept -> Nonce;
@@ -94,12 +94,10 @@ auto BitcoinP2PCfilter(
     const auto filterType = raw.Type(header.Network());
 
     try {
+        const auto serialized =
+            ReadView{reinterpret_cast<const char*>(it), filterSize};
         const auto [elementCount, filterBytes] =
-            blockchain::internal::DecodeSerializedCfilter(
-                ReadView{reinterpret_cast<const char*>(it), filterSize});
-        const auto* const start =
-            reinterpret_cast<const std::byte*>(filterBytes.data());
-        const auto* const end = start + filterBytes.size();
+            blockchain::internal::DecodeSerializedCfilter(serialized);
 
         return new ReturnType(
             api,
@@ -107,7 +105,8 @@ auto BitcoinP2PCfilter(
             filterType,
             raw.Hash(),
             elementCount,
-            Space{start, end});
+            serialized.size() - filterBytes.size(),
+            space(serialized));
     } catch (const std::exception& e) {
         LogError()("opentxs::factory::")(__func__)(": ")(e.what()).Flush();
 
@@ -125,10 +124,52 @@ auto BitcoinP2PCfilter(
 {
     namespace bitcoin = blockchain::p2p::bitcoin;
     using ReturnType = bitcoin::message::implementation::Cfilter;
-    Space bytes{};
-    filter.Compressed(writer(bytes));
+    auto bytes = Space{};
+
+    if (false == filter.Encode(writer(bytes))) {
+        LogError()("opentxs::factory::")(__func__)(": failed to encode gcs")
+            .Flush();
+
+        return nullptr;
+    }
+
+    const auto count = filter.ElementCount();
+    // NOTE GCS::Encode always produces a canonical CompactSize
+    const auto prefix =
+        network::blockchain::bitcoin::CompactSize(count).Size();
+
     return new ReturnType(
-        api, network, type, hash, filter.ElementCount(), bytes);
+        api, network, type, hash, count, prefix, std::move(bytes));
+}
+
+auto BitcoinP2PCfilter(
+    const api::Session& api,
+    const blockchain::Type network,
+    const blockchain::cfilter::Type type,
+    const blockchain::block::Hash& hash,
+    const ReadView serialized)
+    -> blockchain::p2p::bitcoin::message::internal::Cfilter*
+{
+    namespace bitcoin = blockchain::p2p::bitcoin;
+    using ReturnType = bitcoin::message::implementation::Cfilter;
+
+    try {
+        const auto [elementCount, filterBytes] =
+            blockchain::internal::DecodeSerializedCfilter(serialized);
+
+        return new ReturnType(
+            api,
+            network,
+            type,
+            hash,
+            elementCount,
+            serialized.size() - filterBytes.size(),
+            space(serialized));
+    } catch (const std::exception& e) {
+        LogError()("opentxs::factory::")(__func__)(": ")(e.what()).Flush();
+
+        return nullptr;
+    }
 }
 }  // namespace opentxs::factory
 
@@ -140,14 +181,18 @@ Cfilter::Cfilter(
     const cfilter::Type type,
     const block::Hash& hash,
     const std::uint32_t count,
-    const Space& compressed) noexcept
+    const std::size_t prefix,
+    Space&& serialized) noexcept
     : Message(api, network, bitcoin::Command::cfilter)
     , type_(type)
     , hash_(hash)
     , count_(count)
-    , filter_(compressed)
+    , serialized_(std::move(serialized))
+    , prefix_(prefix)
     , params_(blockchain::internal::GetFilterParams(type_))
 {
+    OT_ASSERT(prefix_ <= serialized_.size());
+
     init_hash();
 }
 
@@ -157,29 +202,32 @@ Cfilter::Cfilter(
     const cfilter::Type type,
     const block::Hash& hash,
     const std::uint32_t count,
-    Space&& compressed) noexcept
+    const std::size_t prefix,
+    Space&& serialized) noexcept
     : Message(api, std::move(header))
     , type_(type)
     , hash_(hash)
     , count_(count)
-    , filter_(std::move(compressed))
+    , serialized_(std::move(serialized))
+    , prefix_(prefix)
     , params_(blockchain::internal::GetFilterParams(type_))
 {
+    OT_ASSERT(prefix_ <= serialized_.size());
 }
 
-auto Cfilter::payload(AllocateOutput out) const noexcept -> bool
+auto Cfilter::Filter() const noexcept -> ReadView
 {
-    try {
-        auto filter = CompactSize(count_).Encode();
-        filter.insert(filter.end(), filter_.begin(), filter_.end());
+    const auto view = reader(serialized_);
 
-        auto payload = CompactSize(filter.size()).Encode();
-        payload.reserve(payload.size() + filter.size());
-        std::move(filter.begin(), filter.end(), std::back_inserter(payload));
+    return view.substr(prefix_);
+}
 
+auto Cfilter::payload(AllocateOutput out) const noexcept -> bool
+{
+    try {
         static constexpr auto fixed = sizeof(BitcoinFormat);
-        const auto bytes = fixed + payload.size();
-
+        const auto size = CompactSize(serialized_.size());
+        const auto bytes = fixed + size.Size() + serialized_.size();
         auto output = out(bytes);
 
         if (false == output.valid(bytes)) {
@@ -190,8 +238,13 @@ auto Cfilter::payload(AllocateOutput out) const noexcept -> bool
         auto* i = output.as<std::byte>();
         std::memcpy(i, static_cast<const void*>(&data), fixed);
         std::advance(i, fixed);
-        std::memcpy(i, payload.data(), payload.size());
-        std::advance(i, payload.size());
+
+        if (false == size.Encode(preallocated(size.Size(), i))) {
+            throw std::runtime_error{"failed to encode filter size"};
+        }
+
+        std::advance(i, size.Size());
+        std::memcpy(i, serialized_.data(), serialized_.size());
 
         return true;
     } catch (const std::exception& e) {
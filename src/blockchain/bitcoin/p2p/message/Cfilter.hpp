@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 
@@ -57,7 +58,7 @@ public:
     {
         return params_.second;
     }
-    auto Filter() const noexcept -> ReadView final { return reader(filter_); }
+    auto Filter() const noexcept -> ReadView final;
     auto Hash() const noexcept -> const block::Hash& final { return hash_; }
     auto Type() const noexcept -> cfilter::Type final { return type_; }
 
@@ -67,14 +68,16 @@ public:
         const cfilter::Type type,
         const block::Hash& hash,
         const std::uint32_t count,
-        const Space& compressed) noexcept;
+        const std::size_t prefix,
+        Space&& serialized) noexcept;
     Cfilter(
         const api::Session& api,
         std::unique_ptr<Header> header,
         const cfilter::Type type,
         const block::Hash& hash,
         const std::uint32_t count,
-        Space&& compressed) noexcept;
+        const std::size_t prefix,
+        Space&& serialized) noexcept;
     Cfilter(const Cfilter&) = delete;
     Cfilter(Cfilter&&) = delete;
     auto operator=(const Cfilter&) -> Cfilter& = delete;
@@ -86,7 +89,13 @@ private:
     const cfilter::Type type_;
     const block::Hash hash_;
     const std::uint32_t count_;
-    const Space filter_;
+    // NOTE BIP-158 serialization: the element count as a CompactSize followed
+    // by the compressed set
+    const Space serialized_;
+    // NOTE the number of bytes used to encode the element count, which is
+    // not necessarily the canonical CompactSize length if the filter was
+    // received from a peer
+    const std::size_t prefix_;
     const blockchain::internal::FilterParams params_;
 
     using implementation::Message::payload;
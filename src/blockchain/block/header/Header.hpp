@@ -86,6 +86,11 @@ public:
     {
         return {};
     }
+    auto SerializeLocal(internal::LocalRecord& out) const noexcept
+        -> bool override
+    {
+        return {};
+    }
     virtual auto Target() const noexcept -> OTNumericHash;
     virtual auto Type() const noexcept -> blockchain::Type { return {}; }
     virtual auto Valid() const noexcept -> bool { return {}; }
@@ -0,0 +1,92 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"    // IWYU pragma: associated
+#include "1_Internal.hpp"  // IWYU pragma: associated
+#include "internal/blockchain/block/HeaderRecord.hpp"  // IWYU pragma: associated
+
+#include <boost/endian/buffers.hpp>
+#include <cstring>
+#include <iterator>
+#include <optional>
+#include <stdexcept>
+
+#include "internal/blockchain/bitcoin/UInt256.hpp"
+#include "opentxs/core/Data.hpp"
+#include "opentxs/util/Bytes.hpp"
+#include "serialization/protobuf/BitcoinBlockHeaderFields.pb.h"
+#include "serialization/protobuf/BlockchainBlockHeader.pb.h"
+#include "serialization/protobuf/BlockchainBlockLocalData.pb.h"
+
+namespace opentxs::blockchain::block::internal
+{
+auto ConvertLegacy(const proto::BlockchainBlockHeader& in) noexcept(false)
+    -> HeaderRecord
+{
+    if (false == in.has_bitcoin()) {
+        throw std::runtime_error{"Unsupported header format"};
+    }
+
+    const auto& bitcoin = in.bitcoin();
+    const auto& previous = bitcoin.previous_header();
+    const auto& merkle = bitcoin.merkle_hash();
+    static constexpr auto hashSize = std::size_t{32};
+
+    if ((hashSize < previous.size()) || (hashSize < merkle.size())) {
+        throw std::runtime_error{"Invalid hash size"};
+    }
+
+    auto output = HeaderRecord{};
+    output.type_ = in.type();
+    auto* it = output.raw_.data();
+    const auto version = be::little_int32_buf_t{bitcoin.block_version()};
+    const auto time = be::little_uint32_buf_t{bitcoin.timestamp()};
+    const auto nbits = be::little_uint32_buf_t{bitcoin.nbits()};
+    const auto nonce = be::little_uint32_buf_t{bitcoin.nonce()};
+    std::memcpy(it, &version, sizeof(version));
+    std::advance(it, sizeof(version));
+    std::memcpy(it, previous.data(), previous.size());
+    std::advance(it, hashSize);
+    std::memcpy(it, merkle.data(), merkle.size());
+    std::advance(it, hashSize);
+    std::memcpy(it, &time, sizeof(time));
+    std::advance(it, sizeof(time));
+    std::memcpy(it, &nbits, sizeof(nbits));
+    std::advance(it, sizeof(nbits));
+    std::memcpy(it, &nonce, sizeof(nonce));
+
+    if (in.has_local()) { output.local_ = ConvertLegacy(in.local()); }
+
+    return output;
+}
+
+auto ConvertLegacy(const proto::BlockchainBlockLocalData& in) noexcept(false)
+    -> LocalRecord
+{
+    static const auto decode = [](const auto& hex, auto& out) {
+        const auto bytes = [&] {
+            auto data = Data::Factory();
+            data->DecodeHex(hex);
+
+            return data;
+        }();
+        const auto value = bitcoin::UInt256::FromBigEndian(bytes->Bytes());
+
+        if (false == value.has_value()) {
+            throw std::runtime_error{"Invalid work"};
+        }
+
+        out = value->BigEndian();
+    };
+    auto output = LocalRecord{};
+    output.height_ = in.height();
+    output.status_ = in.status();
+    output.inherit_status_ = in.inherit_status();
+    decode(in.work(), output.work_);
+    decode(in.inherit_work(), output.inherit_work_);
+
+    return output;
+}
+}  // namespace opentxs::blockchain::block::internal
@@ -12,7 +12,10 @@
 #include <type_traits>
 #include <utility>
 
+#include "blockchain/bitcoin/Work.hpp"
 #include "internal/blockchain/Blockchain.hpp"
+#include "internal/blockchain/bitcoin/UInt256.hpp"
+#include "internal/blockchain/block/HeaderRecord.hpp"
 #include "opentxs/blockchain/BlockchainType.hpp"
 #include "opentxs/blockchain/bitcoin/NumericHash.hpp"
 #include "opentxs/blockchain/bitcoin/Work.hpp"
@@ -186,6 +189,24 @@ auto Header::Serialize(SerializedType& output) const noexcept -> bool
     return true;
 }
 
+auto Header::SerializeLocal(internal::LocalRecord& out) const noexcept -> bool
+{
+    using WorkType = blockchain::implementation::Work;
+    const auto* work = dynamic_cast<const WorkType*>(&work_.get());
+    const auto* inherit = dynamic_cast<const WorkType*>(&inherit_work_.get());
+
+    if ((nullptr == work) || (nullptr == inherit)) { return false; }
+
+    out = internal::LocalRecord{};
+    out.height_ = height_;
+    out.status_ = static_cast<std::uint32_t>(status_);
+    out.inherit_status_ = static_cast<std::uint32_t>(inherit_status_);
+    out.work_ = work->Value().BigEndian();
+    out.inherit_work_ = inherit->Value().BigEndian();
+
+    return true;
+}
+
 auto Header::SetDisconnectedState() noexcept -> void
 {
     status_ = Status::Disconnected;
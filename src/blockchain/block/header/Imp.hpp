@@ -75,6 +75,8 @@ public:
     auto Position() const noexcept -> block::Position final;
     using block::Header::Imp::Serialize;
     auto Serialize(SerializedType& out) const noexcept -> bool override;
+    auto SerializeLocal(internal::LocalRecord& out) const noexcept
+        -> bool final;
     auto Type() const noexcept -> blockchain::Type final { return type_; }
     auto Valid() const noexcept -> bool final;
     auto Work() const noexcept -> OTWork final;
@@ -278,12 +278,25 @@ auto Deterministic::check_lookahead(
     Batch& generated,
     const PasswordPrompt& reason) const noexcept(false) -> void
 {
-    auto needed = need_lookahead(lock, type);
+    const auto needed = need_lookahead(lock, type);
 
-    while (0u < needed) {
-        generated.emplace_back(generate_next(lock, type, reason));
-        --needed;
+    if (0u == needed) { return; }
+
+    const auto first = generated_.at(type);
+    const auto available = (max_index_ > first) ? max_index_ - first : 0u;
+    auto keys =
+        private_keys(lock, type, first, std::min(needed, available), reason);
+
+    if (keys.empty() && (0u < available)) {
+        throw std::runtime_error("Failed to generate keys");
     }
+
+    for (auto& key : keys) {
+        generated.emplace_back(
+            generate(lock, type, generated_.at(type), std::move(key)));
+    }
+
+    if (needed > available) { throw std::runtime_error("Account is full"); }
 }
 
 auto Deterministic::confirm(
@@ -462,6 +475,17 @@ auto Deterministic::generate(
     const Subchain type,
     const Bip32Index desired,
     const PasswordPrompt& reason) const noexcept(false) -> Bip32Index
+{
+    if (max_index_ <= desired) { throw std::runtime_error("Account is full"); }
+
+    return generate(lock, type, desired, PrivateKey(type, desired, reason));
+}
+
+auto Deterministic::generate(
+    const rLock& lock,
+    const Subchain type,
+    const Bip32Index desired,
+    ECKey&& pKey) const noexcept(false) -> Bip32Index
 {
     auto& addressMap = data_.Get(type).map_;
     auto& index = generated_.at(type);
@@ -471,8 +495,6 @@ auto Deterministic::generate(
 
     if (max_index_ <= index) { throw std::runtime_error("Account is full"); }
 
-    auto pKey = PrivateKey(type, index, reason);
-
     if (false == bool(pKey)) {
         throw std::runtime_error("Failed to generate key");
     }
@@ -686,6 +708,25 @@ auto Deterministic::Reserve(
     return output;
 }
 
+auto Deterministic::private_keys(
+    const rLock&,
+    const Subchain type,
+    const Bip32Index first,
+    const Bip32Index count,
+    const PasswordPrompt& reason) const noexcept -> UnallocatedVector<ECKey>
+{
+    auto output = UnallocatedVector<ECKey>{};
+    output.reserve(count);
+
+    for (auto i = first; i < (first + count); ++i) {
+        auto& key = output.emplace_back(PrivateKey(type, i, reason));
+
+        if (false == bool(key)) { return {}; }
+    }
+
+    return output;
+}
+
 auto Deterministic::RootNode(const PasswordPrompt& reason) const noexcept
     -> blockchain::crypto::HDKey
 {
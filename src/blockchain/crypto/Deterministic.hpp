@@ -176,6 +176,14 @@ protected:
     }
     auto need_lookahead(const rLock& lock, const Subchain type) const noexcept
         -> Bip32Index;
+    // Returns an empty vector on failure
+    virtual auto private_keys(
+        const rLock& lock,
+        const Subchain type,
+        const Bip32Index first,
+        const Bip32Index count,
+        const PasswordPrompt& reason) const noexcept
+        -> UnallocatedVector<ECKey>;
     auto serialize_deterministic(const rLock& lock, SerializedType& out)
         const noexcept -> void;
     auto use_next(
@@ -275,6 +283,11 @@ private:
         const Subchain type,
         const Bip32Index index,
         const PasswordPrompt& reason) const noexcept(false) -> Bip32Index;
+    [[nodiscard]] auto generate(
+        const rLock& lock,
+        const Subchain type,
+        const Bip32Index index,
+        ECKey&& key) const noexcept(false) -> Bip32Index;
     [[nodiscard]] auto generate_next(
         const rLock& lock,
         const Subchain type,
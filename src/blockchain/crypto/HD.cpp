@@ -8,7 +8,11 @@
 #include "blockchain/crypto/HD.hpp"  // IWYU pragma: associated
 
 #include <robin_hood.h>
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
+#include <iterator>
 #include <memory>
 #include <sstream>
 #include <stdexcept>
@@ -21,8 +25,14 @@
 #include "blockchain/crypto/Element.hpp"
 #include "blockchain/crypto/Subaccount.hpp"
 #include "internal/api/crypto/Seed.hpp"
+#if OT_BLOCKCHAIN
+#include "internal/api/network/Asio.hpp"
+#include "internal/blockchain/Blockchain.hpp"
+#endif  // OT_BLOCKCHAIN
 #include "internal/blockchain/crypto/Factory.hpp"
+#include "internal/crypto/key/HD.hpp"
 #include "internal/util/LogMacros.hpp"
+#include "internal/util/P0330.hpp"
 #include "opentxs/api/crypto/Config.hpp"
 #include "opentxs/api/crypto/Seed.hpp"
 #include "opentxs/api/session/Crypto.hpp"
@@ -41,6 +51,7 @@
 #include "opentxs/crypto/Bip32.hpp"
 #include "opentxs/crypto/Bip32Child.hpp"
 #include "opentxs/crypto/Bip43Purpose.hpp"
+#include "opentxs/crypto/key/HD.hpp"
 #include "opentxs/identity/wot/claim/Types.hpp"
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/Log.hpp"
@@ -228,10 +239,8 @@ auto HD::Name() const noexcept -> UnallocatedCString
     return name_.value();
 }
 
-auto HD::PrivateKey(
-    const Subchain type,
-    const Bip32Index index,
-    const PasswordPrompt& reason) const noexcept -> ECKey
+auto HD::account_key(const Subchain type, const PasswordPrompt& reason)
+    const noexcept -> const opentxs::crypto::key::HD*
 {
     switch (type) {
         case internal_type_:
@@ -247,11 +256,11 @@ auto HD::PrivateKey(
                 print(external_type_))(" are valid for this account.")
                 .Flush();
 
-            return {};
+            return nullptr;
         }
     }
 
-    if (false == api::crypto::HaveHDKeys()) { return {}; }
+    if (false == api::crypto::HaveHDKeys()) { return nullptr; }
 
     const auto change =
         (internal_type_ == type) ? INTERNAL_CHAIN : EXTERNAL_CHAIN;
@@ -266,15 +275,68 @@ auto HD::PrivateKey(
             LogError()(OT_PRETTY_CLASS())("Failed to derive account key")
                 .Flush();
 
-            return {};
+            return nullptr;
         }
     }
 
     OT_ASSERT(pKey);
 
-    const auto& key = *pKey;
+    return pKey.get();
+}
+
+auto HD::PrivateKey(
+    const Subchain type,
+    const Bip32Index index,
+    const PasswordPrompt& reason) const noexcept -> ECKey
+{
+    const auto* key = account_key(type, reason);
+
+    if (nullptr == key) { return {}; }
+
+    return key->ChildKey(index, reason);
+}
+
+auto HD::private_keys(
+    const rLock& lock,
+    const Subchain type,
+    const Bip32Index first,
+    const Bip32Index count,
+    const PasswordPrompt& reason) const noexcept -> UnallocatedVector<ECKey>
+{
+    const auto* key = dynamic_cast<const opentxs::crypto::key::internal::HD*>(
+        account_key(type, reason));
+
+    if (nullptr == key) {
+
+        return Deterministic::private_keys(lock, type, first, count, reason);
+    }
+
+    auto output = UnallocatedVector<ECKey>(count);
+    auto failed = std::atomic<bool>{false};
+    const auto job = [&](const std::size_t begin, const std::size_t end) {
+        auto keys = key->ChildKeys(
+            first + static_cast<Bip32Index>(begin), end - begin, reason);
+
+        if (keys.size() != (end - begin)) {
+            failed.store(true);
+
+            return;
+        }
+
+        std::move(keys.begin(), keys.end(), std::next(output.begin(), begin));
+    };
+#if OT_BLOCKCHAIN
+    // NOTE the children of an account key do not depend on each other so the
+    // lookahead window is refilled in parallel
+    blockchain::internal::ForEachParallel(
+        api_, ThreadPool::General, count, job, derive_chunk_);
+#else
+    job(0_uz, count);
+#endif  // OT_BLOCKCHAIN
+
+    if (failed.load()) { return {}; }
 
-    return key.ChildKey(index, reason);
+    return output;
 }
 
 auto HD::save(const rLock& lock) const noexcept -> bool
@@ -6,6 +6,7 @@
 #pragma once
 
 #include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <optional>
@@ -109,6 +110,7 @@ private:
     static constexpr auto external_type_{Subchain::External};
     static constexpr VersionNumber DefaultVersion{1};
     static constexpr auto proto_hd_version_ = VersionNumber{1};
+    static constexpr auto derive_chunk_ = std::size_t{4};
 
     const HDProtocol standard_;
     VersionNumber version_;
@@ -117,6 +119,15 @@ private:
     mutable std::optional<UnallocatedCString> name_;
 
     auto account_already_exists(const rLock& lock) const noexcept -> bool final;
+    auto account_key(const Subchain type, const PasswordPrompt& reason)
+        const noexcept -> const opentxs::crypto::key::HD*;
+    auto private_keys(
+        const rLock& lock,
+        const Subchain type,
+        const Bip32Index first,
+        const Bip32Index count,
+        const PasswordPrompt& reason) const noexcept
+        -> UnallocatedVector<ECKey> final;
     auto save(const rLock& lock) const noexcept -> bool final;
 };
 }  // namespace opentxs::blockchain::crypto::implementation
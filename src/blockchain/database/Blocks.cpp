@@ -7,7 +7,9 @@
 #include "1_Internal.hpp"                  // IWYU pragma: associated
 #include "blockchain/database/Blocks.hpp"  // IWYU pragma: associated
 
+#include <algorithm>
 #include <cstddef>
+#include <cstring>
 #include <memory>
 
 #include "blockchain/database/common/Database.hpp"
@@ -52,6 +54,13 @@ Blocks::Blocks(
     }
 }
 
+auto Blocks::Forget(const block::Hash& block) const noexcept -> bool
+{
+    if (block == genesis_) { return false; }
+
+    return common_.BlockForget(block);
+}
+
 auto Blocks::LoadBitcoin(const block::Hash& block) const noexcept
     -> std::shared_ptr<const bitcoin::block::Block>
 {
@@ -81,6 +90,30 @@ auto Blocks::LoadBitcoin(const block::Hash& block) const noexcept
     }
 }
 
+auto Blocks::PruneHeight() const noexcept -> block::Height
+{
+    auto output = std::size_t{0};
+    lmdb_.Load(
+        Table::Config,
+        tsv(static_cast<std::size_t>(Key::BlockPruneHeight)),
+        [&](const auto in) -> void {
+            std::memcpy(
+                &output, in.data(), std::min(in.size(), sizeof(output)));
+        });
+
+    return static_cast<block::Height>(output);
+}
+
+auto Blocks::SetPruneHeight(const block::Height height) const noexcept -> bool
+{
+    return lmdb_
+        .Store(
+            Table::Config,
+            tsv(static_cast<std::size_t>(Key::BlockPruneHeight)),
+            tsv(static_cast<std::size_t>(std::max<block::Height>(height, 0))))
+        .first;
+}
+
 auto Blocks::SetTip(const block::Position& position) const noexcept -> bool
 {
     return lmdb_
@@ -91,6 +124,11 @@ auto Blocks::SetTip(const block::Position& position) const noexcept -> bool
         .first;
 }
 
+auto Blocks::Size(const block::Hash& block) const noexcept -> std::size_t
+{
+    return common_.BlockSize(block);
+}
+
 auto Blocks::Store(const block::Block& block) const noexcept -> bool
 {
     const auto size = block.Internal().CalculateSize();
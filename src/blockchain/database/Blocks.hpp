@@ -7,6 +7,7 @@
 
 #include <boost/container/flat_set.hpp>
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <iosfwd>
 #include <memory>
@@ -87,9 +88,15 @@ namespace opentxs::blockchain::database
 class Blocks
 {
 public:
+    /// Remove a block from storage. The genesis block can not be forgotten.
+    auto Forget(const block::Hash& block) const noexcept -> bool;
     auto LoadBitcoin(const block::Hash& block) const noexcept
         -> std::shared_ptr<const bitcoin::block::Block>;
+    /// Height of the highest block which has been removed by pruning
+    auto PruneHeight() const noexcept -> block::Height;
+    auto SetPruneHeight(const block::Height height) const noexcept -> bool;
     auto SetTip(const block::Position& position) const noexcept -> bool;
+    auto Size(const block::Hash& block) const noexcept -> std::size_t;
     auto Store(const block::Block& block) const noexcept -> bool;
     auto Tip() const noexcept -> block::Position;
 
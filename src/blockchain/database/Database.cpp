@@ -11,12 +11,21 @@ extern "C" {
 #include <lmdb.h>
 }
 
+#include <algorithm>
+#include <exception>
 #include <memory>
+#include <mutex>
+#include <optional>
 
+#include "internal/blockchain/block/Block.hpp"
 #include "internal/blockchain/database/Factory.hpp"
 #include "internal/util/LogMacros.hpp"
+#include "internal/util/P0330.hpp"
 #include "internal/util/TSV.hpp"
+#include "opentxs/blockchain/Types.hpp"
+#include "opentxs/blockchain/block/Header.hpp"
 #include "opentxs/util/Container.hpp"
+#include "opentxs/util/Log.hpp"
 #include "util/LMDB.hpp"
 
 namespace opentxs::factory
@@ -75,6 +84,7 @@ Database::Database(
     const blockchain::cfilter::Type filter) noexcept
     : api_(api)
     , chain_(chain)
+    , filter_type_(filter)
     , common_(common)
     , lmdb_([&] {
         auto lmdb = storage::lmdb::LMDB{
@@ -122,6 +132,105 @@ Database::Database(
 {
 }
 
+auto Database::BlockPrune(
+    const std::size_t depth,
+    const std::size_t bytes,
+    const std::size_t limit) noexcept -> std::size_t
+{
+    using database::BlockStorage;
+
+    if (BlockStorage::None == common_.BlockPolicy()) { return 0_uz; }
+    if ((0_uz == depth) && (0_uz == bytes)) { return 0_uz; }
+
+    const auto tip = headers_.CurrentBest()->Height();
+    // NOTE blocks which still need to be read by the filter indexer or by a
+    // wallet subchain must be retained
+    const auto ceiling = database::PruneIndex::Ceiling(
+        tip,
+        filters_.CurrentTip(filter_type_).height_,
+        wallet_.SubchainOldestScanned());
+    auto lock = Lock{prune_lock_};
+    auto cursor = blocks_.PruneHeight();
+
+    if (cursor > ceiling) {
+        // NOTE a reorg has occurred below the previously pruned height so the
+        // blocks of the new best chain must be considered again
+        cursor = ceiling;
+        blocks_.SetPruneHeight(cursor);
+        prune_index_.clear();
+    }
+
+    if (0_uz < bytes) {
+        try {
+            update_prune_index(lock, cursor, tip);
+        } catch (const std::exception& e) {
+            LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+            prune_index_.clear();
+
+            return 0_uz;
+        }
+    } else {
+        prune_index_.clear();
+    }
+
+    const auto target = prune_index_.Target(tip, ceiling, depth, bytes);
+    auto count = 0_uz;
+    auto height = cursor;
+
+    while ((height < target) && (count < limit)) {
+        const auto next = height + 1;
+
+        try {
+            if (false == blocks_.Forget(headers_.BestBlock(next))) {
+                LogError()(OT_PRETTY_CLASS())(
+                    "failed to prune block at height ")(next)
+                    .Flush();
+
+                break;
+            }
+        } catch (...) {
+            break;
+        }
+
+        height = next;
+        ++count;
+    }
+
+    if (0_uz < count) {
+        blocks_.SetPruneHeight(height);
+        prune_index_.Forget(height);
+        LogDetail()(OT_PRETTY_CLASS())("pruned ")(count)(" ")(print(chain_))(
+            " blocks up to height ")(height)
+            .Flush();
+    }
+
+    return count;
+}
+
+auto Database::BlockPruned(const block::Hash& block) const noexcept -> bool
+{
+    const auto pruned = blocks_.PruneHeight();
+
+    if (0 >= pruned) { return false; }
+
+    const auto header = headers_.TryLoadHeader(block);
+
+    if (false == bool(header)) { return false; }
+    if (header->Height() > pruned) { return false; }
+
+    return false == common_.BlockExists(block);
+}
+
+auto Database::BlockStore(const block::Block& block) noexcept -> bool
+{
+    if (false == blocks_.Store(block)) { return false; }
+
+    auto lock = Lock{prune_lock_};
+    prune_index_.Resize(block.ID(), block.Internal().CalculateSize());
+
+    return true;
+}
+
 auto Database::init_db(storage::lmdb::LMDB& db) noexcept -> void
 {
     if (!db.Exists(database::Config, tsv(database::Key::Version))) {
@@ -131,4 +240,32 @@ auto Database::init_db(storage::lmdb::LMDB& db) noexcept -> void
         OT_ASSERT(stored.first);
     }
 }
+
+auto Database::update_prune_index(
+    const Lock&,
+    const block::Height cursor,
+    const block::Height tip) noexcept(false) -> void
+{
+    auto& index = prune_index_;
+    index.Forget(cursor);
+
+    // NOTE discard recorded blocks which are no longer in the best chain
+    for (auto last = index.Last(); last.has_value(); last = index.Last()) {
+        const auto height = last->height_;
+
+        if ((height <= tip) && (headers_.BestBlock(height) == last->hash_)) {
+            break;
+        }
+
+        index.Rewind(height - 1);
+    }
+
+    for (auto height = index.Next().value_or(cursor + 1); height <= tip;
+         ++height) {
+        const auto hash = headers_.BestBlock(height);
+        const auto added = index.Add(height, hash, blocks_.Size(hash));
+
+        OT_ASSERT(added);
+    }
+}
 }  // namespace opentxs::blockchain::implementation
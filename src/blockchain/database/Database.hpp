@@ -22,6 +22,7 @@
 #include "blockchain/database/Blocks.hpp"
 #include "blockchain/database/Filters.hpp"
 #include "blockchain/database/Headers.hpp"
+#include "blockchain/database/PruneIndex.hpp"
 #include "blockchain/database/Sync.hpp"
 #include "blockchain/database/Wallet.hpp"
 #include "blockchain/database/common/Database.hpp"
@@ -195,6 +196,11 @@ public:
     {
         return headers_.BestBlock(position);
     }
+    auto BestChain(alloc::Resource* alloc) const noexcept
+        -> Vector<block::Hash> final
+    {
+        return headers_.BestChain(alloc);
+    }
     auto BlockExists(const block::Hash& block) const noexcept -> bool final
     {
         return common_.BlockExists(block);
@@ -208,14 +214,20 @@ public:
     {
         return common_.BlockPolicy();
     }
-    auto BlockStore(const block::Block& block) noexcept -> bool final
-    {
-        return blocks_.Store(block);
-    }
+    auto BlockPrune(
+        const std::size_t depth,
+        const std::size_t bytes,
+        const std::size_t limit) noexcept -> std::size_t final;
+    auto BlockPruned(const block::Hash& block) const noexcept -> bool final;
+    auto BlockStore(const block::Block& block) noexcept -> bool final;
     auto BlockTip() const noexcept -> block::Position final
     {
         return blocks_.Tip();
     }
+    auto CompactStorage(const std::size_t limit) noexcept -> std::size_t final
+    {
+        return common_.Compact(limit);
+    }
     auto CompletedProposals() const noexcept
         -> UnallocatedSet<OTIdentifier> final
     {
@@ -388,6 +400,12 @@ public:
     {
         return common_.Import(std::move(peers));
     }
+    auto ImportHeaders(
+        const UnallocatedVector<std::unique_ptr<block::Header>>& headers)
+        noexcept -> bool final
+    {
+        return headers_.ImportHeaders(headers);
+    }
     auto IsSibling(const block::Hash& hash) const noexcept -> bool final
     {
         return headers_.IsSibling(hash);
@@ -416,6 +434,14 @@ public:
     {
         return filters_.LoadFilterHeader(type, block);
     }
+    auto LoadSerializedFilters(
+        const cfilter::Type type,
+        const Vector<block::Hash>& blocks,
+        alloc::Default alloc) const noexcept
+        -> Vector<Vector<std::byte>> final
+    {
+        return filters_.LoadSerializedFilters(type, blocks, alloc);
+    }
     // Throws std::out_of_range if the header does not exist
     auto LoadHeader(const block::Hash& hash) const noexcept(false)
         -> std::unique_ptr<block::Header> final
@@ -474,6 +500,16 @@ public:
     {
         return wallet_.ReserveUTXO(spender, proposal, policy);
     }
+    auto ReserveUTXOs(
+        const identifier::Nym& spender,
+        const Identifier& proposal,
+        const Amount& target,
+        const Amount& feeRate,
+        node::internal::SpendPolicy& policy) noexcept
+        -> UnallocatedVector<UTXO> final
+    {
+        return wallet_.ReserveUTXOs(spender, proposal, target, feeRate, policy);
+    }
     auto SetBlockTip(const block::Position& position) noexcept -> bool final
     {
         return blocks_.SetTip(position);
@@ -586,6 +622,7 @@ private:
 
     const api::Session& api_;
     const blockchain::Type chain_;
+    const cfilter::Type filter_type_;
     const database::common::Database& common_;
     storage::lmdb::LMDB lmdb_;
     mutable database::Blocks blocks_;
@@ -593,7 +630,14 @@ private:
     mutable database::Headers headers_;
     mutable database::implemenation::Wallet wallet_;
     mutable database::implementation::Sync sync_;
+    mutable std::mutex prune_lock_;
+    database::PruneIndex prune_index_;
 
     static auto init_db(storage::lmdb::LMDB& db) noexcept -> void;
+
+    auto update_prune_index(
+        const Lock& lock,
+        const block::Height cursor,
+        const block::Height tip) noexcept(false) -> void;
 };
 }  // namespace opentxs::blockchain::implementation
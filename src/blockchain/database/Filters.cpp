@@ -187,6 +187,14 @@ auto Filters::LoadFilterHeader(const cfilter::Type type, const ReadView block)
     return {};
 }
 
+auto Filters::LoadSerializedFilters(
+    const cfilter::Type type,
+    const Vector<block::Hash>& blocks,
+    alloc::Default alloc) const noexcept -> Vector<Vector<std::byte>>
+{
+    return common_.LoadSerializedFilters(type, blocks, alloc);
+}
+
 auto Filters::SetHeaderTip(
     const cfilter::Type type,
     const block::Position& position) const noexcept -> bool
@@ -7,6 +7,7 @@
 
 #include <boost/container/flat_set.hpp>
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <iosfwd>
 #include <memory>
@@ -102,6 +103,10 @@ public:
         const noexcept -> cfilter::Hash;
     auto LoadFilterHeader(const cfilter::Type type, const ReadView block)
         const noexcept -> cfilter::Header;
+    auto LoadSerializedFilters(
+        const cfilter::Type type,
+        const Vector<block::Hash>& blocks,
+        alloc::Default alloc) const noexcept -> Vector<Vector<std::byte>>;
     auto SetHeaderTip(const cfilter::Type type, const block::Position& position)
         const noexcept -> bool;
     auto SetTip(const cfilter::Type type, const block::Position& position)
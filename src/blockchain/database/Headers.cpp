@@ -18,16 +18,16 @@
 #include "Proto.tpp"
 #include "blockchain/database/common/Database.hpp"
 #include "blockchain/node/UpdateTransaction.hpp"
-#include "internal/api/session/FactoryAPI.hpp"
 #include "internal/blockchain/bitcoin/block/Factory.hpp"
 #include "internal/blockchain/bitcoin/block/Header.hpp"  // IWYU pragma: keep
 #include "internal/blockchain/block/Factory.hpp"
 #include "internal/blockchain/block/Header.hpp"
+#include "internal/blockchain/block/HeaderRecord.hpp"
 #include "internal/blockchain/database/Types.hpp"
 #include "internal/blockchain/node/Manager.hpp"
 #include "internal/util/LogMacros.hpp"
+#include "internal/util/P0330.hpp"
 #include "internal/util/TSV.hpp"
-#include "opentxs/api/session/Factory.hpp"
 #include "opentxs/api/session/Session.hpp"
 #include "opentxs/blockchain/Types.hpp"
 #include "opentxs/blockchain/bitcoin/block/Header.hpp"
@@ -37,9 +37,9 @@
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/Log.hpp"
 #include "opentxs/util/WorkType.hpp"
-#include "serialization/protobuf/BlockchainBlockHeader.pb.h"
 #include "serialization/protobuf/BlockchainBlockLocalData.pb.h"
 #include "util/LMDB.hpp"
+#include "util/ScopeGuard.hpp"
 #include "util/Work.hpp"
 #include "util/threadutil.hpp"
 
@@ -157,14 +157,16 @@ auto Headers::ApplyUpdate(const node::UpdateTransaction& update) noexcept
 
     for (const auto& data : update.UpdatedHeaders()) {
         const auto& [hash, pair] = data;
-        block::internal::Header::SerializedType serializedType{};
-        data.second.first->Internal().Serialize(serializedType);
+        auto local = block::internal::LocalRecord{};
+
+        if (false == pair.first->Internal().SerializeLocal(local)) {
+            LogError()(OT_PRETTY_CLASS())("Failed to serialize block metadata")
+                .Flush();
+            return false;
+        }
 
         const auto result = lmdb_.Store(
-            BlockHeaderMetadata,
-            hash.Bytes(),
-            proto::ToString(serializedType.local()),
-            parentTxn);
+            BlockHeaderMetadata, hash.Bytes(), local.Bytes(), parentTxn);
 
         if (false == result.first) {
             LogError()(OT_PRETTY_CLASS())("Failed to save block metadata")
@@ -269,6 +271,37 @@ auto Headers::BestBlock(const block::Height position) const noexcept(false)
     return output;
 }
 
+auto Headers::BestChain(alloc::Resource* alloc) const noexcept
+    -> Vector<block::Hash>
+{
+    Lock lock(lock_);
+    const auto tip = best(lock).height_;
+    auto output = Vector<block::Hash>{alloc};
+    output.reserve(static_cast<std::size_t>(std::max<block::Height>(tip, 0)));
+    lmdb_.Read(
+        BlockHeaderBest,
+        [&](const auto key, const auto value) -> bool {
+            auto height = std::size_t{};
+
+            if (sizeof(height) != key.size()) { return false; }
+
+            std::memcpy(&height, key.data(), key.size());
+
+            if ((output.size() != height) ||
+                (static_cast<block::Height>(height) > tip)) {
+
+                return false;
+            }
+
+            output.emplace_back(value);
+
+            return true;
+        },
+        storage::lmdb::LMDB::Dir::Forward);
+
+    return output;
+}
+
 auto Headers::best() const noexcept -> block::Position
 {
     Lock lock(lock_);
@@ -400,20 +433,20 @@ auto Headers::import_genesis(const blockchain::Type type) const noexcept -> void
     const auto& hash = node::HeaderOracle::GenesisBlockHash(type);
 
     try {
-        const auto serialized = common_.LoadBlockHeader(hash);
+        auto record = common_.LoadBlockHeader(hash);
 
         if (false == lmdb_.Exists(BlockHeaderMetadata, hash.Bytes())) {
-            auto genesis =
-                api_.Factory().InternalSession().BlockHeader(serialized);
+            auto genesis = factory::BitcoinBlockHeader(api_, record);
 
             OT_ASSERT(genesis);
-            block::internal::Header::SerializedType proto{};
-            genesis->Internal().Serialize(proto);
 
-            const auto result = lmdb_.Store(
-                BlockHeaderMetadata,
-                hash.Bytes(),
-                std::move(proto::ToString(proto.local())));
+            auto local = block::internal::LocalRecord{};
+            success = genesis->Internal().SerializeLocal(local);
+
+            OT_ASSERT(success);
+
+            const auto result =
+                lmdb_.Store(BlockHeaderMetadata, hash.Bytes(), local.Bytes());
 
             OT_ASSERT(result.first);
         }
@@ -427,15 +460,14 @@ auto Headers::import_genesis(const blockchain::Type type) const noexcept -> void
         success = common_.StoreBlockHeader(*genesis);
 
         OT_ASSERT(success);
-        block::internal::Header::SerializedType proto{};
-        genesis->Internal().Serialize(proto);
 
-        success = lmdb_
-                      .Store(
-                          BlockHeaderMetadata,
-                          hash.Bytes(),
-                          proto::ToString(proto.local()))
-                      .first;
+        auto local = block::internal::LocalRecord{};
+        success = genesis->Internal().SerializeLocal(local);
+
+        OT_ASSERT(success);
+
+        success =
+            lmdb_.Store(BlockHeaderMetadata, hash.Bytes(), local.Bytes()).first;
 
         OT_ASSERT(success);
     }
@@ -461,6 +493,116 @@ auto Headers::import_genesis(const blockchain::Type type) const noexcept -> void
     OT_ASSERT(0 <= best().height_);
 }
 
+auto Headers::ImportHeaders(
+    const UnallocatedVector<std::unique_ptr<block::Header>>& headers) noexcept
+    -> bool
+{
+    // NOTE header records live in the common database, which is a separate
+    // LMDB environment from the metadata and best chain entries, so the two
+    // can not be written in one transaction. The records are written first and
+    // a header only becomes visible once its metadata is committed (see
+    // header_exists), so a failure in between leaves unreferenced records
+    // which are overwritten in place if the same headers are stored again.
+    //
+    // Each batch of metadata and best chain entries is written in a single
+    // transaction and the tip height is only advanced once the batch is
+    // committed, so a failure leaves the previous batches as a valid best
+    // chain.
+    static constexpr auto batch = 25000_uz;
+
+    if (headers.empty()) { return true; }
+
+    Lock lock(lock_);
+    const auto initial = best(lock);
+    auto tip = initial;
+    auto committed = initial;
+    auto notify = ScopeGuard{[&] {
+        if (committed == initial) { return; }
+
+        const auto bytes = committed.hash_.Bytes();
+        auto work = MakeWork(WorkType::BlockchainNewHeader);
+        work.AddFrame(network_.Chain());
+        work.AddFrame(bytes.data(), bytes.size());
+        work.AddFrame(committed.height_);
+        MessageMarker().mark(work);
+        network_.Reorg().Send(std::move(work));
+        network_.UpdateLocalHeight(committed);
+    }};
+
+    for (auto first = 0_uz; first < headers.size(); first += batch) {
+        const auto last = std::min(first + batch, headers.size());
+        auto bulk = UnallocatedVector<const block::Header*>{};
+        bulk.reserve(last - first);
+
+        for (auto i = first; i < last; ++i) {
+            const auto& header = *headers[i];
+
+            if ((header.Height() != tip.height_ + 1) ||
+                (header.ParentHash() != tip.hash_)) {
+                LogError()(OT_PRETTY_CLASS())(
+                    "Header does not extend the best chain")
+                    .Flush();
+
+                return false;
+            }
+
+            bulk.emplace_back(&header);
+            tip = header.Position();
+        }
+
+        if (false == common_.StoreBlockHeaders(bulk)) {
+            LogError()(OT_PRETTY_CLASS())("Failed to save block headers")
+                .Flush();
+
+            return false;
+        }
+
+        auto tx = lmdb_.TransactionRW();
+
+        for (const auto* header : bulk) {
+            const auto& hash = header->Hash();
+            auto local = block::internal::LocalRecord{};
+
+            if (false == header->Internal().SerializeLocal(local)) {
+                LogError()(OT_PRETTY_CLASS())(
+                    "Failed to serialize block metadata")
+                    .Flush();
+
+                return false;
+            }
+
+            const auto stored = lmdb_.Store(
+                BlockHeaderMetadata, hash.Bytes(), local.Bytes(), tx);
+
+            if (false == stored.first) {
+                LogError()(OT_PRETTY_CLASS())("Failed to save block metadata")
+                    .Flush();
+
+                return false;
+            }
+
+            const auto isTip = (header == bulk.back());
+
+            if (false == push_best(header->Position(), isTip, tx)) {
+                LogError()(OT_PRETTY_CLASS())("Failed to store best hash")
+                    .Flush();
+
+                return false;
+            }
+        }
+
+        if (false == tx.Finalize(true)) {
+            LogError()(OT_PRETTY_CLASS())("Database error").Flush();
+
+            return false;
+        }
+
+        committed = tip;
+    }
+
+    return true;
+}
+
 auto Headers::IsSibling(const block::Hash& hash) const noexcept -> bool
 {
     Lock lock(lock_);
@@ -471,19 +613,24 @@ auto Headers::IsSibling(const block::Hash& hash) const noexcept -> bool
 auto Headers::load_bitcoin_header(const block::Hash& hash) const
     -> std::unique_ptr<bitcoin::block::Header>
 {
-    auto proto = common_.LoadBlockHeader(hash);
+    using Local = block::internal::LocalRecord;
+    auto record = common_.LoadBlockHeader(hash);
     const auto haveMeta =
         lmdb_.Load(BlockHeaderMetadata, hash.Bytes(), [&](const auto data) {
-            *proto.mutable_local() =
-                proto::Factory<proto::BlockchainBlockLocalData>(
-                    data.data(), data.size());
+            if (Local::Check(data)) {
+                record.local_ = Local::Read(data);
+            } else {
+                record.local_ = block::internal::ConvertLegacy(
+                    proto::Factory<proto::BlockchainBlockLocalData>(
+                        data.data(), data.size()));
+            }
         });
 
     if (false == haveMeta) {
         throw std::out_of_range("Block header metadata not found");
     }
 
-    auto output = factory::BitcoinBlockHeader(api_, proto);
+    auto output = factory::BitcoinBlockHeader(api_, record);
 
     if (false == bool(output)) {
         throw std::out_of_range("Wrong header format");
@@ -495,23 +642,7 @@ auto Headers::load_bitcoin_header(const block::Hash& hash) const
 auto Headers::load_header(const block::Hash& hash) const
     -> std::unique_ptr<block::Header>
 {
-    auto proto = common_.LoadBlockHeader(hash);
-    const auto haveMeta =
-        lmdb_.Load(BlockHeaderMetadata, hash.Bytes(), [&](const auto data) {
-            *proto.mutable_local() =
-                proto::Factory<proto::BlockchainBlockLocalData>(
-                    data.data(), data.size());
-        });
-
-    if (false == haveMeta) {
-        throw std::out_of_range("Block header metadata not found");
-    }
-
-    auto output = api_.Factory().InternalSession().BlockHeader(proto);
-
-    OT_ASSERT(output);
-
-    return output;
+    return load_bitcoin_header(hash);
 }
 
 auto Headers::pop_best(const std::size_t i, MDB_txn* parent) const noexcept
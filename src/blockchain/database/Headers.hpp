@@ -89,6 +89,8 @@ struct Headers {
 public:
     auto BestBlock(const block::Height position) const noexcept(false)
         -> block::Hash;
+    auto BestChain(alloc::Resource* alloc) const noexcept
+        -> Vector<block::Hash>;
     auto CurrentBest() const noexcept -> std::unique_ptr<block::Header>
     {
         return load_header(best().hash_);
@@ -118,6 +120,9 @@ public:
         -> std::unique_ptr<block::Header>;
 
     auto ApplyUpdate(const node::UpdateTransaction& update) noexcept -> bool;
+    auto ImportHeaders(
+        const UnallocatedVector<std::unique_ptr<block::Header>>& headers)
+        noexcept -> bool;
 
     Headers(
         const api::Session& api,
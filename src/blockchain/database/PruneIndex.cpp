@@ -0,0 +1,153 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"                        // IWYU pragma: associated
+#include "1_Internal.hpp"                      // IWYU pragma: associated
+#include "blockchain/database/PruneIndex.hpp"  // IWYU pragma: associated
+
+#include <algorithm>
+
+#include "internal/util/LogMacros.hpp"
+#include "internal/util/P0330.hpp"
+
+namespace opentxs::blockchain::database
+{
+PruneIndex::PruneIndex() noexcept
+    : blocks_()
+    , index_()
+    , bytes_(0_uz)
+{
+}
+
+auto PruneIndex::Add(
+    const block::Height height,
+    const block::Hash& hash,
+    const std::size_t size) noexcept -> bool
+{
+    const auto next = Next();
+
+    if (next.has_value() && (next.value() != height)) { return false; }
+
+    blocks_.push_back(Entry{height, hash, size});
+    index_[hash] = height;
+    bytes_ += size;
+
+    return true;
+}
+
+auto PruneIndex::Ceiling(
+    const block::Height tip,
+    const block::Height filters,
+    const std::optional<block::Height>& scanned) noexcept -> block::Height
+{
+    auto output = std::min(tip, filters);
+
+    if (scanned.has_value()) { output = std::min(output, scanned.value()); }
+
+    return std::max<block::Height>(output, 0);
+}
+
+auto PruneIndex::clear() noexcept -> void
+{
+    blocks_.clear();
+    index_.clear();
+    bytes_ = 0_uz;
+}
+
+auto PruneIndex::Forget(const block::Height height) noexcept -> void
+{
+    while ((false == blocks_.empty()) && (blocks_.front().height_ <= height)) {
+        pop_front();
+    }
+}
+
+auto PruneIndex::Last() const noexcept -> std::optional<block::Position>
+{
+    if (blocks_.empty()) { return std::nullopt; }
+
+    const auto& last = blocks_.back();
+
+    return block::Position{last.height_, last.hash_};
+}
+
+auto PruneIndex::Next() const noexcept -> std::optional<block::Height>
+{
+    if (blocks_.empty()) { return std::nullopt; }
+
+    return blocks_.back().height_ + 1;
+}
+
+auto PruneIndex::pop_back() noexcept -> void
+{
+    const auto& last = blocks_.back();
+    bytes_ -= last.size_;
+    index_.erase(last.hash_);
+    blocks_.pop_back();
+}
+
+auto PruneIndex::pop_front() noexcept -> void
+{
+    const auto& first = blocks_.front();
+    bytes_ -= first.size_;
+    index_.erase(first.hash_);
+    blocks_.pop_front();
+}
+
+auto PruneIndex::Resize(
+    const block::Hash& hash,
+    const std::size_t size) noexcept -> void
+{
+    const auto i = index_.find(hash);
+
+    if (index_.end() == i) { return; }
+
+    // NOTE recorded heights are contiguous
+    const auto offset = i->second - blocks_.front().height_;
+    auto& entry = blocks_[static_cast<std::size_t>(offset)];
+
+    OT_ASSERT(entry.hash_ == hash);
+
+    bytes_ -= entry.size_;
+    entry.size_ = size;
+    bytes_ += entry.size_;
+}
+
+auto PruneIndex::Rewind(const block::Height height) noexcept -> void
+{
+    while ((false == blocks_.empty()) && (blocks_.back().height_ > height)) {
+        pop_back();
+    }
+}
+
+auto PruneIndex::Target(
+    const block::Height tip,
+    const block::Height ceiling,
+    const std::size_t depth,
+    const std::size_t bytes) const noexcept -> block::Height
+{
+    auto output = block::Height{0};
+
+    if (0_uz < depth) {
+        output = std::max(output, tip - static_cast<block::Height>(depth));
+    }
+
+    if (0_uz < bytes) {
+        // NOTE remove the oldest blocks until the remainder fits in the limit
+        auto remaining = bytes_;
+
+        for (const auto& entry : blocks_) {
+            if (remaining <= bytes) { break; }
+
+            remaining -= entry.size_;
+            output = std::max(output, entry.height_);
+        }
+    }
+
+    const auto retained =
+        std::max(block::Height{0}, tip - minimum_retained_);
+
+    return std::min({output, ceiling, retained});
+}
+}  // namespace opentxs::blockchain::database
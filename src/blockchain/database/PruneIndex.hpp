@@ -0,0 +1,101 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+
+#include "opentxs/blockchain/block/Hash.hpp"
+#include "opentxs/blockchain/block/Position.hpp"
+#include "opentxs/blockchain/block/Types.hpp"
+#include "opentxs/util/Container.hpp"
+
+namespace opentxs::blockchain::database
+{
+/// Sizes of the best chain blocks which have not been pruned
+///
+/// Blocks are recorded in height order as the best chain grows so that the
+/// total size of the retained blocks is known without reading the size of
+/// every retained block on every pruning pass.
+class PruneIndex
+{
+public:
+    /// Number of blocks below the tip which are never pruned
+    ///
+    /// A pruning node advertises NODE_NETWORK_LIMITED which promises peers
+    /// the most recent 288 blocks (BIP159).
+    static constexpr auto minimum_retained_ = block::Height{288};
+
+    /// Highest height which may be pruned
+    ///
+    /// Blocks above the cfilter tip or above the oldest position scanned by
+    /// any wallet subchain are still needed. An empty scanned value means no
+    /// subchains exist.
+    static auto Ceiling(
+        const block::Height tip,
+        const block::Height filters,
+        const std::optional<block::Height>& scanned) noexcept -> block::Height;
+
+    auto Bytes() const noexcept -> std::size_t { return bytes_; }
+    auto empty() const noexcept -> bool { return blocks_.empty(); }
+    /// Position of the highest recorded block
+    auto Last() const noexcept -> std::optional<block::Position>;
+    /// Height of the next block to record, or an empty value if any height is
+    /// acceptable
+    auto Next() const noexcept -> std::optional<block::Height>;
+    /// Highest height which must be pruned to satisfy the retention limits
+    ///
+    /// A depth or bytes value of zero disables the corresponding limit. The
+    /// byte limit is only enforced for recorded blocks. The result is never
+    /// greater than ceiling and never prunes any of the minimum_retained_
+    /// blocks below the tip, regardless of how small the limits are.
+    auto Target(
+        const block::Height tip,
+        const block::Height ceiling,
+        const std::size_t depth,
+        const std::size_t bytes) const noexcept -> block::Height;
+
+    /// Record the next best chain block
+    ///
+    /// Returns false if the block does not immediately follow the last
+    /// recorded block.
+    auto Add(
+        const block::Height height,
+        const block::Hash& hash,
+        const std::size_t size) noexcept -> bool;
+    auto clear() noexcept -> void;
+    /// Drop every block at or below height after those blocks are pruned
+    auto Forget(const block::Height height) noexcept -> void;
+    /// Update the size of a recorded block which has been stored since it was
+    /// recorded
+    auto Resize(const block::Hash& hash, const std::size_t size) noexcept
+        -> void;
+    /// Drop every block above height after a reorg
+    auto Rewind(const block::Height height) noexcept -> void;
+
+    PruneIndex() noexcept;
+    PruneIndex(const PruneIndex&) = delete;
+    PruneIndex(PruneIndex&&) = delete;
+    auto operator=(const PruneIndex&) -> PruneIndex& = delete;
+    auto operator=(PruneIndex&&) -> PruneIndex& = delete;
+
+    ~PruneIndex() = default;
+
+private:
+    struct Entry {
+        block::Height height_;
+        block::Hash hash_;
+        std::size_t size_;
+    };
+
+    Deque<Entry> blocks_;
+    Map<block::Hash, block::Height> index_;
+    std::size_t bytes_;
+
+    auto pop_back() noexcept -> void;
+    auto pop_front() noexcept -> void;
+};
+}  // namespace opentxs::blockchain::database
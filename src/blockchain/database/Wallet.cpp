@@ -288,6 +288,24 @@ auto Wallet::ReserveUTXO(
     return outputs_.ReserveUTXO(spender, id, policy);
 }
 
+auto Wallet::ReserveUTXOs(
+    const identifier::Nym& spender,
+    const Identifier& id,
+    const Amount& target,
+    const Amount& feeRate,
+    node::internal::SpendPolicy& policy) const noexcept
+    -> UnallocatedVector<UTXO>
+{
+    if (!proposals_.Exists(id)) {
+        LogError()(OT_PRETTY_CLASS())("Proposal ")(id)(" does not exist")
+            .Flush();
+
+        return {};
+    }
+
+    return outputs_.ReserveUTXOs(spender, id, target, feeRate, policy);
+}
+
 auto Wallet::SubchainAddElements(
     const SubchainIndex& index,
     const ElementMap& elements) const noexcept -> bool
@@ -307,6 +325,12 @@ auto Wallet::SubchainLastScanned(const SubchainIndex& index) const noexcept
     return subchains_.SubchainLastScanned(index);
 }
 
+auto Wallet::SubchainOldestScanned() const noexcept
+    -> std::optional<block::Height>
+{
+    return subchains_.OldestScanned();
+}
+
 auto Wallet::SubchainSetLastScanned(
     const SubchainIndex& index,
     const block::Position& position) const noexcept -> bool
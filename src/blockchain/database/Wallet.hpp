@@ -223,6 +223,13 @@ public:
         const Identifier& proposal,
         node::internal::SpendPolicy& policy) const noexcept
         -> std::optional<UTXO>;
+    auto ReserveUTXOs(
+        const identifier::Nym& spender,
+        const Identifier& proposal,
+        const Amount& target,
+        const Amount& feeRate,
+        node::internal::SpendPolicy& policy) const noexcept
+        -> UnallocatedVector<UTXO>;
     auto SubchainAddElements(
         const SubchainIndex& index,
         const ElementMap& elements) const noexcept -> bool;
@@ -230,6 +237,7 @@ public:
         -> std::optional<Bip32Index>;
     auto SubchainLastScanned(const SubchainIndex& index) const noexcept
         -> block::Position;
+    auto SubchainOldestScanned() const noexcept -> std::optional<block::Height>;
     auto SubchainSetLastScanned(
         const SubchainIndex& index,
         const block::Position& position) const noexcept -> bool;
@@ -8,10 +8,14 @@
 #include "blockchain/database/common/BlockFilter.hpp"  // IWYU pragma: associated
 
 #include <google/protobuf/arena.h>  // IWYU pragma: keep
+#include <google/protobuf/io/coded_stream.h>
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
+#include <iterator>
 #include <mutex>
+#include <optional>
 #include <stdexcept>
 #include <tuple>
 #include <type_traits>
@@ -27,6 +31,7 @@
 #include "internal/util/TSV.hpp"
 #include "opentxs/blockchain/bitcoin/cfilter/GCS.hpp"
 #include "opentxs/blockchain/block/Hash.hpp"
+#include "opentxs/network/blockchain/bitcoin/CompactSize.hpp"
 #include "opentxs/util/Allocator.hpp"
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/Log.hpp"
@@ -104,11 +109,17 @@ auto BlockFilter::LoadFilter(
     alloc::Default alloc) const noexcept -> opentxs::blockchain::GCS
 {
     try {
-        util::IndexData index{};
-        load_filter_index(type, blockHash, index);
+        const auto proto = [&] {
+            // NOTE the record must be parsed before the lock is released since
+            // the item may be moved by compaction at any time after that
+            auto lock = Lock{bulk_.Mutex()};
+            util::IndexData index{};
+            load_filter_index(type, blockHash, index);
+
+            return proto::Factory<proto::GCS>(bulk_.ReadView(lock, index));
+        }();
 
-        return factory::GCS(
-            api_, proto::Factory<proto::GCS>(bulk_.ReadView(index)), alloc);
+        return factory::GCS(api_, proto, alloc);
     } catch (const std::exception& e) {
         LogVerbose()(OT_PRETTY_CLASS())(e.what()).Flush();
 
@@ -116,6 +127,26 @@ auto BlockFilter::LoadFilter(
     }
 }
 
+auto BlockFilter::load_filter_indices(
+    const cfilter::Type type,
+    const Vector<block::Hash>& blocks,
+    Vector<util::IndexData>& out) const noexcept -> void
+{
+    out.reserve(blocks.size());
+    auto tx = lmdb_.TransactionRO();
+
+    for (const auto& hash : blocks) {
+        try {
+            auto& index = out.emplace_back();
+            load_filter_index(type, hash.Bytes(), tx, index);
+        } catch (const std::exception& e) {
+            LogVerbose()(OT_PRETTY_CLASS())(e.what()).Flush();
+            out.pop_back();
+            break;
+        }
+    }
+}
+
 auto BlockFilter::LoadFilters(
     const cfilter::Type type,
     const Vector<block::Hash>& blocks) const noexcept -> Vector<GCS>
@@ -129,27 +160,32 @@ auto BlockFilter::LoadFilters(
     auto alloc = alloc::BoostMonotonic{buf.data(), buf.size()};
 
     Vector<util::IndexData> indices{&alloc};
-    indices.reserve(1000u);
+    auto protos = UnallocatedVector<proto::GCS>{};
+
     {
-        auto tx = lmdb_.TransactionRO();
+        // NOTE the indices must be loaded and the records parsed while the
+        // lock is held since items may be moved by compaction at any time
+        // after it is released
+        auto lock = Lock{bulk_.Mutex()};
+        load_filter_indices(type, blocks, indices);
+        protos.reserve(indices.size());
 
-        for (const auto& hash : blocks) {
+        for (const auto& index : indices) {
             try {
-                auto& index = indices.emplace_back();
-                load_filter_index(type, hash.Bytes(), tx, index);
+                protos.emplace_back(
+                    proto::Factory<proto::GCS>(bulk_.ReadView(lock, index)));
             } catch (const std::exception& e) {
                 LogVerbose()(OT_PRETTY_CLASS())(e.what()).Flush();
-                indices.pop_back();
+
                 break;
             }
         }
     }
-    for (const auto& index : indices) {
+
+    for (const auto& proto : protos) {
         try {
-            output.emplace_back(factory::GCS(
-                api_,
-                proto::Factory<proto::GCS>(bulk_.ReadView(index)),
-                blocks.get_allocator()));
+            output.emplace_back(
+                factory::GCS(api_, proto, blocks.get_allocator()));
         } catch (const std::exception& e) {
             LogVerbose()(OT_PRETTY_CLASS())(e.what()).Flush();
 
@@ -222,6 +258,119 @@ auto BlockFilter::LoadFilterHeader(
     return output;
 }
 
+auto BlockFilter::LoadSerializedFilters(
+    const cfilter::Type type,
+    const Vector<block::Hash>& blocks,
+    alloc::Default alloc) const noexcept -> Vector<Vector<std::byte>>
+{
+    auto output = Vector<Vector<std::byte>>{alloc};
+    output.reserve(blocks.size());
+    constexpr auto allocBytes =
+        (1000u * sizeof(util::IndexData)) + sizeof(Vector<util::IndexData>);
+    auto buf = std::array<std::byte, allocBytes>{};
+    auto monotonic = alloc::BoostMonotonic{buf.data(), buf.size()};
+    auto indices = Vector<util::IndexData>{&monotonic};
+    // NOTE the indices must be loaded and the records copied while the lock is
+    // held since items may be moved by compaction at any time after it is
+    // released
+    auto lock = Lock{bulk_.Mutex()};
+    load_filter_indices(type, blocks, indices);
+
+    for (const auto& index : indices) {
+        try {
+            auto& serialized = output.emplace_back();
+            serialize_stored_filter(bulk_.ReadView(lock, index), serialized);
+        } catch (const std::exception& e) {
+            LogVerbose()(OT_PRETTY_CLASS())(e.what()).Flush();
+            output.pop_back();
+
+            break;
+        }
+    }
+
+    return output;
+}
+
+auto BlockFilter::serialize_stored_filter(
+    const ReadView stored,
+    Vector<std::byte>& out) noexcept(false) -> void
+{
+    // NOTE filters are stored as proto::GCS. Only the element count and the
+    // compressed set are needed to produce the BIP-158 serialization, so the
+    // record is scanned in place rather than parsed into a message and
+    // validated.
+    namespace io = google::protobuf::io;
+    using WireType = std::uint32_t;
+    static constexpr auto varint = WireType{0};
+    static constexpr auto fixed64 = WireType{1};
+    static constexpr auto delimited = WireType{2};
+    static constexpr auto fixed32 = WireType{5};
+    auto stream = io::CodedInputStream{
+        reinterpret_cast<const std::uint8_t*>(stored.data()),
+        static_cast<int>(stored.size())};
+    auto count = std::optional<std::uint32_t>{};
+    auto filter = std::optional<ReadView>{};
+
+    for (auto tag = stream.ReadTag(); 0u != tag; tag = stream.ReadTag()) {
+        const auto field = static_cast<int>(tag >> 3u);
+        const auto wire = tag & 0x7u;
+        auto value = std::uint64_t{};
+        auto size = std::uint32_t{};
+
+        if ((proto::GCS::kCountFieldNumber == field) && (varint == wire)) {
+            if (false == stream.ReadVarint64(&value)) {
+                throw std::runtime_error{"truncated element count"};
+            }
+
+            count = static_cast<std::uint32_t>(value);
+        } else if (
+            (proto::GCS::kFilterFieldNumber == field) && (delimited == wire)) {
+            if (false == stream.ReadVarint32(&size)) {
+                throw std::runtime_error{"truncated filter size"};
+            }
+
+            const auto position =
+                static_cast<std::size_t>(stream.CurrentPosition());
+            filter = stored.substr(position, size);
+
+            if ((filter->size() != size) ||
+                (false == stream.Skip(static_cast<int>(size)))) {
+                throw std::runtime_error{"truncated filter"};
+            }
+        } else if (varint == wire) {
+            if (false == stream.ReadVarint64(&value)) {
+                throw std::runtime_error{"truncated field"};
+            }
+        } else if (fixed64 == wire) {
+            if (false == stream.Skip(8)) {
+                throw std::runtime_error{"truncated field"};
+            }
+        } else if (delimited == wire) {
+            if ((false == stream.ReadVarint32(&size)) ||
+                (false == stream.Skip(static_cast<int>(size)))) {
+                throw std::runtime_error{"truncated field"};
+            }
+        } else if (fixed32 == wire) {
+            if (false == stream.Skip(4)) {
+                throw std::runtime_error{"truncated field"};
+            }
+        } else {
+            throw std::runtime_error{"unsupported wire type"};
+        }
+    }
+
+    if ((false == count.has_value()) || (false == filter.has_value())) {
+        throw std::runtime_error{"incomplete cfilter"};
+    }
+
+    using CompactSize = network::blockchain::bitcoin::CompactSize;
+    const auto prefix = CompactSize{count.value()}.Encode();
+    const auto* start = reinterpret_cast<const std::byte*>(filter->data());
+    out.reserve(prefix.size() + filter->size());
+    out.assign(prefix.begin(), prefix.end());
+    out.insert(out.end(), start, std::next(start, filter->size()));
+}
+
 auto BlockFilter::store(
     const Lock& lock,
     storage::lmdb::LMDB::Transaction& tx,
@@ -252,8 +401,8 @@ auto BlockFilter::store(
 
             return true;
         };
-        auto view =
-            bulk_.WriteView(lock, tx, index, std::move(callback), bytes);
+        auto view = bulk_.WriteView(
+            lock, tx, table, blockHash, index, std::move(callback), bytes);
 
         if (false == view.valid(bytes)) {
             throw std::runtime_error{
@@ -412,8 +561,8 @@ auto BlockFilter::StoreFilters(
             auto& [block, header, filter, bytes, index] = i;
             LoadDBTransaction(lmdb_, fTable, block);
 
-            auto view =
-                bulk_.WriteView(lock, tx, index, std::move(writeIndex), bytes);
+            auto view = bulk_.WriteView(
+                lock, tx, fTable, block, index, std::move(writeIndex), bytes);
 
             if (false == view.valid(bytes)) {
                 throw std::runtime_error{
@@ -90,6 +90,10 @@ public:
         const cfilter::Type type,
         const ReadView blockHash,
         const AllocateOutput header) const noexcept -> bool;
+    auto LoadSerializedFilters(
+        const cfilter::Type type,
+        const Vector<block::Hash>& blocks,
+        alloc::Default alloc) const noexcept -> Vector<Vector<std::byte>>;
     auto StoreFilterHeaders(
         const cfilter::Type type,
         const Vector<CFHeaderParams>& headers) const noexcept -> bool;
@@ -127,11 +131,18 @@ private:
         -> Table;
     static auto translate_header(const cfilter::Type type) noexcept(false)
         -> Table;
+    static auto serialize_stored_filter(
+        const ReadView stored,
+        Vector<std::byte>& out) noexcept(false) -> void;
 
     auto load_filter_index(
         const cfilter::Type type,
         const ReadView blockHash,
         util::IndexData& out) const noexcept(false) -> void;
+    auto load_filter_indices(
+        const cfilter::Type type,
+        const Vector<block::Hash>& blocks,
+        Vector<util::IndexData>& out) const noexcept -> void;
     auto load_filter_index(
         const cfilter::Type type,
         const ReadView blockHash,
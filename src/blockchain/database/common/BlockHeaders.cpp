@@ -7,6 +7,8 @@
 #include "1_Internal.hpp"  // IWYU pragma: associated
 #include "blockchain/database/common/BlockHeaders.hpp"  // IWYU pragma: associated
 
+#include <cstdint>
+#include <cstring>
 #include <stdexcept>
 #include <utility>
 
@@ -14,9 +16,11 @@
 #include "Proto.tpp"
 #include "blockchain/database/common/Bulk.hpp"
 #include "internal/blockchain/block/Header.hpp"
+#include "internal/blockchain/block/HeaderRecord.hpp"
 #include "internal/blockchain/database/common/Common.hpp"
 #include "internal/util/LogMacros.hpp"
 #include "internal/util/TSV.hpp"
+#include "opentxs/blockchain/BlockchainType.hpp"
 #include "opentxs/blockchain/block/Header.hpp"
 #include "opentxs/util/Bytes.hpp"
 #include "opentxs/util/Log.hpp"
@@ -40,13 +44,22 @@ auto BlockHeader::Exists(
 }
 
 auto BlockHeader::Load(const opentxs::blockchain::block::Hash& hash) const
-    noexcept(false) -> proto::BlockchainBlockHeader
+    noexcept(false) -> block::internal::HeaderRecord
 {
-    auto index = LoadDBTransaction(lmdb_, table_, hash.Bytes());
+    using Record = block::internal::HeaderRecord;
+    // NOTE the record must be parsed before the lock is released since the
+    // item may be moved by compaction at any time after that
+    auto lock = Lock{bulk_.Mutex()};
+    const auto index = LoadDBTransaction(lmdb_, table_, hash.Bytes());
 
     if (0 == index.size_) { throw std::out_of_range("Block header not found"); }
 
-    return proto::Factory<proto::BlockchainBlockHeader>(bulk_.ReadView(index));
+    const auto bytes = bulk_.ReadView(lock, index);
+
+    if (Record::Check(bytes)) { return Record::Read(bytes); }
+
+    return block::internal::ConvertLegacy(
+        proto::Factory<proto::BlockchainBlockHeader>(bytes));
 }
 
 auto BlockHeader::Store(
@@ -85,6 +98,26 @@ auto BlockHeader::Store(const UpdatedHeader& headers) const noexcept -> bool
     return false;
 }
 
+auto BlockHeader::Store(
+    const UnallocatedVector<const opentxs::blockchain::block::Header*>& headers)
+    const noexcept -> bool
+{
+    auto tx = lmdb_.TransactionRW();
+    auto lock = Lock{bulk_.Mutex()};
+
+    for (const auto* header : headers) {
+        OT_ASSERT(nullptr != header);
+
+        if (!store(lock, true, tx, *header)) { return false; }
+    }
+
+    if (tx.Finalize(true)) { return true; }
+
+    LogError()(OT_PRETTY_CLASS())("Database update error").Flush();
+
+    return false;
+}
+
 auto BlockHeader::store(
     const Lock& lock,
     bool clearLocal,
@@ -94,20 +127,23 @@ auto BlockHeader::store(
     const auto& hash = header.Hash();
 
     try {
-        block::internal::Header::SerializedType proto{};
+        auto record = block::internal::HeaderRecord{};
+        record.type_ = static_cast<std::uint32_t>(header.Type());
 
-        if (!header.Internal().Serialize(proto)) {
-            throw std::runtime_error{"Failed to serialized header"};
+        if (false == header.Serialize(
+                         preallocated(record.raw_.size(), record.raw_.data()),
+                         true)) {
+            throw std::runtime_error{"Failed to serialize header"};
         }
 
-        if (clearLocal) { proto.clear_local(); }
-
-        const auto bytes = proto.ByteSizeLong();
-
-        util::IndexData index = LoadDBTransaction(lmdb_, table_, hash.Bytes());
-        ;
+        if ((false == clearLocal) &&
+            (false == header.Internal().SerializeLocal(record.local_))) {
+            throw std::runtime_error{"Failed to serialize header metadata"};
+        }
 
-        auto cb2 = [&](auto& tx) -> bool {
+        const auto bytes = record.Bytes();
+        auto index = LoadDBTransaction(lmdb_, table_, hash.Bytes());
+        auto cb = [&](auto& tx) -> bool {
             const auto result =
                 lmdb_.Store(table_, hash.Bytes(), tsv(index), tx);
 
@@ -119,14 +155,23 @@ auto BlockHeader::store(
             }
             return true;
         };
-        auto view = bulk_.WriteView(lock, pTx, index, std::move(cb2), bytes);
-
-        if (!view.valid(bytes)) {
+        auto view = bulk_.WriteView(
+            lock,
+            pTx,
+            table_,
+            hash.Bytes(),
+            index,
+            std::move(cb),
+            bytes.size());
+
+        if (!view.valid(bytes.size())) {
             throw std::runtime_error{
                 "Failed to get write position for block header"};
         }
 
-        return proto::write(proto, preallocated(bytes, view.data()));
+        std::memcpy(view.data(), bytes.data(), bytes.size());
+
+        return true;
     } catch (const std::exception& e) {
         LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
 
@@ -7,7 +7,7 @@
 
 #include <mutex>
 
-#include "Proto.hpp"
+#include "internal/blockchain/block/HeaderRecord.hpp"
 #include "internal/blockchain/crypto/Crypto.hpp"
 #include "internal/blockchain/database/Types.hpp"
 #include "internal/blockchain/database/common/Common.hpp"
@@ -15,7 +15,6 @@
 #include "opentxs/api/session/Client.hpp"
 #include "opentxs/blockchain/block/Hash.hpp"
 #include "opentxs/blockchain/block/Types.hpp"
-#include "serialization/protobuf/BlockchainBlockHeader.pb.h"
 #include "util/LMDB.hpp"
 
 // NOLINTBEGIN(modernize-concat-nested-namespaces)
@@ -63,10 +62,13 @@ public:
     auto Exists(const opentxs::blockchain::block::Hash& hash) const noexcept
         -> bool;
     auto Load(const opentxs::blockchain::block::Hash& hash) const
-        noexcept(false) -> proto::BlockchainBlockHeader;
+        noexcept(false) -> block::internal::HeaderRecord;
     auto Store(const opentxs::blockchain::block::Header& header) const noexcept
         -> bool;
     auto Store(const UpdatedHeader& headers) const noexcept -> bool;
+    auto Store(
+        const UnallocatedVector<const opentxs::blockchain::block::Header*>&
+            headers) const noexcept -> bool;
 
     BlockHeader(storage::lmdb::LMDB& lmdb, Bulk& bulk) noexcept(false);
 
@@ -8,6 +8,7 @@
 #include "blockchain/database/common/Blocks.hpp"  // IWYU pragma: associated
 
 #include <cstring>
+#include <exception>
 #include <mutex>
 #include <shared_mutex>
 #include <type_traits>
@@ -33,11 +34,89 @@ struct Blocks::Imp {
     mutable std::mutex lock_;
     mutable UnallocatedMap<pHash, std::shared_mutex> block_locks_;
 
+    auto Compact(const std::size_t limit) const noexcept -> std::size_t
+    {
+        auto lock = Lock{lock_};
+        auto held = UnallocatedVector<eLock>{};
+        auto created = UnallocatedVector<pHash>{};
+        // NOTE blocks which are currently being read or written can not be
+        // moved
+        const auto filter = [&](const auto table, const auto key) {
+            if (table_ != table) { return true; }
+
+            try {
+                auto hash = Hash{key};
+                const auto [i, added] = block_locks_.try_emplace(hash);
+                auto blockLock = eLock{i->second, std::try_to_lock};
+
+                if (added) { created.emplace_back(std::move(hash)); }
+
+                if (false == blockLock.owns_lock()) { return false; }
+
+                held.emplace_back(std::move(blockLock));
+
+                return true;
+            } catch (const std::exception& e) {
+                LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+
+                return false;
+            }
+        };
+        const auto output = bulk_.Compact(limit, filter);
+        held.clear();
+
+        for (const auto& hash : created) { block_locks_.erase(hash); }
+
+        return output;
+    }
     auto Exists(const Hash& block) const noexcept -> bool
     {
         return lmdb_.Exists(table_, block.Bytes());
     }
 
+    auto Forget(const Hash& block) const noexcept -> bool
+    {
+        auto lock = Lock{lock_};
+        const auto index = LoadDBTransaction(lmdb_, table_, block.Bytes());
+
+        if (0 == index.size_) { return true; }
+
+        {
+            // NOTE wait for any outstanding readers of this block to finish
+            auto blockLock = eLock{block_locks_[block]};
+
+            try {
+                auto tx = lmdb_.TransactionRW();
+
+                if (false == lmdb_.Delete(table_, block.Bytes(), tx)) {
+                    LogError()(OT_PRETTY_CLASS())(
+                        "Failed to remove index for block ")(block.asHex())
+                        .Flush();
+
+                    return false;
+                }
+
+                bulk_.Release(tx, index);
+
+                if (false == tx.Finalize(true)) {
+                    LogError()(OT_PRETTY_CLASS())(
+                        "Failed to commit transaction")
+                        .Flush();
+
+                    return false;
+                }
+            } catch (const std::exception& e) {
+                LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+
+                return false;
+            }
+        }
+
+        block_locks_.erase(block);
+
+        return true;
+    }
+
     auto Load(const Hash& block) const noexcept -> BlockReader
     {
         auto lock = Lock{lock_};
@@ -51,7 +130,16 @@ struct Blocks::Imp {
             return {};
         }
 
-        return BlockReader{bulk_.ReadView(index), block_locks_[block]};
+        // NOTE the view remains valid after the storage lock is released since
+        // the reader prevents the block from being moved or released
+        auto bulk = Lock{bulk_.Mutex()};
+
+        return BlockReader{bulk_.ReadView(bulk, index), block_locks_[block]};
+    }
+
+    auto Size(const Hash& block) const noexcept -> std::size_t
+    {
+        return LoadDBTransaction(lmdb_, table_, block.Bytes()).size_;
     }
 
     auto Store(const Hash& block, const std::size_t bytes) const noexcept
@@ -84,7 +172,8 @@ struct Blocks::Imp {
             return true;
         };
         auto tx = lmdb_.TransactionRW();
-        auto view = bulk_.WriteView(tx, index, std::move(callback), bytes);
+        auto view = bulk_.WriteView(
+            tx, table_, block.Bytes(), index, std::move(callback), bytes);
 
         if (false == view.valid()) {
             LogError()(OT_PRETTY_CLASS())(
@@ -118,16 +207,31 @@ Blocks::Blocks(storage::lmdb::LMDB& lmdb, Bulk& bulk) noexcept
 {
 }
 
+auto Blocks::Compact(const std::size_t limit) const noexcept -> std::size_t
+{
+    return imp_->Compact(limit);
+}
+
 auto Blocks::Exists(const Hash& block) const noexcept -> bool
 {
     return imp_->Exists(block);
 }
 
+auto Blocks::Forget(const Hash& block) const noexcept -> bool
+{
+    return imp_->Forget(block);
+}
+
 auto Blocks::Load(const Hash& block) const noexcept -> BlockReader
 {
     return imp_->Load(block);
 }
 
+auto Blocks::Size(const Hash& block) const noexcept -> std::size_t
+{
+    return imp_->Size(block);
+}
+
 auto Blocks::Store(const Hash& block, const std::size_t bytes) const noexcept
     -> BlockWriter
 {
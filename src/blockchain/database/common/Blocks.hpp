@@ -55,8 +55,13 @@ public:
     using Hash = opentxs::blockchain::block::Hash;
     using pHash = opentxs::blockchain::block::Hash;
 
+    // Compacts the shared storage. Items from every table are moved but blocks
+    // which are currently being read or written are skipped.
+    auto Compact(const std::size_t limit) const noexcept -> std::size_t;
     auto Exists(const Hash& block) const noexcept -> bool;
+    auto Forget(const Hash& block) const noexcept -> bool;
     auto Load(const Hash& block) const noexcept -> BlockReader;
+    auto Size(const Hash& block) const noexcept -> std::size_t;
     auto Store(const Hash& block, const std::size_t bytes) const noexcept
         -> BlockWriter;
 
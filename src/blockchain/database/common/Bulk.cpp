@@ -7,30 +7,130 @@
 #include "1_Internal.hpp"                       // IWYU pragma: associated
 #include "blockchain/database/common/Bulk.hpp"  // IWYU pragma: associated
 
+#include <array>
+#include <cstring>
+#include <exception>
 #include <mutex>
+#include <optional>
 #include <utility>
 
 #include "blockchain/database/common/Database.hpp"
 #include "internal/blockchain/database/common/Common.hpp"
+#include "internal/util/LogMacros.hpp"
+#include "internal/util/P0330.hpp"
+#include "internal/util/TSV.hpp"
+#include "opentxs/util/Bytes.hpp"
+#include "opentxs/util/Container.hpp"
+#include "opentxs/util/Log.hpp"
 #include "util/MappedFileStorage.hpp"
 
 namespace opentxs::blockchain::database::common
 {
 struct Bulk::Imp final : private util::MappedFileStorage {
+    auto Compact(
+        const Lock&,
+        storage::lmdb::LMDB::Transaction& tx,
+        const std::size_t limit,
+        const CompactFilter& filter) const noexcept -> std::size_t
+    {
+        const auto indexing = (false == indexed_);
+
+        if (false == index_owners(tx)) { return 0_uz; }
+
+        auto moved = 0_uz;
+
+        try {
+            for (const auto& [position, owner] : candidates(tx, limit)) {
+                if ((moved >= limit) || (0_uz == free_bytes())) { break; }
+
+                const auto [table, key] = parse_owner(reader(owner));
+
+                if (filter && (false == filter(table, key))) { continue; }
+
+                auto index = load_index(tx, table, key);
+
+                // NOTE skip stale owner entries
+                if ((0_uz == index.size_) || (position != index.position_)) {
+                    continue;
+                }
+
+                const auto old = index;
+                auto update = [&, t = table, k = key, o = reader(owner)](
+                                  auto& txn) {
+                    return lmdb_.Store(t, k, tsv(index), txn).first &&
+                           update_owner(txn, old, index, o);
+                };
+
+                if (relocate(tx, index, update)) { ++moved; }
+            }
+
+            if (((0_uz < moved) || indexing) && (false == tx.Finalize(true))) {
+                LogError()(OT_PRETTY_CLASS())("Failed to commit transaction")
+                    .Flush();
+
+                return 0_uz;
+            }
+        } catch (const std::exception& e) {
+            LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+
+            return 0_uz;
+        }
+
+        return moved;
+    }
+    auto FreeBytes(const Lock&) const noexcept -> std::size_t
+    {
+        return free_bytes();
+    }
     auto Mutex() const noexcept -> std::mutex& { return lock_; }
     auto ReadView(const Lock&, const util::IndexData& index) const noexcept
         -> opentxs::ReadView
     {
         return get_read_view(index);
     }
+    auto Release(
+        const Lock&,
+        storage::lmdb::LMDB::Transaction& tx,
+        const util::IndexData& index) const noexcept -> void
+    {
+        if (0_uz == index.size_) { return; }
+
+        // NOTE items written before the owner table existed have no entry
+        lmdb_.Delete(Table::BulkOwners, index.position_, tx);
+        release(tx, index);
+    }
+    auto TransactionRW() const noexcept(false)
+        -> storage::lmdb::LMDB::Transaction
+    {
+        return lmdb_.TransactionRW();
+    }
+    auto Trim(const Lock&, storage::lmdb::LMDB::Transaction& tx) const noexcept
+        -> std::size_t
+    {
+        return trim(tx);
+    }
+    auto UsedBytes(const Lock&) const noexcept -> std::size_t
+    {
+        return used_bytes();
+    }
     auto WriteView(
         const Lock&,
         storage::lmdb::LMDB::Transaction& tx,
+        const int table,
+        const opentxs::ReadView key,
         util::IndexData& index,
         UpdateCallback&& cb,
         std::size_t size) const noexcept -> WritableView
     {
-        return get_write_view(tx, index, std::move(cb), size);
+        const auto old = index;
+        const auto owner = serialize_owner(table, key);
+        auto update = [&, callback = std::move(cb)](auto& txn) {
+            if (callback && (false == callback(txn))) { return false; }
+
+            return update_owner(txn, old, index, reader(owner));
+        };
+
+        return get_write_view(tx, index, update, size);
     }
 
     Imp(storage::lmdb::LMDB& lmdb,
@@ -40,13 +140,186 @@ struct Bulk::Imp final : private util::MappedFileStorage {
               path,
               "blk",
               Table::Config,
-              static_cast<std::size_t>(Database::Key::NextBlockAddress))
+              static_cast<std::size_t>(Database::Key::NextBlockAddress),
+              Table::BulkFreeSpace)
         , lock_()
+        , indexed_(false)
     {
     }
 
 private:
+    using Position = util::IndexData::MemoryPosition;
+    using Candidate = std::pair<Position, Space>;
+
+    // NOTE the number of items examined for each item to be moved, since items
+    // which are in use or for which no suitable free extent exists are skipped
+    static constexpr auto candidate_factor_ = 4_uz;
+    static constexpr auto indexed_tables_ = std::array<int, 6>{
+        Table::BlockIndex,
+        Table::HeaderIndex,
+        Table::FilterIndexBasic,
+        Table::FilterIndexBCH,
+        Table::FilterIndexES,
+        Table::TransactionIndex,
+    };
+
     mutable std::mutex lock_;
+    mutable bool indexed_;
+
+    static auto parse_owner(const opentxs::ReadView in) noexcept
+        -> std::pair<int, opentxs::ReadView>
+    {
+        auto table = int{};
+
+        OT_ASSERT(sizeof(table) < in.size());
+
+        std::memcpy(&table, in.data(), sizeof(table));
+
+        return std::make_pair(
+            table,
+            opentxs::ReadView{
+                in.data() + sizeof(table), in.size() - sizeof(table)});
+    }
+    static auto serialize_owner(
+        const int table,
+        const opentxs::ReadView key) noexcept -> Space
+    {
+        auto out = space(tsv(table));
+        const auto* start = reinterpret_cast<const std::byte*>(key.data());
+        out.insert(out.end(), start, start + key.size());
+
+        return out;
+    }
+
+    // NOTE walks the owner table backwards from the end of the file and stops
+    // at the lowest free extent since items below it can not be moved any
+    // closer to the start
+    auto candidates(storage::lmdb::LMDB::Transaction& tx, std::size_t limit)
+        const noexcept -> UnallocatedVector<Candidate>
+    {
+        auto out = UnallocatedVector<Candidate>{};
+        const auto lowest = lowest_free();
+
+        if (false == lowest.has_value()) { return out; }
+
+        const auto target = candidate_factor_ * limit;
+        const auto floor = lowest->position_;
+        const auto cb = [&](const auto key, const auto value) {
+            auto position = Position{};
+
+            if (sizeof(position) != key.size()) { return true; }
+
+            std::memcpy(&position, key.data(), key.size());
+
+            if (position < floor) { return false; }
+
+            if (sizeof(int) >= value.size()) {
+                LogError()(OT_PRETTY_CLASS())("Invalid owner for position ")(
+                    position)
+                    .Flush();
+
+                return true;
+            }
+
+            out.emplace_back(position, space(value));
+
+            return out.size() < target;
+        };
+        lmdb_.Read(
+            Table::BulkOwners, cb, storage::lmdb::LMDB::Dir::Backward, tx);
+
+        return out;
+    }
+    // NOTE databases created before the owner table existed are indexed once
+    // by scanning every table which references the storage
+    auto index_owners(storage::lmdb::LMDB::Transaction& tx) const noexcept
+        -> bool
+    {
+        if (indexed_) { return true; }
+
+        static const auto flag =
+            static_cast<std::size_t>(Database::Key::BulkOwnersIndexed);
+
+        if (lmdb_.Exists(Table::Config, tsv(flag), tx)) {
+            indexed_ = true;
+
+            return true;
+        }
+
+        auto stored{true};
+
+        for (const auto table : indexed_tables_) {
+            const auto cb = [&](const auto key, const auto value) {
+                auto index = util::IndexData{};
+
+                if (sizeof(index) != value.size()) { return true; }
+
+                std::memcpy(
+                    static_cast<void*>(&index), value.data(), value.size());
+
+                if (0_uz == index.size_) { return true; }
+
+                const auto owner = serialize_owner(table, key);
+                stored = lmdb_
+                             .Store(
+                                 Table::BulkOwners,
+                                 index.position_,
+                                 reader(owner),
+                                 tx)
+                             .first;
+
+                return stored;
+            };
+            lmdb_.Read(table, cb, storage::lmdb::LMDB::Dir::Forward, tx);
+
+            if (false == stored) {
+                LogError()(OT_PRETTY_CLASS())("Failed to index table ")(table)
+                    .Flush();
+
+                return false;
+            }
+        }
+
+        if (false == lmdb_.Store(Table::Config, flag, tsv(flag), tx).first) {
+            LogError()(OT_PRETTY_CLASS())("Failed to record owner index")
+                .Flush();
+
+            return false;
+        }
+
+        tx.OnCommit([this] { indexed_ = true; });
+
+        return true;
+    }
+    auto load_index(
+        storage::lmdb::LMDB::Transaction& tx,
+        const int table,
+        const opentxs::ReadView key) const noexcept -> util::IndexData
+    {
+        auto out = util::IndexData{};
+        auto cb = [&out](const auto in) {
+            if (sizeof(out) != in.size()) { return; }
+
+            std::memcpy(static_cast<void*>(&out), in.data(), in.size());
+        };
+        lmdb_.Load(table, key, cb, tx);
+
+        return out;
+    }
+    auto update_owner(
+        storage::lmdb::LMDB::Transaction& tx,
+        const util::IndexData& old,
+        const util::IndexData& index,
+        const opentxs::ReadView owner) const noexcept -> bool
+    {
+        if ((0_uz < old.size_) && (old.position_ != index.position_)) {
+            // NOTE items written before the owner table existed have no entry
+            lmdb_.Delete(Table::BulkOwners, old.position_, tx);
+        }
+
+        return lmdb_.Store(Table::BulkOwners, index.position_, owner, tx)
+            .first;
+    }
 };
 
 Bulk::Bulk(storage::lmdb::LMDB& lmdb, const UnallocatedCString& path) noexcept(
@@ -55,41 +328,90 @@ Bulk::Bulk(storage::lmdb::LMDB& lmdb, const UnallocatedCString& path) noexcept(
 {
 }
 
-auto Bulk::Mutex() const noexcept -> std::mutex& { return imp_->Mutex(); }
+auto Bulk::Compact(const std::size_t limit, const CompactFilter& filter)
+    const noexcept -> std::size_t
+{
+    try {
+        // NOTE the transaction must be started before the lock is acquired
+        // since writers hold a transaction while waiting for the lock
+        auto tx = imp_->TransactionRW();
+        auto lock = Lock{imp_->Mutex()};
 
-auto Bulk::ReadView(const util::IndexData& index) const noexcept
-    -> opentxs::ReadView
+        return imp_->Compact(lock, tx, limit, filter);
+    } catch (const std::exception& e) {
+        LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+
+        return 0_uz;
+    }
+}
+
+auto Bulk::FreeBytes() const noexcept -> std::size_t
 {
     auto lock = Lock{imp_->Mutex()};
 
-    return ReadView(lock, index);
+    return imp_->FreeBytes(lock);
 }
 
+auto Bulk::Mutex() const noexcept -> std::mutex& { return imp_->Mutex(); }
+
 auto Bulk::ReadView(const Lock& lock, const util::IndexData& index)
     const noexcept -> opentxs::ReadView
 {
     return imp_->ReadView(lock, index);
 }
 
+auto Bulk::Release(
+    storage::lmdb::LMDB::Transaction& tx,
+    const util::IndexData& index) const noexcept -> void
+{
+    auto lock = Lock{imp_->Mutex()};
+    imp_->Release(lock, tx, index);
+}
+
+auto Bulk::Trim() const noexcept -> std::size_t
+{
+    try {
+        auto tx = imp_->TransactionRW();
+        auto lock = Lock{imp_->Mutex()};
+
+        return imp_->Trim(lock, tx);
+    } catch (const std::exception& e) {
+        LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+
+        return 0_uz;
+    }
+}
+
+auto Bulk::UsedBytes() const noexcept -> std::size_t
+{
+    auto lock = Lock{imp_->Mutex()};
+
+    return imp_->UsedBytes(lock);
+}
+
 auto Bulk::WriteView(
     storage::lmdb::LMDB::Transaction& tx,
+    const int table,
+    const opentxs::ReadView key,
     util::IndexData& index,
     UpdateCallback&& cb,
     std::size_t size) const noexcept -> WritableView
 {
     auto lock = Lock{imp_->Mutex()};
 
-    return imp_->WriteView(lock, tx, index, std::move(cb), size);
+    return imp_->WriteView(lock, tx, table, key, index, std::move(cb), size);
 }
 
 auto Bulk::WriteView(
     const Lock& lock,
     storage::lmdb::LMDB::Transaction& tx,
+    const int table,
+    const opentxs::ReadView key,
     util::IndexData& index,
     UpdateCallback&& cb,
     std::size_t size) const noexcept -> WritableView
 {
-    return imp_->WriteView(lock, tx, index, std::move(cb), size);
+    return imp_->WriteView(lock, tx, table, key, index, std::move(cb), size);
 }
 
 Bulk::~Bulk() = default;
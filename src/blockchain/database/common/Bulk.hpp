@@ -43,20 +43,45 @@ class Bulk
 public:
     using UpdateCallback =
         std::function<bool(storage::lmdb::LMDB::Transaction&)>;
+    // Returns false if the item with the specified key in the specified index
+    // table must not be moved
+    using CompactFilter =
+        std::function<bool(const int table, const opentxs::ReadView key)>;
 
+    // Moves up to limit items into free space closer to the start of the file,
+    // beginning with the items closest to the end, and updates their index
+    // entries. Returns the number of items moved.
+    auto Compact(const std::size_t limit, const CompactFilter& filter = {})
+        const noexcept -> std::size_t;
+    auto FreeBytes() const noexcept -> std::size_t;
     auto Mutex() const noexcept -> std::mutex&;
-    auto ReadView(const util::IndexData& index) const noexcept
-        -> opentxs::ReadView;
+    // The index must be loaded while the lock is held and the returned view
+    // must not be used after the lock is released, since compaction may move
+    // or release the item as soon as the lock is available.
     auto ReadView(const Lock& lock, const util::IndexData& index) const noexcept
         -> opentxs::ReadView;
+    auto Release(
+        storage::lmdb::LMDB::Transaction& tx,
+        const util::IndexData& index) const noexcept -> void;
+    auto Trim() const noexcept -> std::size_t;
+    auto UsedBytes() const noexcept -> std::size_t;
+    // The item is recorded as belonging to the specified key of the specified
+    // index table so that compaction can locate it. The callback must store
+    // the updated index in that table.
+    //
+    // The transaction must be started before the lock is acquired.
     auto WriteView(
         storage::lmdb::LMDB::Transaction& tx,
+        const int table,
+        const opentxs::ReadView key,
         util::IndexData& index,
         UpdateCallback&& cb,
         std::size_t size) const noexcept -> WritableView;
     auto WriteView(
         const Lock& lock,
         storage::lmdb::LMDB::Transaction& tx,
+        const int table,
+        const opentxs::ReadView key,
         util::IndexData& index,
         UpdateCallback&& cb,
         std::size_t size) const noexcept -> WritableView;
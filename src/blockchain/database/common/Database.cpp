@@ -34,7 +34,9 @@ extern "C" {
 #include "blockchain/database/common/Sync.hpp"
 #include "blockchain/database/common/Wallet.hpp"
 #include "internal/api/Legacy.hpp"
+#include "internal/blockchain/block/HeaderRecord.hpp"
 #include "internal/util/LogMacros.hpp"
+#include "internal/util/P0330.hpp"
 #include "internal/util/TSV.hpp"
 #include "opentxs/blockchain/bitcoin/block/Transaction.hpp"  // IWYU pragma: keep
 #include "opentxs/blockchain/bitcoin/cfilter/GCS.hpp"  // IWYU pragma: keep
@@ -43,7 +45,6 @@ extern "C" {
 #include "opentxs/util/Log.hpp"
 #include "opentxs/util/Options.hpp"
 #include "opentxs/util/Pimpl.hpp"
-#include "serialization/protobuf/BlockchainBlockHeader.pb.h"
 #include "util/LMDB.hpp"
 
 constexpr auto false_byte_ = std::byte{0x0};
@@ -303,6 +304,9 @@ struct Database::Imp {
                       {Table::FilterIndexBCH, 0},
                       {Table::FilterIndexES, 0},
                       {Table::TransactionIndex, 0},
+                      {Table::BulkFreeSpace, MDB_INTEGERKEY},
+                      {Table::SyncFreeSpace, MDB_INTEGERKEY},
+                      {Table::BulkOwners, MDB_INTEGERKEY},
                   };
 
                   for (const auto& [table, name] : SyncTables()) {
@@ -364,6 +368,9 @@ const storage::lmdb::TableNames Database::Imp::table_names_ = [] {
         {Table::FilterIndexBCH, "block_filters_bch_2"},
         {Table::FilterIndexES, "block_filters_opentxs_2"},
         {Table::TransactionIndex, "transactions"},
+        {Table::BulkFreeSpace, "bulk_free_space"},
+        {Table::SyncFreeSpace, "sync_free_space"},
+        {Table::BulkOwners, "bulk_owners"},
     };
 
     for (const auto& [table, name] : SyncTables()) {
@@ -419,6 +426,11 @@ auto Database::BlockExists(const BlockHash& block) const noexcept -> bool
     return imp_.blocks_.Exists(block);
 }
 
+auto Database::BlockForget(const BlockHash& block) const noexcept -> bool
+{
+    return imp_.blocks_.Forget(block);
+}
+
 auto Database::BlockLoad(const BlockHash& block) const noexcept -> BlockReader
 {
     return imp_.blocks_.Load(block);
@@ -429,12 +441,33 @@ auto Database::BlockPolicy() const noexcept -> BlockStorage
     return imp_.block_policy_;
 }
 
+auto Database::BlockSize(const BlockHash& block) const noexcept -> std::size_t
+{
+    return imp_.blocks_.Size(block);
+}
+
 auto Database::BlockStore(const BlockHash& block, const std::size_t bytes)
     const noexcept -> BlockWriter
 {
     return imp_.blocks_.Store(block, bytes);
 }
 
+auto Database::Compact(const std::size_t limit) const noexcept -> std::size_t
+{
+    auto& bulk = imp_.bulk_;
+    auto output = 0_uz;
+
+    // NOTE moving items is only worthwhile once a significant fraction of the
+    // storage is unused
+    if ((8_uz * bulk.FreeBytes()) >= bulk.UsedBytes()) {
+        output += imp_.blocks_.Compact(limit);
+    }
+
+    bulk.Trim();
+
+    return output;
+}
+
 auto Database::DeleteSyncServer(
     const UnallocatedCString& endpoint) const noexcept -> bool
 {
@@ -505,7 +538,7 @@ auto Database::Import(UnallocatedVector<Address_p> peers) const noexcept -> bool
 }
 
 auto Database::LoadBlockHeader(const BlockHash& hash) const noexcept(false)
-    -> proto::BlockchainBlockHeader
+    -> block::internal::HeaderRecord
 {
     return imp_.headers_.Load(hash);
 }
@@ -541,6 +574,14 @@ auto Database::LoadFilterHeader(
     return imp_.filters_.LoadFilterHeader(type, blockHash, header);
 }
 
+auto Database::LoadSerializedFilters(
+    const cfilter::Type type,
+    const Vector<block::Hash>& blocks,
+    alloc::Default alloc) const noexcept -> Vector<Vector<std::byte>>
+{
+    return imp_.filters_.LoadSerializedFilters(type, blocks, alloc);
+}
+
 auto Database::LoadTransaction(const ReadView txid) const noexcept
     -> std::unique_ptr<bitcoin::block::Transaction>
 {
@@ -626,6 +667,13 @@ auto Database::StoreBlockHeaders(const UpdatedHeader& headers) const noexcept
     return imp_.headers_.Store(headers);
 }
 
+auto Database::StoreBlockHeaders(
+    const UnallocatedVector<const opentxs::blockchain::block::Header*>& headers)
+    const noexcept -> bool
+{
+    return imp_.headers_.Store(headers);
+}
+
 auto Database::StoreFilterHeaders(
     const cfilter::Type type,
     const Vector<CFHeaderParams>& headers) const noexcept -> bool
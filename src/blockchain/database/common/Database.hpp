@@ -61,6 +61,11 @@ class Transaction;
 
 namespace block
 {
+namespace internal
+{
+struct HeaderRecord;
+}  // namespace internal
+
 class Header;
 }  // namespace block
 
@@ -78,7 +83,6 @@ class Data;
 
 namespace proto
 {
-class BlockchainBlockHeader;
 class BlockchainTransaction;
 }  // namespace proto
 
@@ -103,6 +107,7 @@ public:
         SiphashKey = 2,
         NextSyncAddress = 3,
         SyncServerEndpoint = 4,
+        BulkOwnersIndexed = 5,
     };
 
     using BlockHash = opentxs::blockchain::block::Hash;
@@ -125,10 +130,16 @@ public:
         const UnallocatedVector<PatternID>& patterns) const noexcept -> bool;
     auto BlockHeaderExists(const BlockHash& hash) const noexcept -> bool;
     auto BlockExists(const BlockHash& block) const noexcept -> bool;
+    auto BlockForget(const BlockHash& block) const noexcept -> bool;
     auto BlockLoad(const BlockHash& block) const noexcept -> BlockReader;
     auto BlockPolicy() const noexcept -> BlockStorage;
+    auto BlockSize(const BlockHash& block) const noexcept -> std::size_t;
     auto BlockStore(const BlockHash& block, const std::size_t bytes)
         const noexcept -> BlockWriter;
+    // Moves up to limit items in the shared block, header, and filter storage
+    // into free space and returns trailing space to the operating system.
+    // Returns the number of items moved.
+    auto Compact(const std::size_t limit) const noexcept -> std::size_t;
     auto DeleteSyncServer(const UnallocatedCString& endpoint) const noexcept
         -> bool;
     auto Disable(const Chain type) const noexcept -> bool;
@@ -147,7 +158,7 @@ public:
         const noexcept -> bool;
     auto Import(UnallocatedVector<Address_p> peers) const noexcept -> bool;
     auto LoadBlockHeader(const BlockHash& hash) const noexcept(false)
-        -> proto::BlockchainBlockHeader;
+        -> block::internal::HeaderRecord;
     auto LoadEnabledChains() const noexcept -> UnallocatedVector<EnabledChain>;
     auto LoadFilter(
         const cfilter::Type type,
@@ -164,6 +175,10 @@ public:
         const cfilter::Type type,
         const ReadView blockHash,
         const AllocateOutput header) const noexcept -> bool;
+    auto LoadSerializedFilters(
+        const cfilter::Type type,
+        const Vector<block::Hash>& blocks,
+        alloc::Default alloc) const noexcept -> Vector<Vector<std::byte>>;
     auto LoadSync(
         const Chain chain,
         const Height height,
@@ -181,6 +196,9 @@ public:
     auto StoreBlockHeader(const opentxs::blockchain::block::Header& header)
         const noexcept -> bool;
     auto StoreBlockHeaders(const UpdatedHeader& headers) const noexcept -> bool;
+    auto StoreBlockHeaders(
+        const UnallocatedVector<const opentxs::blockchain::block::Header*>&
+            headers) const noexcept -> bool;
     auto StoreFilterHeaders(
         const cfilter::Type type,
         const Vector<CFHeaderParams>& headers) const noexcept -> bool;
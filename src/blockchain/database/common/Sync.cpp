@@ -243,7 +243,8 @@ struct Sync::Imp final : private util::MappedFileStorage {
               path,
               "sync",
               Table::Config,
-              static_cast<std::size_t>(Database::Key::NextSyncAddress))
+              static_cast<std::size_t>(Database::Key::NextSyncAddress),
+              Table::SyncFreeSpace)
         , api_(api)
         , tip_table_(Table::SyncTips)
         , lock_()
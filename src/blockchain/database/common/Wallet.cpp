@@ -120,6 +120,9 @@ auto Wallet::LoadTransaction(const ReadView txid) const noexcept
 {
     try {
         const auto proto = [&] {
+            // NOTE the record must be parsed before the lock is released since
+            // the item may be moved by compaction at any time after that
+            auto lock = Lock{bulk_.Mutex()};
             const auto index = [&] {
                 auto out = util::IndexData{};
                 auto cb = [&out](const ReadView in) {
@@ -137,7 +140,7 @@ auto Wallet::LoadTransaction(const ReadView txid) const noexcept
             }();
 
             return proto::Factory<proto::BlockchainTransaction>(
-                bulk_.ReadView(index));
+                bulk_.ReadView(lock, index));
         }();
 
         return factory::BitcoinTransaction(api_, proto);
@@ -155,6 +158,9 @@ auto Wallet::LoadTransaction(  // TODO : MT-83 Add unit test
 {
     try {
         proto = [&] {
+            // NOTE the record must be parsed before the lock is released since
+            // the item may be moved by compaction at any time after that
+            auto lock = Lock{bulk_.Mutex()};
             const auto index = [&] {
                 auto out = util::IndexData{};
                 auto cb = [&out](const ReadView in) {
@@ -172,7 +178,7 @@ auto Wallet::LoadTransaction(  // TODO : MT-83 Add unit test
             }();
 
             return proto::Factory<proto::BlockchainTransaction>(
-                bulk_.ReadView(index));
+                bulk_.ReadView(lock, index));
         }();
 
         return factory::BitcoinTransaction(api_, proto);
@@ -232,6 +238,9 @@ auto Wallet::StoreTransaction(
         }();
         const auto& hash = proto.txid();
         const auto bytes = proto.ByteSizeLong();
+        // NOTE the existing index must be loaded in the write transaction so
+        // that compaction can not move the item before it is replaced
+        auto dLock = lmdb_.TransactionRW();
         auto index = [&] {
             auto output = util::IndexData{};
             auto cb = [&output](const ReadView in) {
@@ -239,7 +248,7 @@ auto Wallet::StoreTransaction(
 
                 std::memcpy(static_cast<void*>(&output), in.data(), in.size());
             };
-            lmdb_.Load(transaction_table_, hash, cb);
+            lmdb_.Load(transaction_table_, hash, cb, dLock);
 
             return output;
         }();
@@ -257,11 +266,17 @@ auto Wallet::StoreTransaction(
 
             return true;
         };
-        auto dLock = lmdb_.TransactionRW();
         auto view = [&] {
             auto bLock = Lock{bulk_.Mutex()};
 
-            return bulk_.WriteView(bLock, dLock, index, std::move(cb), bytes);
+            return bulk_.WriteView(
+                bLock,
+                dLock,
+                transaction_table_,
+                hash,
+                index,
+                std::move(cb),
+                bytes);
         }();
 
         if (false == view.valid(bytes)) {
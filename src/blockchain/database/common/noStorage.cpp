@@ -18,10 +18,19 @@ Blocks::Blocks(storage::lmdb::LMDB&, Bulk&) noexcept
 {
 }
 
+auto Blocks::Compact(const std::size_t) const noexcept -> std::size_t
+{
+    return {};
+}
+
 auto Blocks::Exists(const Hash&) const noexcept -> bool { return {}; }
 
+auto Blocks::Forget(const Hash&) const noexcept -> bool { return true; }
+
 auto Blocks::Load(const Hash&) const noexcept -> BlockReader { return {}; }
 
+auto Blocks::Size(const Hash&) const noexcept -> std::size_t { return {}; }
+
 auto Blocks::Store(const Hash&, const std::size_t) const noexcept -> BlockWriter
 {
     return {};
@@ -11,9 +11,9 @@
 #include <robin_hood.h>
 #include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <iterator>
-#include <numeric>
 #include <optional>
 #include <shared_mutex>
 #include <stdexcept>
@@ -27,11 +27,13 @@
 #include "blockchain/database/wallet/Proposal.hpp"
 #include "blockchain/database/wallet/Subchain.hpp"
 #include "blockchain/database/wallet/Types.hpp"
+#include "blockchain/node/CoinSelection.hpp"
 #include "internal/api/crypto/Blockchain.hpp"
 #include "internal/blockchain/Params.hpp"
 #include "internal/blockchain/bitcoin/block/Output.hpp"
 #include "internal/blockchain/bitcoin/block/Transaction.hpp"
 #include "internal/blockchain/node/SpendPolicy.hpp"
+#include "internal/core/Amount.hpp"
 #include "internal/util/LogMacros.hpp"
 #include "internal/util/P0330.hpp"
 #include "opentxs/api/crypto/Blockchain.hpp"
@@ -42,6 +44,7 @@
 #include "opentxs/blockchain/bitcoin/block/Inputs.hpp"
 #include "opentxs/blockchain/bitcoin/block/Output.hpp"
 #include "opentxs/blockchain/bitcoin/block/Outputs.hpp"
+#include "opentxs/blockchain/bitcoin/block/Script.hpp"
 #include "opentxs/blockchain/bitcoin/block/Transaction.hpp"
 #include "opentxs/blockchain/block/Hash.hpp"
 #include "opentxs/blockchain/block/Outpoint.hpp"
@@ -799,53 +802,13 @@ public:
             auto tx = lmdb_.TransactionRW();
             const auto choose =
                 [&](const auto outpoint) -> std::optional<UTXO> {
-                auto& existing = cache.GetOutput(outpoint);
-
                 if (const auto& s = cache.GetNym(spender);
                     0u == s.count(outpoint)) {
 
                     return std::nullopt;
                 }
 
-                auto output = std::make_optional<UTXO>(
-                    std::make_pair(outpoint, existing.clone()));
-                auto rc = change_state(
-                    cache,
-                    tx,
-                    outpoint,
-                    existing,
-                    node::TxoState::UnconfirmedSpend,
-                    blank_);
-
-                if (false == rc) {
-                    throw std::runtime_error{"Failed to update outpoint state"};
-                }
-
-                rc = lmdb_
-                         .Store(
-                             proposal_spent_, id.Bytes(), outpoint.Bytes(), tx)
-                         .first;
-
-                if (false == rc) {
-                    throw std::runtime_error{
-                        "Failed to update proposal spent index"};
-                }
-
-                rc = lmdb_
-                         .Store(
-                             output_proposal_, outpoint.Bytes(), id.Bytes(), tx)
-                         .first;
-
-                if (false == rc) {
-                    throw std::runtime_error{
-                        "Failed to update outpoint proposal index"};
-                }
-
-                LogVerbose()(OT_PRETTY_CLASS())("proposal ")(id.str())(
-                    " consumed outpoint ")(outpoint.str())
-                    .Flush();
-
-                return output;
+                return reserve(cache, tx, id, outpoint);
             };
             const auto select = [&](const auto& group,
                                     const bool changeOnly =
@@ -899,6 +862,109 @@ public:
             return std::nullopt;
         }
     }
+    auto ReserveUTXOs(
+        const identifier::Nym& spender,
+        const Identifier& id,
+        const Amount& target,
+        const Amount& feeRate,
+        node::internal::SpendPolicy& policy) noexcept -> UnallocatedVector<UTXO>
+    {
+        using Selector = node::CoinSelection;
+        auto handle = lock();
+        auto& cache = *handle;
+        auto outpoints = UnallocatedVector<block::Outpoint>{};
+        auto candidates = Selector::Candidates{};
+        const auto selection = [&]() -> std::optional<Selector::Selection> {
+            try {
+                const auto& owned = cache.GetNym(spender);
+                const auto rate = feeRate.Internal().ExtractInt64();
+                const auto fee = [&](const auto type) {
+                    const auto bytes = Selector::InputBytes(type);
+
+                    return static_cast<std::int64_t>(bytes) * rate / 1000;
+                };
+                const auto add = [&](const auto& group, const bool changeOnly) {
+                    for (const auto& outpoint : group) {
+                        if (0u == owned.count(outpoint)) { continue; }
+
+                        const auto& output = cache.GetOutput(outpoint);
+
+                        if (changeOnly &&
+                            (0u == output.Tags().count(node::TxoTag::Change))) {
+                            continue;
+                        }
+
+                        const auto cost = fee(output.Script().Type());
+                        const auto amount =
+                            output.Value().Internal().ExtractInt64();
+                        candidates.push_back(
+                            {outpoints.size(), amount, amount - cost});
+                        outpoints.emplace_back(outpoint);
+                    }
+                };
+                const auto required = target.Internal().ExtractInt64();
+                // NOTE the transaction builder omits the change output if the
+                // excess value is not greater than the cost of spending a
+                // P2PKH output
+                const auto costOfChange =
+                    fee(bitcoin::block::Script::Pattern::PayToPubkeyHash);
+                const auto select = [&] {
+                    return Selector{candidates}.Select(required, costOfChange);
+                };
+                add(cache.GetState(node::TxoState::ConfirmedNew), false);
+                auto output = select();
+                const auto spendUnconfirmed =
+                    policy.unconfirmed_incoming_ || policy.unconfirmed_change_;
+
+                if ((!output.has_value()) && spendUnconfirmed) {
+                    add(cache.GetState(node::TxoState::UnconfirmedNew),
+                        !policy.unconfirmed_incoming_);
+                    output = select();
+                }
+
+                return output;
+            } catch (const std::exception& e) {
+                LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+
+                return std::nullopt;
+            }
+        }();
+
+        if (false == selection.has_value()) {
+            LogError()(OT_PRETTY_CLASS())(
+                "Insufficient spendable outputs for specified nym")
+                .Flush();
+
+            return {};
+        }
+
+        try {
+            auto tx = lmdb_.TransactionRW();
+            auto output = UnallocatedVector<UTXO>{};
+            output.reserve(selection->size());
+
+            for (const auto i : selection.value()) {
+                output.emplace_back(reserve(cache, tx, id, outpoints.at(i)));
+            }
+
+            if (false == tx.Finalize(true)) {
+                throw std::runtime_error{
+                    "Failed to commit database transaction"};
+            }
+
+            LogVerbose()(OT_PRETTY_CLASS())("proposal ")(id.str())(
+                " reserved ")(output.size())(" of ")(candidates.size())(
+                " candidate outputs")
+                .Flush();
+
+            return output;
+        } catch (const std::exception& e) {
+            LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+            cache.Clear();
+
+            return {};
+        }
+    }
     auto StartReorg(
         MDB_txn* tx,
         const SubchainID& subchain,
@@ -1079,56 +1145,21 @@ private:
         const AccountID& account,
         const crypto::Key* key) const noexcept -> Balance
     {
-        auto output = Balance{};
-        auto& [confirmed, unconfirmed] = output;
-        const auto* pNym = owner.empty() ? nullptr : &owner;
-        const auto* pAcct = account.empty() ? nullptr : &account;
-        auto cb = [&](const auto previous, const auto& outpoint) -> auto
-        {
-            const auto& existing = cache.GetOutput(outpoint);
+        // NOTE the conditions are tested in the same order as match() so a
+        // more specific condition takes priority over a more general one
+        if (nullptr != key) {
 
-            return previous + existing.Value();
-        };
+            return cache.GetKeyBalance(*key);
+        } else if (false == account.empty()) {
 
-        const auto unconfirmedSpendTotal = [&] {
-            const auto txos = match(
-                cache,
-                {node::TxoState::UnconfirmedSpend},
-                pNym,
-                pAcct,
-                nullptr,
-                key);
+            return cache.GetAccountBalance(account);
+        } else if (false == owner.empty()) {
 
-            return std::accumulate(txos.begin(), txos.end(), Amount{0}, cb);
-        }();
-
-        {
-            const auto txos = match(
-                cache,
-                {node::TxoState::ConfirmedNew},
-                pNym,
-                pAcct,
-                nullptr,
-                key);
-            confirmed =
-                unconfirmedSpendTotal +
-                std::accumulate(txos.begin(), txos.end(), Amount{0}, cb);
-        }
+            return cache.GetNymBalance(owner);
+        } else {
 
-        {
-            const auto txos = match(
-                cache,
-                {node::TxoState::UnconfirmedNew},
-                pNym,
-                pAcct,
-                nullptr,
-                key);
-            unconfirmed =
-                std::accumulate(txos.begin(), txos.end(), confirmed, cb) -
-                unconfirmedSpendTotal;
+            return cache.GetBalance();
         }
-
-        return output;
     }
     [[nodiscard]] auto get_balances(const OutputCache& cache) const noexcept
         -> NymBalances
@@ -1268,6 +1299,51 @@ private:
             api.Internal().UpdateBalance(nym, chain_, balance);
         }
     }
+    [[nodiscard]] auto reserve(
+        OutputCache& cache,
+        MDB_txn* tx,
+        const Identifier& proposal,
+        const block::Outpoint& outpoint) noexcept(false) -> UTXO
+    {
+        auto& existing = cache.GetOutput(outpoint);
+        auto output = std::make_pair(outpoint, existing.clone());
+        auto rc = change_state(
+            cache,
+            tx,
+            outpoint,
+            existing,
+            node::TxoState::UnconfirmedSpend,
+            blank_);
+
+        if (false == rc) {
+            throw std::runtime_error{"Failed to update outpoint state"};
+        }
+
+        rc = lmdb_
+                 .Store(
+                     proposal_spent_, proposal.Bytes(), outpoint.Bytes(), tx)
+                 .first;
+
+        if (false == rc) {
+            throw std::runtime_error{"Failed to update proposal spent index"};
+        }
+
+        rc = lmdb_
+                 .Store(
+                     output_proposal_, outpoint.Bytes(), proposal.Bytes(), tx)
+                 .first;
+
+        if (false == rc) {
+            throw std::runtime_error{
+                "Failed to update outpoint proposal index"};
+        }
+
+        LogVerbose()(OT_PRETTY_CLASS())("proposal ")(proposal.str())(
+            " consumed outpoint ")(outpoint.str())
+            .Flush();
+
+        return output;
+    }
     [[nodiscard]] auto translate(Vector<UTXO>&& outputs) const noexcept
         -> UnallocatedVector<block::pTxid>
     {
@@ -2055,6 +2131,16 @@ auto Output::ReserveUTXO(
     return imp_->ReserveUTXO(spender, proposal, policy);
 }
 
+auto Output::ReserveUTXOs(
+    const identifier::Nym& spender,
+    const Identifier& proposal,
+    const Amount& target,
+    const Amount& feeRate,
+    node::internal::SpendPolicy& policy) noexcept -> UnallocatedVector<UTXO>
+{
+    return imp_->ReserveUTXOs(spender, proposal, target, feeRate, policy);
+}
+
 auto Output::StartReorg(
     MDB_txn* tx,
     const SubchainID& subchain,
@@ -169,6 +169,13 @@ public:
         const identifier::Nym& spender,
         const Identifier& proposal,
         node::internal::SpendPolicy& policy) noexcept -> std::optional<UTXO>;
+    auto ReserveUTXOs(
+        const identifier::Nym& spender,
+        const Identifier& proposal,
+        const Amount& target,
+        const Amount& feeRate,
+        node::internal::SpendPolicy& policy) noexcept
+        -> UnallocatedVector<UTXO>;
     auto StartReorg(
         MDB_txn* tx,
         const SubchainID& subchain,
@@ -65,6 +65,16 @@ auto all_states() noexcept -> const States&
     return data;
 }
 
+template <typename MapKeyType, typename MapType>
+auto OutputCache::get_balance(
+    const MapKeyType& key,
+    const MapType& map) noexcept -> Balance
+{
+    if (auto it = map.find(key); map.end() != it) { return it->second.Get(); }
+
+    return {};
+}
+
 template <typename MapKeyType, typename MapType>
 auto OutputCache::load_output_index(
     const MapKeyType& key,
@@ -87,6 +97,73 @@ auto OutputCache::load_output_index(const MapKeyType& key, MapType& map)
 
     return empty_outputs_;
 }
+
+template <typename MapKeyType, typename IndexType, typename MapType>
+auto OutputCache::tally_index(
+    const MapKeyType& key,
+    const block::Outpoint& output,
+    IndexType Membership::*index,
+    MapType& map) noexcept -> void
+{
+    auto& membership = membership_[output];
+    (membership.*index).emplace_back(key);
+
+    if (const auto& state = membership.state_; state.has_value()) {
+        map[key].Add(state.value(), value(output));
+    }
+}
+}  // namespace opentxs::blockchain::database::wallet
+
+namespace opentxs::blockchain::database::wallet
+{
+auto OutputCache::Tally::Add(
+    const node::TxoState state,
+    const Amount& value) noexcept -> void
+{
+    using State = node::TxoState;
+
+    switch (state) {
+        case State::ConfirmedNew: {
+            confirmed_new_ += value;
+        } break;
+        case State::UnconfirmedNew: {
+            unconfirmed_new_ += value;
+        } break;
+        case State::UnconfirmedSpend: {
+            unconfirmed_spend_ += value;
+        } break;
+        default: {
+        }
+    }
+}
+
+auto OutputCache::Tally::Get() const noexcept -> Balance
+{
+    return {
+        confirmed_new_ + unconfirmed_spend_,
+        confirmed_new_ + unconfirmed_new_};
+}
+
+auto OutputCache::Tally::Subtract(
+    const node::TxoState state,
+    const Amount& value) noexcept -> void
+{
+    using State = node::TxoState;
+
+    switch (state) {
+        case State::ConfirmedNew: {
+            confirmed_new_ -= value;
+        } break;
+        case State::UnconfirmedNew: {
+            unconfirmed_new_ -= value;
+        } break;
+        case State::UnconfirmedSpend: {
+            unconfirmed_spend_ -= value;
+        } break;
+        default: {
+        }
+    }
+}
 }  // namespace opentxs::blockchain::database::wallet
 
 namespace opentxs::blockchain::database::wallet
@@ -112,11 +189,17 @@ OutputCache::OutputCache(
     , positions_()
     , states_()
     , subchains_()
+    , membership_()
+    , total_()
+    , account_totals_()
+    , key_totals_()
+    , nym_totals_()
     , populated_(false)
 {
     outputs_.reserve(reserve_);
     keys_.reserve(reserve_);
     positions_.reserve(reserve_);
+    membership_.reserve(reserve_);
 }
 
 auto OutputCache::AddOutput(
@@ -173,7 +256,9 @@ auto OutputCache::AddToAccount(
 
         if (!rc) { throw std::runtime_error{"Failed to update account index"}; }
 
-        set.emplace(output);
+        if (set.emplace(output).second) {
+            tally_index(id, output, &Membership::accounts_, account_totals_);
+        }
 
         return true;
     } catch (const std::exception& e) {
@@ -199,7 +284,9 @@ auto OutputCache::AddToKey(
 
         if (!rc) { throw std::runtime_error{"Failed to update key index"}; }
 
-        set.emplace(output);
+        if (set.emplace(output).second) {
+            tally_index(id, output, &Membership::keys_, key_totals_);
+        }
 
         return true;
     } catch (const std::exception& e) {
@@ -225,7 +312,10 @@ auto OutputCache::AddToNym(
 
         if (!rc) { throw std::runtime_error{"Failed to update nym index"}; }
 
-        index.emplace(output);
+        if (index.emplace(output).second) {
+            tally_index(id, output, &Membership::nyms_, nym_totals_);
+        }
+
         list.emplace(id);
 
         return true;
@@ -285,6 +375,7 @@ auto OutputCache::AddToState(
         if (!rc) { throw std::runtime_error{"Failed to update key index"}; }
 
         set.emplace(output);
+        tally_state(id, output);
 
         return true;
     } catch (const std::exception& e) {
@@ -421,6 +512,7 @@ auto OutputCache::ChangeState(
 
         auto& to = states_[newState];
         to.emplace(id);
+        tally_state(newState, id);
 
         return rc;
     } catch (const std::exception& e) {
@@ -441,6 +533,11 @@ auto OutputCache::Clear() noexcept -> void
     positions_.clear();
     states_.clear();
     subchains_.clear();
+    membership_.clear();
+    total_ = {};
+    account_totals_.clear();
+    key_totals_.clear();
+    nym_totals_.clear();
     populated_ = false;
 }
 
@@ -468,12 +565,29 @@ auto OutputCache::GetAccount(const AccountID& id) const noexcept
     return load_output_index(id, accounts_);
 }
 
+auto OutputCache::GetAccountBalance(const AccountID& id) const noexcept
+    -> Balance
+{
+    return get_balance(id, account_totals_);
+}
+
+auto OutputCache::GetBalance() const noexcept -> Balance
+{
+    return total_.Get();
+}
+
 auto OutputCache::GetKey(const crypto::Key& id) const noexcept
     -> const Outpoints&
 {
     return load_output_index(id, keys_);
 }
 
+auto OutputCache::GetKeyBalance(const crypto::Key& id) const noexcept
+    -> Balance
+{
+    return get_balance(id, key_totals_);
+}
+
 auto OutputCache::GetHeight() const noexcept -> block::Height
 {
     return get_position().Height();
@@ -485,6 +599,12 @@ auto OutputCache::GetNym(const identifier::Nym& id) const noexcept
     return load_output_index(id, nyms_);
 }
 
+auto OutputCache::GetNymBalance(const identifier::Nym& id) const noexcept
+    -> Balance
+{
+    return get_balance(id, nym_totals_);
+}
+
 auto OutputCache::GetNyms() const noexcept -> const Nyms& { return nym_list_; }
 
 auto OutputCache::GetOutput(const block::Outpoint& id) const noexcept(false)
@@ -598,15 +718,19 @@ auto OutputCache::populate() noexcept -> void
         auto id = api_.Factory().Identifier();
         id->Assign(key);
 
-        auto& set = map[std::move(id)];
-        set.emplace(value);
+        if (map[id].emplace(value).second) {
+            tally_index(id, value, &Membership::accounts_, account_totals_);
+        }
 
         return true;
     };
     const auto keys = [&](const auto key, const auto value) {
         auto& map = keys_;
-        auto& set = map[deserialize(key)];
-        set.emplace(value);
+        const auto id = deserialize(key);
+
+        if (map[id].emplace(value).second) {
+            tally_index(id, value, &Membership::keys_, key_totals_);
+        }
 
         return true;
     };
@@ -616,8 +740,10 @@ auto OutputCache::populate() noexcept -> void
         id->Assign(key);
 
         nym_list_.emplace(id);
-        auto& set = map[std::move(id)];
-        set.emplace(value);
+
+        if (map[id].emplace(value).second) {
+            tally_index(id, value, &Membership::nyms_, nym_totals_);
+        }
 
         return true;
     };
@@ -636,6 +762,7 @@ auto OutputCache::populate() noexcept -> void
         const auto id = static_cast<node::TxoState>(out);
         auto& set = map[std::move(id)];
         set.emplace(value);
+        tally_state(id, value);
 
         return true;
     };
@@ -643,7 +770,6 @@ auto OutputCache::populate() noexcept -> void
         auto& map = subchains_;
         auto id = api_.Factory().Identifier();
         id->Assign(key);
-
         auto& set = map[std::move(id)];
         set.emplace(value);
 
@@ -905,7 +1031,10 @@ auto OutputCache::write_output(
 
             auto [cache, added] = keys_.try_emplace(key);
             if (added) cache->second.reserve(reserve_);
-            cache->second.emplace(id);
+
+            if (cache->second.emplace(id).second) {
+                tally_index(key, id, &Membership::keys_, key_totals_);
+            }
         }
 
         Space serialized{};
@@ -928,5 +1057,42 @@ auto OutputCache::write_output(
     }
 }
 
+auto OutputCache::tally_state(
+    const node::TxoState id,
+    const block::Outpoint& output) noexcept -> void
+{
+    auto& membership = membership_[output];
+    auto& state = membership.state_;
+    const auto amount = value(output);
+    const auto apply = [&](const auto& cb) {
+        cb(total_);
+
+        for (const auto& key : membership.accounts_) {
+            cb(account_totals_[key]);
+        }
+
+        for (const auto& key : membership.keys_) { cb(key_totals_[key]); }
+
+        for (const auto& key : membership.nyms_) { cb(nym_totals_[key]); }
+    };
+
+    if (state.has_value()) {
+        apply([&](auto& tally) { tally.Subtract(state.value(), amount); });
+    }
+
+    state = id;
+    apply([&](auto& tally) { tally.Add(id, amount); });
+}
+
+auto OutputCache::value(const block::Outpoint& id) const noexcept -> Amount
+{
+    if (auto it = outputs_.find(id); outputs_.end() != it) {
+
+        return it->second->Value();
+    }
+
+    return {};
+}
+
 OutputCache::~OutputCache() = default;
 }  // namespace opentxs::blockchain::database::wallet
@@ -27,6 +27,7 @@
 #include "opentxs/blockchain/crypto/Types.hpp"
 #include "opentxs/blockchain/node/TxoState.hpp"
 #include "opentxs/blockchain/node/Types.hpp"
+#include "opentxs/core/Amount.hpp"
 #include "opentxs/core/identifier/Generic.hpp"
 #include "opentxs/core/identifier/Nym.hpp"
 #include "opentxs/util/Bytes.hpp"
@@ -102,9 +103,13 @@ public:
     auto Exists(const SubchainID& subchain, const block::Outpoint& id)
         const noexcept -> bool;
     auto GetAccount(const AccountID& id) const noexcept -> const Outpoints&;
+    auto GetAccountBalance(const AccountID& id) const noexcept -> Balance;
+    auto GetBalance() const noexcept -> Balance;
     auto GetKey(const crypto::Key& id) const noexcept -> const Outpoints&;
+    auto GetKeyBalance(const crypto::Key& id) const noexcept -> Balance;
     auto GetHeight() const noexcept -> block::Height;
     auto GetNym(const identifier::Nym& id) const noexcept -> const Outpoints&;
+    auto GetNymBalance(const identifier::Nym& id) const noexcept -> Balance;
     auto GetNyms() const noexcept -> const Nyms&;
     auto GetOutput(const block::Outpoint& id) const noexcept(false)
         -> const bitcoin::block::internal::Output&;
@@ -184,6 +189,27 @@ public:
     ~OutputCache();
 
 private:
+    // Running totals of the output values which contribute to a balance
+    struct Tally {
+        Amount confirmed_new_{};
+        Amount unconfirmed_new_{};
+        Amount unconfirmed_spend_{};
+
+        auto Get() const noexcept -> Balance;
+
+        auto Add(const node::TxoState state, const Amount& value) noexcept
+            -> void;
+        auto Subtract(const node::TxoState state, const Amount& value) noexcept
+            -> void;
+    };
+    // Reverse lookup of the indices which contain an output
+    struct Membership {
+        std::optional<node::TxoState> state_{};
+        UnallocatedVector<OTIdentifier> accounts_{};
+        UnallocatedVector<crypto::Key> keys_{};
+        UnallocatedVector<OTNymID> nyms_{};
+    };
+
     static constexpr std::size_t reserve_{10000u};
     static const Outpoints empty_outputs_;
     static const Nyms empty_nyms_;
@@ -204,8 +230,17 @@ private:
     robin_hood::unordered_node_map<block::Position, Outpoints> positions_;
     robin_hood::unordered_node_map<node::TxoState, Outpoints> states_;
     robin_hood::unordered_node_map<OTIdentifier, Outpoints> subchains_;
+    robin_hood::unordered_node_map<block::Outpoint, Membership> membership_;
+    Tally total_;
+    robin_hood::unordered_node_map<OTIdentifier, Tally> account_totals_;
+    robin_hood::unordered_node_map<crypto::Key, Tally> key_totals_;
+    robin_hood::unordered_node_map<OTNymID, Tally> nym_totals_;
     bool populated_;
 
+    template <typename MapKeyType, typename MapType>
+    static auto get_balance(const MapKeyType& key, const MapType& map) noexcept
+        -> Balance;
+
     auto get_position() const noexcept -> const db::Position&;
     auto load_output(const block::Outpoint& id) const noexcept(false)
         -> const bitcoin::block::internal::Output&;
@@ -219,6 +254,16 @@ private:
     auto load_output_index(const MapKeyType& key, MapType& map) noexcept
         -> Outpoints&;
     auto populate() noexcept -> void;
+    template <typename MapKeyType, typename IndexType, typename MapType>
+    auto tally_index(
+        const MapKeyType& key,
+        const block::Outpoint& output,
+        IndexType Membership::*index,
+        MapType& map) noexcept -> void;
+    auto tally_state(
+        const node::TxoState id,
+        const block::Outpoint& output) noexcept -> void;
+    auto value(const block::Outpoint& id) const noexcept -> Amount;
     auto write_output(
         const block::Outpoint& id,
         const bitcoin::block::Output& output,
@@ -10,10 +10,12 @@
 #include <algorithm>
 #include <cstring>
 #include <future>
+#include <optional>
 #include <shared_mutex>
 #include <stdexcept>
 #include <type_traits>
 
+#include "blockchain/database/wallet/Position.hpp"
 #include "blockchain/database/wallet/SubchainCache.hpp"
 #include "blockchain/database/wallet/SubchainID.hpp"
 #include "blockchain/database/wallet/Types.hpp"
@@ -67,6 +69,39 @@ struct SubchainData::Imp {
             return {};
         }
     }
+    auto OldestScanned() const noexcept -> std::optional<block::Height>
+    {
+        auto lock = sLock{lock_};
+        upgrade_future_.get();
+        auto subchains = UnallocatedVector<Space>{};
+        lmdb_.Read(
+            id_index_,
+            [&](const auto key, const auto) {
+                subchains.emplace_back(space(key));
+
+                return true;
+            },
+            storage::lmdb::LMDB::Dir::Forward);
+        auto output = std::optional<block::Height>{};
+
+        for (const auto& subchain : subchains) {
+            // NOTE a subchain which has never been scanned still needs every
+            // block after genesis
+            auto height = block::Height{0};
+            lmdb_.Load(last_scanned_, reader(subchain), [&](const auto value) {
+                try {
+                    height = db::Position{value}.Height();
+                } catch (const std::exception& e) {
+                    LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+                }
+            });
+            output = std::min(output.value_or(height), height);
+
+            if (0 >= output.value()) { break; }
+        }
+
+        return output;
+    }
     auto Reorg(
         const Lock& headerOracleLock,
         MDB_txn* tx,
@@ -333,6 +368,12 @@ auto SubchainData::GetPatterns(
     return imp_->GetPatterns(subchain, alloc);
 }
 
+auto SubchainData::OldestScanned() const noexcept
+    -> std::optional<block::Height>
+{
+    return imp_->OldestScanned();
+}
+
 auto SubchainData::Reorg(
     const Lock& headerOracleLock,
     MDB_txn* tx,
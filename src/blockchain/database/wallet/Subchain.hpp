@@ -73,6 +73,11 @@ public:
         MDB_txn* tx) const noexcept -> pSubchainIndex;
     auto GetPatterns(const SubchainIndex& subchain, alloc::Resource* alloc)
         const noexcept -> Patterns;
+    /// Lowest last scanned height of any subchain
+    ///
+    /// Subchains which have not been scanned count as height zero. Returns an
+    /// empty value if no subchains exist.
+    auto OldestScanned() const noexcept -> std::optional<block::Height>;
     auto Reorg(
         const Lock& headerOracleLock,
         MDB_txn* tx,
@@ -0,0 +1,89 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"                        // IWYU pragma: associated
+#include "1_Internal.hpp"                      // IWYU pragma: associated
+#include "blockchain/node/BestChainIndex.hpp"  // IWYU pragma: associated
+
+#include <algorithm>
+#include <iterator>
+
+#include "internal/util/P0330.hpp"
+
+namespace opentxs::blockchain::node
+{
+BestChainIndex::BestChainIndex() noexcept
+    : segments_()
+    , size_(0)
+{
+}
+
+auto BestChainIndex::Hash(const block::Height height) const noexcept
+    -> const block::Hash&
+{
+    static const auto blank = block::Hash{};
+
+    if ((0 > height) || (static_cast<std::size_t>(height) >= size_)) {
+
+        return blank;
+    }
+
+    const auto index = static_cast<std::size_t>(height);
+
+    return segments_[index / segment_size_]->at(index % segment_size_);
+}
+
+auto BestChainIndex::Position() const noexcept -> block::Position
+{
+    const auto height = Height();
+
+    return {height, Hash(height)};
+}
+
+auto BestChainIndex::Update(
+    const block::Height first,
+    const Vector<block::Hash>& hashes) const noexcept
+    -> std::shared_ptr<const BestChainIndex>
+{
+    const auto keep = std::min(
+        static_cast<std::size_t>(std::max<block::Height>(first, 0)), size_);
+    auto output = std::make_shared<BestChainIndex>();
+    auto& segments = output->segments_;
+    const auto full = keep / segment_size_;
+    segments.reserve(((keep + hashes.size()) / segment_size_) + 1_uz);
+    std::copy(
+        segments_.begin(),
+        std::next(segments_.begin(), full),
+        std::back_inserter(segments));
+    auto tail = std::make_shared<Segment>();
+    tail->reserve(segment_size_);
+
+    if (const auto partial = keep % segment_size_; 0_uz < partial) {
+        const auto& segment = *segments_[full];
+        std::copy(
+            segment.begin(),
+            std::next(segment.begin(), partial),
+            std::back_inserter(*tail));
+    }
+
+    for (const auto& hash : hashes) {
+        tail->emplace_back(hash);
+
+        if (segment_size_ == tail->size()) {
+            segments.emplace_back(std::move(tail));
+            tail = std::make_shared<Segment>();
+            tail->reserve(segment_size_);
+        }
+    }
+
+    if (false == tail->empty()) { segments.emplace_back(std::move(tail)); }
+
+    output->size_ = keep + hashes.size();
+
+    return output;
+}
+
+BestChainIndex::~BestChainIndex() = default;
+}  // namespace opentxs::blockchain::node
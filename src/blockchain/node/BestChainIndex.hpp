@@ -0,0 +1,55 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+#include "opentxs/blockchain/block/Hash.hpp"
+#include "opentxs/blockchain/block/Position.hpp"
+#include "opentxs/blockchain/block/Types.hpp"
+#include "opentxs/util/Container.hpp"
+
+namespace opentxs::blockchain::node
+{
+// An immutable height to hash index of the best chain
+//
+// Snapshots are never modified after publication so readers may use them
+// without locking. Update produces a new snapshot which shares every segment
+// below the modified height with the original.
+class BestChainIndex
+{
+public:
+    // Returns a null hash if the height is not in the best chain
+    auto Hash(const block::Height height) const noexcept -> const block::Hash&;
+    auto Height() const noexcept -> block::Height
+    {
+        return static_cast<block::Height>(size_) - 1;
+    }
+    auto Position() const noexcept -> block::Position;
+    // Returns a snapshot which contains the hashes of this snapshot below
+    // first followed by the supplied hashes
+    auto Update(const block::Height first, const Vector<block::Hash>& hashes)
+        const noexcept -> std::shared_ptr<const BestChainIndex>;
+
+    BestChainIndex() noexcept;
+    BestChainIndex(const BestChainIndex&) = delete;
+    BestChainIndex(BestChainIndex&&) = delete;
+    auto operator=(const BestChainIndex&) -> BestChainIndex& = delete;
+    auto operator=(BestChainIndex&&) -> BestChainIndex& = delete;
+
+    ~BestChainIndex();
+
+private:
+    static constexpr auto segment_size_ = std::size_t{4096};
+
+    using Segment = UnallocatedVector<block::Hash>;
+    using Segments = UnallocatedVector<std::shared_ptr<const Segment>>;
+
+    Segments segments_;
+    std::size_t size_;
+};
+}  // namespace opentxs::blockchain::node
@@ -0,0 +1,283 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"                       // IWYU pragma: associated
+#include "1_Internal.hpp"                     // IWYU pragma: associated
+#include "blockchain/node/CoinSelection.hpp"  // IWYU pragma: associated
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <random>
+
+#include "internal/util/LogMacros.hpp"
+#include "internal/util/P0330.hpp"
+
+namespace opentxs::blockchain::node
+{
+CoinSelection::CoinSelection(const Candidates& candidates) noexcept
+    : candidates_(sort(candidates))
+    , total_(std::accumulate(
+          candidates_.begin(),
+          candidates_.end(),
+          std::int64_t{0},
+          [](const auto lhs, const auto& rhs) { return lhs + rhs.effective_; }))
+{
+}
+
+auto CoinSelection::branch_and_bound(
+    const std::int64_t target,
+    const std::int64_t costOfChange) const noexcept -> std::optional<Selection>
+{
+    const auto count = candidates_.size();
+    auto available = total_;
+    auto value = std::int64_t{0};
+    auto current = UnallocatedVector<std::size_t>{};
+    auto best = UnallocatedVector<std::size_t>{};
+    auto bestExcess = std::numeric_limits<std::int64_t>::max();
+    current.reserve(count);
+
+    for (auto tries = 0_uz, i = 0_uz; tries < bnb_tries_; ++tries, ++i) {
+        auto backtrack{false};
+
+        if (((value + available) < target) ||
+            (value > (target + costOfChange))) {
+            backtrack = true;
+        } else if (value >= target) {
+            if (const auto excess = value - target; excess <= bestExcess) {
+                best = current;
+                bestExcess = excess;
+
+                if (0 == excess) { break; }
+            }
+
+            backtrack = true;
+        }
+
+        if (backtrack) {
+            if (current.empty()) { break; }
+
+            // NOTE return the candidates which were skipped after the most
+            // recently included candidate to the available pool, then try the
+            // branch which omits that candidate
+            for (--i; i > current.back(); --i) {
+                available += candidates_[i].effective_;
+            }
+
+            value -= candidates_[i].effective_;
+            current.pop_back();
+        } else {
+            OT_ASSERT(i < count);
+
+            const auto& candidate = candidates_[i];
+            available -= candidate.effective_;
+
+            // NOTE omitting a candidate and then including an equivalent one
+            // would only repeat a branch which has already been searched
+            const auto duplicate =
+                (false == current.empty()) && ((i - 1u) != current.back()) &&
+                (candidate.effective_ == candidates_[i - 1u].effective_);
+
+            if (false == duplicate) {
+                current.emplace_back(i);
+                value += candidate.effective_;
+            }
+        }
+    }
+
+    if (best.empty()) { return std::nullopt; }
+
+    return translate(best);
+}
+
+auto CoinSelection::InputBytes(bitcoin::block::Script::Pattern type) noexcept
+    -> std::size_t
+{
+    using Pattern = bitcoin::block::Script::Pattern;
+
+    switch (type) {
+        case Pattern::PayToWitnessPubkeyHash: {
+
+            return 68_uz;
+        }
+        case Pattern::PayToTaproot: {
+
+            return 58_uz;
+        }
+        case Pattern::PayToPubkey: {
+
+            return 114_uz;
+        }
+        case Pattern::PayToPubkeyHash:
+        default: {
+
+            return 148_uz;
+        }
+    }
+}
+
+auto CoinSelection::knapsack(const std::int64_t target) const noexcept
+    -> std::optional<Selection>
+{
+    auto larger = std::optional<std::size_t>{};
+    auto lower = UnallocatedVector<std::size_t>{};
+    auto lowerTotal = std::int64_t{0};
+
+    for (auto i = 0_uz; i < candidates_.size(); ++i) {
+        const auto value = candidates_[i].effective_;
+
+        if (value == target) {
+
+            return translate({i});
+        } else if (value > target) {
+            // NOTE candidates are sorted so the final match is the smallest
+            larger = i;
+        } else {
+            lower.emplace_back(i);
+            lowerTotal += value;
+        }
+    }
+
+    if (lowerTotal == target) { return translate(lower); }
+
+    if (lowerTotal < target) {
+        if (larger.has_value()) { return translate({larger.value()}); }
+
+        return std::nullopt;
+    }
+
+    // NOTE a fixed seed keeps the selection for a given set of outputs stable
+    auto rng = std::mt19937_64{lower.size()};
+    const auto count = lower.size();
+    auto best = UnallocatedVector<bool>(count, true);
+    auto bestTotal = lowerTotal;
+    auto included = UnallocatedVector<bool>(count);
+
+    for (auto pass = 0_uz; pass < knapsack_passes_; ++pass) {
+        if (bestTotal == target) { break; }
+
+        std::fill(included.begin(), included.end(), false);
+        auto total = std::int64_t{0};
+        auto reached{false};
+
+        // NOTE the first round includes candidates at random and the second
+        // round fills in the remaining candidates until the target is reached
+        for (auto round = 0; (round < 2) && (false == reached); ++round) {
+            for (auto n = 0_uz; n < count; ++n) {
+                const auto include =
+                    (0 == round) ? (0u == (rng() & 1u)) : (!included[n]);
+
+                if (false == include) { continue; }
+
+                const auto value = candidates_[lower[n]].effective_;
+                total += value;
+                included[n] = true;
+
+                if (total >= target) {
+                    reached = true;
+
+                    if (total < bestTotal) {
+                        bestTotal = total;
+                        best = included;
+                    }
+
+                    total -= value;
+                    included[n] = false;
+                }
+            }
+        }
+    }
+
+    if (larger.has_value() &&
+        (candidates_[larger.value()].effective_ <= bestTotal)) {
+
+        return translate({larger.value()});
+    }
+
+    auto output = UnallocatedVector<std::size_t>{};
+
+    for (auto n = 0_uz; n < count; ++n) {
+        if (best[n]) { output.emplace_back(lower[n]); }
+    }
+
+    return translate(output);
+}
+
+auto CoinSelection::largest_first(const std::int64_t target) const noexcept
+    -> std::optional<Selection>
+{
+    auto output = UnallocatedVector<std::size_t>{};
+    auto total = std::int64_t{0};
+
+    for (auto i = 0_uz; i < candidates_.size(); ++i) {
+        output.emplace_back(i);
+        total += candidates_[i].effective_;
+
+        if (total >= target) { return translate(output); }
+    }
+
+    return std::nullopt;
+}
+
+auto CoinSelection::Select(
+    const std::int64_t target,
+    const std::int64_t costOfChange) const noexcept -> std::optional<Selection>
+{
+    // NOTE a transaction must always have at least one input
+    const auto required = std::max(target, std::int64_t{1});
+
+    if (total_ < required) { return std::nullopt; }
+
+    const auto change = std::max(costOfChange, std::int64_t{0});
+
+    if (auto output = branch_and_bound(required, change); output.has_value()) {
+
+        return output;
+    }
+
+    // NOTE the remaining strategies produce a change output which must be paid
+    // for, unless every candidate is needed and the excess is left as fee
+    const auto withChange = required + change;
+    const auto fallback = (total_ < withChange) ? required : withChange;
+
+    if (candidates_.size() <= knapsack_limit_) { return knapsack(fallback); }
+
+    return largest_first(fallback);
+}
+
+auto CoinSelection::sort(const Candidates& in) noexcept -> Candidates
+{
+    auto output = Candidates{};
+    output.reserve(in.size());
+    std::copy_if(
+        in.begin(),
+        in.end(),
+        std::back_inserter(output),
+        [](const auto& candidate) { return 0 < candidate.effective_; });
+    std::stable_sort(
+        output.begin(), output.end(), [](const auto& lhs, const auto& rhs) {
+            return lhs.effective_ > rhs.effective_;
+        });
+
+    return output;
+}
+
+auto CoinSelection::translate(
+    const UnallocatedVector<std::size_t>& in) const noexcept -> Selection
+{
+    auto output = Selection{};
+    output.reserve(in.size());
+    std::transform(
+        in.begin(),
+        in.end(),
+        std::back_inserter(output),
+        [this](const auto i) { return candidates_[i].id_; });
+
+    return output;
+}
+
+CoinSelection::~CoinSelection() = default;
+}  // namespace opentxs::blockchain::node
@@ -0,0 +1,84 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+#include "opentxs/blockchain/bitcoin/block/Script.hpp"
+#include "opentxs/util/Container.hpp"
+
+namespace opentxs::blockchain::node
+{
+// Chooses a set of outputs to fund a transaction
+//
+// All values are in the smallest unit of the chain. Candidates are ranked by
+// effective value, which is the value of the output minus the fee required to
+// spend it, and candidates which cost more to spend than they are worth are
+// discarded.
+//
+// Select first attempts a branch and bound search for a set which covers the
+// target with an excess no larger than the cost of a change output. If no such
+// set exists the transaction will need a change output, so a knapsack search
+// over a bounded number of candidates looks for the set with the smallest
+// excess over the target plus the cost of change, and very large candidate
+// pools fall back to choosing the largest outputs first.
+class CoinSelection
+{
+public:
+    struct Candidate {
+        std::size_t id_{};
+        std::int64_t value_{};
+        std::int64_t effective_{};
+    };
+
+    using Candidates = UnallocatedVector<Candidate>;
+    // Indices into the original candidate vector
+    using Selection = UnallocatedVector<std::size_t>;
+
+    static constexpr auto bnb_tries_ = std::size_t{100000};
+    static constexpr auto knapsack_limit_ = std::size_t{1000};
+    static constexpr auto knapsack_passes_ = std::size_t{1000};
+
+    // Estimated size in virtual bytes of an input which spends a script
+    static auto InputBytes(bitcoin::block::Script::Pattern type) noexcept
+        -> std::size_t;
+
+    auto Count() const noexcept -> std::size_t { return candidates_.size(); }
+    // Returns std::nullopt if the candidates can not cover the target
+    auto Select(const std::int64_t target, const std::int64_t costOfChange)
+        const noexcept -> std::optional<Selection>;
+    auto Total() const noexcept -> std::int64_t { return total_; }
+
+    CoinSelection(const Candidates& candidates) noexcept;
+    CoinSelection() = delete;
+    CoinSelection(const CoinSelection&) = delete;
+    CoinSelection(CoinSelection&&) = delete;
+    auto operator=(const CoinSelection&) -> CoinSelection& = delete;
+    auto operator=(CoinSelection&&) -> CoinSelection& = delete;
+
+    ~CoinSelection();
+
+private:
+    // sorted by descending effective value
+    const Candidates candidates_;
+    const std::int64_t total_;
+
+    static auto sort(const Candidates& in) noexcept -> Candidates;
+
+    auto branch_and_bound(
+        const std::int64_t target,
+        const std::int64_t costOfChange) const noexcept
+        -> std::optional<Selection>;
+    auto knapsack(const std::int64_t target) const noexcept
+        -> std::optional<Selection>;
+    auto largest_first(const std::int64_t target) const noexcept
+        -> std::optional<Selection>;
+    auto translate(const UnallocatedVector<std::size_t>& in) const noexcept
+        -> Selection;
+};
+}  // namespace opentxs::blockchain::node
@@ -27,6 +27,13 @@ auto Config::print() const noexcept -> UnallocatedCString
            << '\n';
     output << "  * use sync server: " << print_bool(use_sync_server_) << '\n';
     output << "  * disable wallet: " << print_bool(disable_wallet_) << '\n';
+    output << "  * block cache bytes: " << block_cache_bytes_ << '\n';
+    output << "  * block prune depth: " << block_prune_depth_ << '\n';
+    output << "  * block prune bytes: " << block_prune_bytes_ << '\n';
+
+    for (const auto& path : header_snapshots_) {
+        output << "  * header snapshot: " << path << '\n';
+    }
 
     return output.str();
 }
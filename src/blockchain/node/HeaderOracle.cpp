@@ -7,16 +7,23 @@
 #include "1_Internal.hpp"                    // IWYU pragma: associated
 #include "blockchain/node/HeaderOracle.hpp"  // IWYU pragma: associated
 
+#include <boost/iostreams/device/mapped_file.hpp>
+#include <algorithm>
 #include <atomic>
+#include <cstdint>
+#include <cstring>
 #include <functional>
+#include <iterator>
 #include <stdexcept>
 #include <type_traits>
 
 #include "blockchain/node/UpdateTransaction.hpp"
+#include "internal/blockchain/Blockchain.hpp"
 #include "internal/blockchain/Params.hpp"
 #include "internal/blockchain/bitcoin/block/Factory.hpp"
 #include "internal/blockchain/block/Header.hpp"
 #include "internal/blockchain/database/Header.hpp"
+#include "internal/blockchain/node/Config.hpp"
 #include "internal/blockchain/node/Factory.hpp"
 #include "internal/util/LogMacros.hpp"
 #include "internal/util/P0330.hpp"
@@ -58,11 +65,15 @@ HeaderOracle::HeaderOracle(
     , database_(database)
     , chain_(type)
     , lock_()
+    , best_(std::make_shared<const BestChainIndex>())
 {
     auto lock = Lock{lock_};
-    const auto best = best_chain(lock);
 
-    OT_ASSERT(0 <= best.height_);
+    try {
+        *best_.lock() = load_best_chain(lock);
+    } catch (const std::exception& e) {
+        OT_FAIL_MSG(e.what());
+    }
 }
 
 auto HeaderOracle::Ancestors(
@@ -70,16 +81,16 @@ auto HeaderOracle::Ancestors(
     const block::Position& target,
     const std::size_t limit) const noexcept(false) -> Positions
 {
-    auto lock = Lock{lock_};
+    const auto snapshot = best();
+    const auto& chain = *snapshot;
     const auto check =
         std::max<block::Height>(std::min(start.height_, target.height_), 0);
-    const auto fast = is_in_best_chain(lock, target.hash_).first &&
-                      is_in_best_chain(lock, start.hash_).first &&
+    const auto fast = is_in_best_chain(chain, target.hash_).first &&
+                      is_in_best_chain(chain, start.hash_).first &&
                       (start.height_ < target.height_);
 
     if (fast) {
-        auto output = best_chain(lock, start, limit);
-        lock.unlock();
+        auto output = best_chain(chain, start, limit);
 
         while ((1 < output.size()) &&
                (output.back().height_ > target.height_)) {
@@ -161,8 +172,11 @@ auto HeaderOracle::AddCheckpoint(
 
     update.SetCheckpoint({position, requiredHash});
 
-    if (apply_checkpoint(lock, position, update)) {
-        return database_.ApplyUpdate(update);
+    if (apply_checkpoint(lock, position, update) &&
+        database_.ApplyUpdate(update)) {
+        update_best_chain(lock, update);
+
+        return true;
     } else {
 
         return false;
@@ -183,23 +197,55 @@ auto HeaderOracle::AddHeaders(
 {
     if (headers.empty()) { return false; }
 
+    // NOTE checks which do not depend on the current state of the chain run in
+    // parallel before the lock is acquired. Headers are never removed from the
+    // database so a header found here still exists once the lock is held.
+    auto invalid = std::atomic<bool>{false};
+    auto known = UnallocatedVector<std::uint8_t>(headers.size(), 0u);
+    blockchain::internal::ForEachParallel(
+        api_,
+        headers.size(),
+        [&](const std::size_t first, const std::size_t last) {
+            for (auto i = first; i < last; ++i) {
+                const auto& header = headers[i];
+
+                if ((false == bool(header)) || header->Hash().IsNull()) {
+                    invalid.store(true);
+
+                    return;
+                }
+
+                known[i] = database_.HeaderExists(header->Hash()) ? 1u : 0u;
+            }
+        });
+
+    if (invalid.load()) {
+        LogError()(OT_PRETTY_CLASS())("Invalid header").Flush();
+
+        return false;
+    }
+
     auto lock = Lock{lock_};
     auto update = UpdateTransaction{api_, database_};
 
-    for (auto& header : headers) {
-        if (false == bool(header)) {
-            LogError()(OT_PRETTY_CLASS())("Invalid header").Flush();
+    for (auto i = 0_uz; i < headers.size(); ++i) {
+        if (0u != known[i]) {
+            LogVerbose()(OT_PRETTY_CLASS())("Header already processed").Flush();
 
-            return false;
+            continue;
         }
 
-        if (false == add_header(lock, update, std::move(header))) {
+        if (false == add_header(lock, update, std::move(headers[i]))) {
 
             return false;
         }
     }
 
-    return database_.ApplyUpdate(update);
+    if (false == database_.ApplyUpdate(update)) { return false; }
+
+    update_best_chain(lock, update);
+
+    return true;
 }
 
 auto HeaderOracle::add_header(
@@ -305,40 +351,35 @@ auto HeaderOracle::apply_checkpoint(
     }
 }
 
-auto HeaderOracle::best_chain(const Lock& lock) const noexcept
-    -> block::Position
+auto HeaderOracle::best() const noexcept -> BestChainSnapshot
 {
-    return database_.CurrentBest()->Position();
+    return *best_.lock_shared();
 }
 
 auto HeaderOracle::BestChain() const noexcept -> block::Position
 {
-    auto lock = Lock{lock_};
-
-    return best_chain(lock);
+    return best()->Position();
 }
 
 auto HeaderOracle::BestChain(
     const block::Position& tip,
     const std::size_t limit) const noexcept(false) -> Positions
 {
-    auto lock = Lock{lock_};
-
-    return best_chain(lock, tip, limit);
+    return best_chain(*best(), tip, limit);
 }
 
 auto HeaderOracle::best_chain(
-    const Lock& lock,
+    const BestChainIndex& index,
     const block::Position& tip,
     const std::size_t limit) const noexcept -> Positions
 {
-    const auto [youngest, best] = common_parent(lock, tip);
+    const auto [youngest, current] = common_parent(index, tip);
     static const auto blank = block::Hash{};
     auto height = std::max<block::Height>(youngest.height_, 0);
     auto output = Positions{};
 
     // TODO allocator
-    for (auto& hash : best_hashes(lock, height, blank, 0, alloc::System())) {
+    for (auto& hash : best_hashes(index, height, blank, 0, alloc::System())) {
         output.emplace_back(height++, std::move(hash));
 
         if ((0u < limit) && (output.size() == limit)) { break; }
@@ -352,30 +393,18 @@ auto HeaderOracle::best_chain(
 auto HeaderOracle::BestHash(const block::Height height) const noexcept
     -> block::Hash
 {
-    auto lock = Lock{lock_};
-
-    return best_hash(lock, height);
-}
-
-auto HeaderOracle::best_hash(const Lock& lock, const block::Height height)
-    const noexcept -> block::Hash
-{
-    try {
-        return database_.BestBlock(height);
-    } catch (...) {
-        return blank_hash();
-    }
+    return best()->Hash(height);
 }
 
 auto HeaderOracle::BestHash(
     const block::Height height,
     const block::Position& check) const noexcept -> block::Hash
 {
-    auto lock = Lock{lock_};
+    const auto snapshot = best();
 
-    if (is_in_best_chain(lock, check)) {
+    if (is_in_best_chain(*snapshot, check)) {
 
-        return database_.BestBlock(height);
+        return snapshot->Hash(height);
     } else {
 
         return blank_hash();
@@ -389,9 +418,7 @@ auto HeaderOracle::BestHashes(
 {
     static const auto blank = block::Hash{};
 
-    auto lock = Lock{lock_};
-
-    return best_hashes(lock, start, blank, limit, alloc);
+    return best_hashes(*best(), start, blank, limit, alloc);
 }
 
 auto HeaderOracle::BestHashes(
@@ -400,9 +427,7 @@ auto HeaderOracle::BestHashes(
     const std::size_t limit,
     alloc::Resource* alloc) const noexcept -> Hashes
 {
-    auto lock = Lock{lock_};
-
-    return best_hashes(lock, start, stop, limit, alloc);
+    return best_hashes(*best(), start, stop, limit, alloc);
 }
 
 auto HeaderOracle::BestHashes(
@@ -411,23 +436,23 @@ auto HeaderOracle::BestHashes(
     const std::size_t limit,
     alloc::Resource* alloc) const noexcept -> Hashes
 {
-    auto lock = Lock{lock_};
+    const auto snapshot = best();
     auto start = 0_uz;
 
     for (const auto& hash : previous) {
-        const auto [best, height] = is_in_best_chain(lock, hash);
+        const auto [found, height] = is_in_best_chain(*snapshot, hash);
 
-        if (best) {
+        if (found) {
             start = height;
             break;
         }
     }
 
-    return best_hashes(lock, start, stop, limit, alloc);
+    return best_hashes(*snapshot, start, stop, limit, alloc);
 }
 
 auto HeaderOracle::best_hashes(
-    const Lock& lock,
+    const BestChainIndex& index,
     const block::Height start,
     const block::Hash& stop,
     const std::size_t limit,
@@ -435,26 +460,24 @@ auto HeaderOracle::best_hashes(
 {
     auto output = Hashes{alloc};
     const auto limitIsZero = (0 == limit);
-    auto current{start};
-    const auto tip = best_chain(lock);
-    block::Height last = tip.height_;
+    auto current{std::max<block::Height>(start, 0)};
+    block::Height last = index.Height();
     if (!limitIsZero) {
         const auto requestedEnd = block::Height{
             current + static_cast<block::Height>(limit) -
             static_cast<block::Height>(1)};
 
-        last = std::min<block::Height>(requestedEnd, tip.height_);
+        last = std::min<block::Height>(requestedEnd, index.Height());
     }
 
-    while (current <= last) {
-        auto hash = database_.BestBlock(current++);
-
-        // TODO this check shouldn't be necessary but BestBlock doesn't
-        // throw the exception documented in its declaration.
-        if (hash.IsNull()) { break; }
+    if (current <= last) {
+        output.reserve(static_cast<std::size_t>(last - current + 1));
+    }
 
+    while (current <= last) {
+        const auto& hash = index.Hash(current++);
         const auto stopHere = stop.IsNull() ? false : (stop == hash);
-        output.emplace_back(std::move(hash));
+        output.emplace_back(hash);
 
         if (stopHere) { break; }
     }
@@ -489,9 +512,11 @@ auto HeaderOracle::CalculateReorg(const block::Position& tip) const
 auto HeaderOracle::calculate_reorg(const Lock& lock, const block::Position& tip)
     const noexcept(false) -> Positions
 {
+    const auto snapshot = best();
+    const auto& index = *snapshot;
     auto output = Positions{};
 
-    if (is_in_best_chain(lock, tip)) { return output; }
+    if (is_in_best_chain(index, tip)) { return output; }
 
     output.emplace_back(tip);
 
@@ -516,7 +541,7 @@ auto HeaderOracle::calculate_reorg(const Lock& lock, const block::Position& tip)
 
         auto parent = block::Position{height - 1, header.ParentHash()};
 
-        if (is_in_best_chain(lock, parent)) { break; }
+        if (is_in_best_chain(index, parent)) { break; }
 
         output.emplace_back(std::move(parent));
     }
@@ -609,27 +634,25 @@ auto HeaderOracle::choose_candidate(
 auto HeaderOracle::CommonParent(const block::Position& position) const noexcept
     -> std::pair<block::Position, block::Position>
 {
-    auto lock = Lock{lock_};
-
-    return common_parent(lock, position);
+    return common_parent(*best(), position);
 }
 
 auto HeaderOracle::common_parent(
-    const Lock& lock,
+    const BestChainIndex& index,
     const block::Position& position) const noexcept
     -> std::pair<block::Position, block::Position>
 {
     const auto& database = database_;
     std::pair<block::Position, block::Position> output{
-        {0, GenesisBlockHash(chain_)}, best_chain(lock)};
-    auto& [parent, best] = output;
+        {0, GenesisBlockHash(chain_)}, index.Position()};
+    auto& [parent, tip] = output;
     auto test{position};
     auto pHeader = database.TryLoadHeader(test.hash_);
 
     if (false == bool(pHeader)) { return output; }
 
     while (0 < test.height_) {
-        if (is_in_best_chain(lock, test.hash_).first) {
+        if (is_in_best_chain(index, test.hash_).first) {
             parent = test;
 
             return output;
@@ -712,8 +735,11 @@ auto HeaderOracle::DeleteCheckpoint() noexcept -> bool
     const auto position = update.Checkpoint().height_;
     update.ClearCheckpoint();
 
-    if (apply_checkpoint(lock, position, update)) {
-        return database_.ApplyUpdate(update);
+    if (apply_checkpoint(lock, position, update) &&
+        database_.ApplyUpdate(update)) {
+        update_best_chain(lock, update);
+
+        return true;
     } else {
 
         return false;
@@ -727,6 +753,72 @@ auto HeaderOracle::evaluate_candidate(
     return candidate.Work() > current.Work();
 }
 
+auto HeaderOracle::ExportSnapshot(
+    const block::Height last,
+    const AllocateOutput destination) const noexcept -> bool
+{
+    static constexpr auto raw = 80_uz;
+    const auto index = best();
+
+    if ((1 > last) || (last > index->Height())) {
+        LogError()(OT_PRETTY_CLASS())("Invalid height").Flush();
+
+        return false;
+    }
+
+    if (false == bool(destination)) {
+        LogError()(OT_PRETTY_CLASS())("Invalid output allocator").Flush();
+
+        return false;
+    }
+
+    const auto count = static_cast<std::size_t>(last);
+    const auto size = sizeof(SnapshotPrefix) + (count * raw);
+    auto out = destination(size);
+
+    if (false == out.valid(size)) {
+        LogError()(OT_PRETTY_CLASS())("Failed to allocate output").Flush();
+
+        return false;
+    }
+
+    auto prefix = SnapshotPrefix{};
+    prefix.magic_ = SnapshotPrefix::magic_value_;
+    prefix.version_ = SnapshotPrefix::version_value_;
+    prefix.chain_ = static_cast<std::uint32_t>(chain_);
+    prefix.count_ = static_cast<std::uint32_t>(count);
+    std::memcpy(out.data(), &prefix, sizeof(prefix));
+    auto* const headers = std::next(out.as<char>(), sizeof(prefix));
+    auto failed = std::atomic<bool>{false};
+    blockchain::internal::ForEachParallel(
+        api_,
+        count,
+        [&](const std::size_t first, const std::size_t end) {
+            for (auto i = first; i < end; ++i) {
+                const auto height = static_cast<block::Height>(i + 1);
+                const auto header =
+                    database_.TryLoadHeader(index->Hash(height));
+                auto* const position = std::next(headers, i * raw);
+
+                if ((false == bool(header)) ||
+                    (false == header->Serialize(
+                                  preallocated(raw, position), true))) {
+                    failed.store(true);
+
+                    return;
+                }
+            }
+        });
+
+    if (failed.load()) {
+        LogError()(OT_PRETTY_CLASS())("Failed to serialize header").Flush();
+
+        return false;
+    }
+
+    return true;
+}
+
 auto HeaderOracle::GetDefaultCheckpoint() const noexcept -> CheckpointData
 {
     const auto& checkpoint = params::Chains().at(chain_).checkpoint_;
@@ -757,26 +849,247 @@ auto HeaderOracle::GetCheckpoint() const noexcept -> block::Position
 auto HeaderOracle::GetPosition(const block::Height height) const noexcept
     -> block::Position
 {
-    auto lock = Lock{lock_};
-
-    return get_position(lock, height);
+    return get_position(*best(), height);
 }
 
-auto HeaderOracle::get_position(const Lock& lock, const block::Height height)
-    const noexcept -> block::Position
+auto HeaderOracle::get_position(
+    const BestChainIndex& index,
+    const block::Height height) const noexcept -> block::Position
 {
-    auto hash = best_hash(lock, height);
+    const auto& hash = index.Hash(height);
 
     if (hash == blank_hash()) {
 
         return blank_position();
     } else {
 
-        return {height, std::move(hash)};
+        return {height, hash};
+    }
+}
+
+auto HeaderOracle::ImportSnapshot(const ReadView snapshot) noexcept -> bool
+{
+    return ImportSnapshot(snapshot, GetDefaultCheckpoint());
+}
+
+auto HeaderOracle::ImportSnapshot(
+    const ReadView snapshot,
+    const CheckpointData& trusted) noexcept -> bool
+{
+    static constexpr auto raw = 80_uz;
+    auto prefix = SnapshotPrefix{};
+
+    if (sizeof(prefix) > snapshot.size()) {
+        LogError()(OT_PRETTY_CLASS())("Snapshot is too short").Flush();
+
+        return false;
+    }
+
+    std::memcpy(&prefix, snapshot.data(), sizeof(prefix));
+
+    if ((SnapshotPrefix::magic_value_ != prefix.magic_.value()) ||
+        (SnapshotPrefix::version_value_ != prefix.version_.value())) {
+        LogError()(OT_PRETTY_CLASS())("Unknown snapshot format").Flush();
+
+        return false;
+    }
+
+    if (static_cast<std::uint32_t>(chain_) != prefix.chain_.value()) {
+        LogError()(OT_PRETTY_CLASS())("Snapshot is for the wrong chain")
+            .Flush();
+
+        return false;
+    }
+
+    const auto count = std::size_t{prefix.count_.value()};
+
+    if ((sizeof(prefix) + (count * raw)) != snapshot.size()) {
+        LogError()(OT_PRETTY_CLASS())("Invalid snapshot size").Flush();
+
+        return false;
+    }
+
+    const auto& [height, checkpoint, previous, filter] = trusted;
+
+    if ((1 > height) || (static_cast<std::size_t>(height) > count)) {
+        LogError()(OT_PRETTY_CLASS())("Snapshot does not reach the checkpoint")
+            .Flush();
+
+        return false;
+    }
+
+    // NOTE headers past the checkpoint are not anchored to anything trusted so
+    // they are left for the normal sync process
+    const auto target = static_cast<std::size_t>(height);
+    const auto headers = snapshot.substr(sizeof(prefix));
+    // NOTE the snapshot is verified against the checkpoint before anything is
+    // written and parsed a second time for import so that no more than one
+    // batch of headers is held in memory at a time
+    const auto verified = [&, &expected = checkpoint] {
+        auto parent = GenesisBlockHash(chain_);
+
+        for (auto first = 0_uz; first < target; first += snapshot_batch_) {
+            const auto last = std::min(first + snapshot_batch_, target);
+            const auto batch = parse_snapshot(headers, first, last);
+
+            if (batch.empty()) {
+                LogError()(OT_PRETTY_CLASS())(
+                    "Snapshot contains an invalid header")
+                    .Flush();
+
+                return false;
+            }
+
+            for (const auto& header : batch) {
+                if (header->ParentHash() != parent) {
+                    LogError()(OT_PRETTY_CLASS())(
+                        "Snapshot is not hash chained")
+                        .Flush();
+
+                    return false;
+                }
+
+                parent = header->Hash();
+            }
+        }
+
+        if (parent != expected) {
+            LogError()(OT_PRETTY_CLASS())("Snapshot does not match checkpoint")
+                .Flush();
+
+            return false;
+        }
+
+        return true;
+    }();
+
+    if (false == verified) { return false; }
+
+    auto lock = Lock{lock_};
+
+    if (0 != best()->Height()) {
+        LogError()(OT_PRETTY_CLASS())(
+            "Snapshots may only be imported into an empty chain")
+            .Flush();
+
+        return false;
+    }
+
+    auto parent = database_.TryLoadHeader(GenesisBlockHash(chain_));
+
+    OT_ASSERT(parent);
+
+    const auto current = database_.CurrentCheckpoint();
+
+    // NOTE every batch is committed before the next one is parsed. If a batch
+    // fails the batches before it remain as a valid prefix of the best chain
+    // and the rest of the chain is left to the normal sync process.
+    for (auto first = 0_uz; first < target; first += snapshot_batch_) {
+        const auto last = std::min(first + snapshot_batch_, target);
+        auto batch = parse_snapshot(headers, first, last);
+
+        if (batch.empty()) {
+            LogError()(OT_PRETTY_CLASS())("Failed to parse snapshot").Flush();
+
+            return false;
+        }
+
+        try {
+            const block::Header* previous = parent.get();
+
+            for (auto& header : batch) {
+                auto& child = header->Internal();
+                child.InheritWork(previous->Work());
+                child.InheritState(*previous);
+                child.InheritHeight(*previous);
+                child.CompareToCheckpoint(current);
+
+                if (child.IsBlacklisted()) {
+                    throw std::runtime_error{
+                        "Snapshot conflicts with checkpoint"};
+                }
+
+                previous = header.get();
+            }
+        } catch (const std::exception& e) {
+            LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+
+            return false;
+        }
+
+        if (false == database_.ImportHeaders(batch)) {
+            LogError()(OT_PRETTY_CLASS())("Snapshot import stopped at height ")(
+                first)
+                .Flush();
+
+            return false;
+        }
+
+        auto hashes = Vector<block::Hash>{};
+        hashes.reserve(batch.size());
+
+        for (const auto& header : batch) {
+            hashes.emplace_back(header->Hash());
+        }
+
+        *best_.lock() =
+            best()->Update(static_cast<block::Height>(first + 1_uz), hashes);
+        parent = std::move(batch.back());
+    }
+
+    LogConsole()(print(chain_))(": imported ")(target)(
+        " headers from snapshot")
+        .Flush();
+
+    return true;
+}
+
+auto HeaderOracle::import_snapshots(const Set<CString>& paths) noexcept
+    -> void
+{
+    for (const auto& path : paths) {
+        if (0 != BestChain().height_) { return; }
+
+        try {
+            // NOTE the snapshot is mapped rather than read so that the file
+            // contents are never copied to the heap
+            const auto file =
+                boost::iostreams::mapped_file_source{path.c_str()};
+            const auto bytes = ReadView{file.data(), file.size()};
+            auto prefix = SnapshotPrefix{};
+
+            if (sizeof(prefix) > bytes.size()) {
+                throw std::runtime_error{"file is too short"};
+            }
+
+            std::memcpy(&prefix, bytes.data(), sizeof(prefix));
+
+            // NOTE one file is configured for each chain which has a snapshot
+            // so files for other chains are expected here
+            if (static_cast<std::uint32_t>(chain_) != prefix.chain_.value()) {
+                continue;
+            }
+
+            LogConsole()(print(chain_))(": importing header snapshot from ")(
+                path)
+                .Flush();
+
+            if (ImportSnapshot(bytes)) { return; }
+        } catch (const std::exception& e) {
+            LogError()(OT_PRETTY_CLASS())(print(chain_))(
+                ": unable to read header snapshot ")(path)(": ")(e.what())
+                .Flush();
+        }
     }
 }
 
-auto HeaderOracle::Init() noexcept -> void
+auto HeaderOracle::Init(const node::internal::Config& config) noexcept -> void
+{
+    init_checkpoint();
+    import_snapshots(config.header_snapshots_);
+}
+
+auto HeaderOracle::init_checkpoint() noexcept -> void
 {
     const auto& null = blank_position();
     const auto existingCheckpoint = GetCheckpoint();
@@ -856,17 +1169,13 @@ auto HeaderOracle::initialize_candidate(
 
 auto HeaderOracle::IsInBestChain(const block::Hash& hash) const noexcept -> bool
 {
-    auto lock = Lock{lock_};
-
-    return is_in_best_chain(lock, hash).first;
+    return is_in_best_chain(*best(), hash).first;
 }
 
 auto HeaderOracle::IsInBestChain(const block::Position& position) const noexcept
     -> bool
 {
-    auto lock = Lock{lock_};
-
-    return is_in_best_chain(lock, position.height_, position.hash_);
+    return is_in_best_chain(*best(), position.height_, position.hash_);
 }
 
 auto HeaderOracle::is_disconnected(
@@ -883,8 +1192,9 @@ auto HeaderOracle::is_disconnected(
     }
 }
 
-auto HeaderOracle::is_in_best_chain(const Lock& lock, const block::Hash& hash)
-    const noexcept -> std::pair<bool, block::Height>
+auto HeaderOracle::is_in_best_chain(
+    const BestChainIndex& index,
+    const block::Hash& hash) const noexcept -> std::pair<bool, block::Height>
 {
     const auto pHeader = database_.TryLoadHeader(hash);
 
@@ -892,28 +1202,55 @@ auto HeaderOracle::is_in_best_chain(const Lock& lock, const block::Hash& hash)
 
     const auto& header = *pHeader;
 
-    return {is_in_best_chain(lock, header.Height(), hash), header.Height()};
+    return {is_in_best_chain(index, header.Height(), hash), header.Height()};
 }
 
 auto HeaderOracle::is_in_best_chain(
-    const Lock& lock,
+    const BestChainIndex& index,
     const block::Position& position) const noexcept -> bool
 {
-    return is_in_best_chain(lock, position.height_, position.hash_);
+    return is_in_best_chain(index, position.height_, position.hash_);
 }
 
 auto HeaderOracle::is_in_best_chain(
-    const Lock& lock,
+    const BestChainIndex& index,
     const block::Height height,
     const block::Hash& hash) const noexcept -> bool
 {
-    try {
-        return hash == database_.BestBlock(height);
+    return (false == hash.IsNull()) && (hash == index.Hash(height));
+}
 
-    } catch (...) {
+auto HeaderOracle::load_best_chain(const Lock&) const noexcept(false)
+    -> BestChainSnapshot
+{
+    const auto tip = database_.CurrentBest()->Height();
 
-        return false;
+    if (0 > tip) { throw std::runtime_error{"Invalid best chain tip"}; }
+
+    auto hashes = database_.BestChain();
+
+    if (hashes.size() > static_cast<std::size_t>(tip + 1)) {
+        hashes.resize(static_cast<std::size_t>(tip + 1));
     }
+
+    auto snapshot = BestChainIndex{}.Update(0, hashes);
+
+    // NOTE fall back to individual lookups if the table scan was incomplete
+    if (snapshot->Height() < tip) {
+        hashes.clear();
+
+        for (auto h = snapshot->Height() + 1; h <= tip; ++h) {
+            hashes.emplace_back(database_.BestBlock(h));
+        }
+
+        snapshot = snapshot->Update(snapshot->Height() + 1, hashes);
+    }
+
+    if (tip != snapshot->Height()) {
+        throw std::runtime_error{"Incomplete best chain"};
+    }
+
+    return snapshot;
 }
 
 auto HeaderOracle::LoadBitcoinHeader(const block::Hash& hash) const noexcept
@@ -928,12 +1265,45 @@ auto HeaderOracle::LoadHeader(const block::Hash& hash) const noexcept
     return database_.TryLoadHeader(hash);
 }
 
+auto HeaderOracle::parse_snapshot(
+    const ReadView headers,
+    const std::size_t first,
+    const std::size_t last) const noexcept -> SnapshotHeaders
+{
+    static constexpr auto raw = 80_uz;
+    auto output = SnapshotHeaders(last - first);
+    auto invalid = std::atomic<bool>{false};
+    blockchain::internal::ForEachParallel(
+        api_,
+        output.size(),
+        [&](const std::size_t begin, const std::size_t end) {
+            for (auto i = begin; i < end; ++i) {
+                auto header = factory::BitcoinBlockHeader(
+                    api_, chain_, headers.substr((first + i) * raw, raw));
+
+                if ((false == bool(header)) || header->Hash().IsNull()) {
+                    invalid.store(true);
+
+                    return;
+                }
+
+                output[i] = std::move(header);
+            }
+        },
+        64_uz);
+
+    if (invalid.load()) { output.clear(); }
+
+    return output;
+}
+
 auto HeaderOracle::ProcessSyncData(
     block::Hash& prior,
     Vector<block::Hash>& hashes,
     const network::p2p::Data& data) noexcept -> std::size_t
 {
     auto output = 0_uz;
+    auto lock = Lock{lock_, std::defer_lock};
     auto update = UpdateTransaction{api_, database_};
 
     try {
@@ -943,20 +1313,35 @@ auto HeaderOracle::ProcessSyncData(
             throw std::runtime_error{"No blocks in sync data"};
         }
 
-        auto lock = Lock{lock_};
+        // NOTE parsing, hashing, and proof of work validation do not depend on
+        // the state of the chain so they run in parallel before the lock is
+        // acquired
+        auto parsed =
+            UnallocatedVector<std::unique_ptr<bitcoin::block::Header>>{};
+        parsed.resize(blocks.size());
+        blockchain::internal::ForEachParallel(
+            api_,
+            blocks.size(),
+            [&](const std::size_t first, const std::size_t last) {
+                for (auto i = first; i < last; ++i) {
+                    const auto& block = blocks[i];
+                    parsed[i] = factory::BitcoinBlockHeader(
+                        api_, block.Chain(), block.Header());
+                }
+            },
+            64_uz);
+        lock.lock();
+        const auto snapshot = best();
         block::Hash previous{};
         const auto height = blocks.front().Height();
         if (0 < height) {
-            const auto rc = prior.Assign(database_.BestBlock(height - 1));
+            const auto rc = prior.Assign(snapshot->Hash(height - 1));
             OT_ASSERT(rc);
 
             previous = prior;
         }
 
-        for (const auto& block : blocks) {
-            auto pHeader = factory::BitcoinBlockHeader(
-                api_, block.Chain(), block.Header());
-
+        for (auto& pHeader : parsed) {
             if (false == bool(pHeader)) {
                 throw std::runtime_error{"Invalid header"};
             }
@@ -969,7 +1354,7 @@ auto HeaderOracle::ProcessSyncData(
 
             auto hash = block::Hash{header.Hash()};
 
-            if (false == is_in_best_chain(lock, hash).first) {
+            if (false == is_in_best_chain(*snapshot, hash).first) {
                 if (false == add_header(lock, update, std::move(pHeader))) {
                     throw std::runtime_error{"Failed to process header"};
                 }
@@ -983,9 +1368,13 @@ auto HeaderOracle::ProcessSyncData(
         LogVerbose()(OT_PRETTY_CLASS())(e.what()).Flush();
     }
 
+    if (false == lock.owns_lock()) { lock.lock(); }
+
     if ((0u < output) && database_.ApplyUpdate(update)) {
         OT_ASSERT(output == hashes.size());
 
+        update_best_chain(lock, update);
+
         return output;
     } else {
 
@@ -1034,4 +1423,67 @@ auto HeaderOracle::Siblings() const noexcept -> UnallocatedSet<block::Hash>
 
     return database_.SiblingHashes();
 }
+
+auto HeaderOracle::update_best_chain(
+    const Lock& lock,
+    const UpdateTransaction& update) noexcept -> void
+{
+    const auto& changed = update.BestChain();
+
+    if ((false == update.HaveReorg()) && changed.empty()) { return; }
+
+    auto current = best();
+    auto first = current->Height() + 1;
+
+    if (update.HaveReorg()) {
+        first = std::min(first, update.ReorgParent().height_ + 1);
+    }
+
+    if (false == changed.empty()) {
+        first = std::min(first, changed.cbegin()->first);
+    }
+
+    first = std::max<block::Height>(first, 0);
+
+    try {
+        const auto tip = database_.CurrentBest()->Height();
+        auto hashes = Vector<block::Hash>{};
+
+        if (first <= tip) {
+            hashes.reserve(static_cast<std::size_t>(tip - first + 1));
+        }
+
+        for (auto height = first; height <= tip; ++height) {
+            if (auto i = changed.find(height); changed.end() != i) {
+                hashes.emplace_back(i->second);
+            } else {
+                hashes.emplace_back(database_.BestBlock(height));
+            }
+        }
+
+        auto next = current->Update(first, hashes);
+
+        if (tip != next->Height()) {
+            throw std::runtime_error{"Best chain index does not match tip"};
+        }
+
+        *best_.lock() = std::move(next);
+
+        return;
+    } catch (const std::exception& e) {
+        LogError()(OT_PRETTY_CLASS())(print(chain_))(
+            ": failed to update best chain index: ")(e.what())
+            .Flush();
+    }
+
+    // NOTE an incremental update only reads the heights which changed so
+    // fall back to rebuilding the entire index from the database
+    try {
+        *best_.lock() = load_best_chain(lock);
+    } catch (const std::exception& e) {
+        LogError()(OT_PRETTY_CLASS())(print(chain_))(
+            ": failed to rebuild best chain index: ")(e.what())
+            .Flush();
+    }
+}
 }  // namespace opentxs::blockchain::node::implementation
@@ -5,14 +5,19 @@
 
 #pragma once
 
+#include <cs_shared_guarded.h>
+#include <boost/endian/buffers.hpp>
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include <iosfwd>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <tuple>
 #include <utility>
 
+#include "blockchain/node/BestChainIndex.hpp"
 #include "internal/blockchain/node/HeaderOracle.hpp"
 #include "internal/util/Mutex.hpp"
 #include "opentxs/blockchain/BlockchainType.hpp"
@@ -24,6 +29,7 @@
 #include "opentxs/blockchain/node/HeaderOracle.hpp"
 #include "opentxs/core/Data.hpp"
 #include "opentxs/util/Allocator.hpp"
+#include "opentxs/util/Bytes.hpp"
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/Pimpl.hpp"
 
@@ -119,6 +125,9 @@ public:
     }
     auto CommonParent(const block::Position& position) const noexcept
         -> std::pair<block::Position, block::Position> final;
+    auto ExportSnapshot(
+        const block::Height last,
+        const AllocateOutput destination) const noexcept -> bool final;
     auto GetCheckpoint() const noexcept -> block::Position final;
     auto GetDefaultCheckpoint() const noexcept -> CheckpointData final;
     auto GetMutex() const noexcept -> std::mutex& final { return lock_; }
@@ -127,7 +136,7 @@ public:
     auto GetPosition(const Lock& lock, const block::Height height)
         const noexcept -> block::Position final
     {
-        return get_position(lock, height);
+        return get_position(*best(), height);
     }
     auto Internal() const noexcept -> const internal::HeaderOracle& final
     {
@@ -151,7 +160,11 @@ public:
     auto AddHeaders(UnallocatedVector<std::unique_ptr<block::Header>>&) noexcept
         -> bool final;
     auto DeleteCheckpoint() noexcept -> bool final;
-    auto Init() noexcept -> void final;
+    auto ImportSnapshot(const ReadView snapshot) noexcept -> bool final;
+    auto ImportSnapshot(
+        const ReadView snapshot,
+        const CheckpointData& trusted) noexcept -> bool final;
+    auto Init(const node::internal::Config& config) noexcept -> void final;
     auto Internal() noexcept -> internal::HeaderOracle& final { return *this; }
     auto ProcessSyncData(
         block::Hash& prior,
@@ -175,27 +188,45 @@ private:
         bool blacklisted_{false};
         UnallocatedDeque<block::Position> chain_{};
     };
+    // Precedes the raw headers in a snapshot, which start at height 1
+    struct SnapshotPrefix {
+        static constexpr auto magic_value_ = std::uint32_t{0x5348544f};
+        static constexpr auto version_value_ = std::uint32_t{1};
+
+        boost::endian::little_uint32_buf_t magic_;
+        boost::endian::little_uint32_buf_t version_;
+        boost::endian::little_uint32_buf_t chain_;
+        boost::endian::little_uint32_buf_t count_;
+    };
 
     using Candidates = UnallocatedVector<Candidate>;
+    using SnapshotHeaders = UnallocatedVector<std::unique_ptr<block::Header>>;
+    using BestChainSnapshot = std::shared_ptr<const BestChainIndex>;
+    using GuardedBestChain =
+        libguarded::shared_guarded<BestChainSnapshot, std::shared_mutex>;
+
+    // NOTE the number of snapshot headers held in memory at once
+    static constexpr auto snapshot_batch_ = std::size_t{25000};
 
     const api::Session& api_;
     database::Header& database_;
     const blockchain::Type chain_;
     mutable std::mutex lock_;
+    // NOTE replaced only while lock_ is held so that writers always observe
+    // the snapshot which matches the database
+    GuardedBestChain best_;
 
     static auto evaluate_candidate(
         const block::Header& current,
         const block::Header& candidate) noexcept -> bool;
 
-    auto best_chain(const Lock& lock) const noexcept -> block::Position;
+    auto best() const noexcept -> BestChainSnapshot;
     auto best_chain(
-        const Lock& lock,
+        const BestChainIndex& index,
         const block::Position& tip,
         const std::size_t limit) const noexcept -> Positions;
-    auto best_hash(const Lock& lock, const block::Height height) const noexcept
-        -> block::Hash;
     auto best_hashes(
-        const Lock& lock,
+        const BestChainIndex& index,
         const block::Height start,
         const block::Hash& stop,
         const std::size_t limit,
@@ -204,18 +235,30 @@ private:
     auto blank_position() const noexcept -> const block::Position&;
     auto calculate_reorg(const Lock& lock, const block::Position& tip) const
         noexcept(false) -> Positions;
-    auto common_parent(const Lock& lock, const block::Position& position)
-        const noexcept -> std::pair<block::Position, block::Position>;
-    auto get_position(const Lock& lock, const block::Height height)
+    auto common_parent(
+        const BestChainIndex& index,
+        const block::Position& position) const noexcept
+        -> std::pair<block::Position, block::Position>;
+    auto get_position(const BestChainIndex& index, const block::Height height)
         const noexcept -> block::Position;
-    auto is_in_best_chain(const Lock& lock, const block::Hash& hash)
+    auto is_in_best_chain(const BestChainIndex& index, const block::Hash& hash)
         const noexcept -> std::pair<bool, block::Height>;
-    auto is_in_best_chain(const Lock& lock, const block::Position& position)
-        const noexcept -> bool;
     auto is_in_best_chain(
-        const Lock& lock,
+        const BestChainIndex& index,
+        const block::Position& position) const noexcept -> bool;
+    auto is_in_best_chain(
+        const BestChainIndex& index,
         const block::Height height,
         const block::Hash& hash) const noexcept -> bool;
+    // Builds a snapshot of the entire best chain from the database
+    auto load_best_chain(const Lock& lock) const noexcept(false)
+        -> BestChainSnapshot;
+    // Parses the raw snapshot headers in [first, last). Returns an empty
+    // vector if any header is invalid.
+    auto parse_snapshot(
+        const ReadView headers,
+        const std::size_t first,
+        const std::size_t last) const noexcept -> SnapshotHeaders;
 
     auto add_header(
         const Lock& lock,
@@ -241,6 +284,9 @@ private:
         const UpdateTransaction& update,
         const block::Header& parent,
         block::Header& child) noexcept -> bool;
+    // Imports the first readable snapshot file which belongs to this chain
+    auto import_snapshots(const Set<CString>& paths) noexcept -> void;
+    auto init_checkpoint() noexcept -> void;
     static auto initialize_candidate(
         const Lock& lock,
         const block::Header& best,
@@ -252,6 +298,9 @@ private:
     static auto is_disconnected(
         const block::Hash& parent,
         UpdateTransaction& update) noexcept -> const block::Header*;
+    auto update_best_chain(
+        const Lock& lock,
+        const UpdateTransaction& update) noexcept -> void;
     static auto stage_candidate(
         const Lock& lock,
         const block::Header& best,
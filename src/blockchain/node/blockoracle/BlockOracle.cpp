@@ -16,9 +16,11 @@
 #include "blockchain/node/blockoracle/BlockBatch.hpp"
 #include "blockchain/node/blockoracle/BlockDownloader.hpp"
 #include "internal/blockchain/database/Types.hpp"
+#include "internal/blockchain/node/Config.hpp"
 #include "internal/blockchain/node/Factory.hpp"
 #include "internal/network/zeromq/Context.hpp"
 #include "internal/util/LogMacros.hpp"
+#include "internal/util/P0330.hpp"
 #include "opentxs/api/session/Session.hpp"
 #include "opentxs/blockchain/Types.hpp"
 #include "opentxs/network/zeromq/Context.hpp"
@@ -28,14 +30,17 @@
 #include "opentxs/util/Allocator.hpp"
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/Log.hpp"
+#include "opentxs/util/Time.hpp"
 #include "opentxs/util/WorkType.hpp"
 #include "util/ScopeGuard.hpp"
 #include "util/Work.hpp"
+#include "util/tuning.hpp"
 
 namespace opentxs::factory
 {
 auto BlockOracle(
     const api::Session& api,
+    const blockchain::node::internal::Config& config,
     const blockchain::node::internal::Manager& node,
     const blockchain::node::HeaderOracle& header,
     blockchain::database::Block& db,
@@ -53,6 +58,7 @@ auto BlockOracle(
     return boost::allocate_shared<ReturnType>(
         alloc::PMR<ReturnType>{zmq.Alloc(batchID)},
         api,
+        config,
         node,
         header,
         db,
@@ -87,12 +93,36 @@ auto print(BlockOracleJobs state) noexcept -> std::string_view
         OT_FAIL;
     }
 }
+
+auto print(BlockCacheConsumer consumer) noexcept -> std::string_view
+{
+    using namespace std::literals;
+
+    try {
+        static const auto map = Map<BlockCacheConsumer, std::string_view>{
+            {BlockCacheConsumer::unknown, "unknown"sv},
+            {BlockCacheConsumer::wallet, "wallet"sv},
+            {BlockCacheConsumer::filter_oracle, "filter oracle"sv},
+            {BlockCacheConsumer::peer, "peer"sv},
+            {BlockCacheConsumer::manager, "manager"sv},
+        };
+
+        return map.at(consumer);
+    } catch (...) {
+        LogError()(__FUNCTION__)(": invalid BlockCacheConsumer: ")(
+            static_cast<int>(consumer))
+            .Flush();
+
+        OT_FAIL;
+    }
+}
 }  // namespace opentxs::blockchain::node
 
 namespace opentxs::blockchain::node::internal
 {
 BlockOracle::Imp::Imp(
     const api::Session& api,
+    const internal::Config& config,
     const internal::Manager& node,
     const node::HeaderOracle& header,
     database::Block& db,
@@ -129,6 +159,8 @@ BlockOracle::Imp::Imp(
     , api_(api)
     , node_(node)
     , db_(db)
+    , prune_depth_(config.block_prune_depth_)
+    , prune_bytes_(config.block_prune_bytes_)
     , submit_endpoint_(std::move(submitEndpoint))
     , validator_(get_validator(chain, header))
     , block_downloader_([&]() -> std::unique_ptr<blockoracle::BlockDownloader> {
@@ -139,13 +171,16 @@ BlockOracle::Imp::Imp(
         return std::make_unique<blockoracle::BlockDownloader>(
             api_, db, header, node_, chain, parent);
     }())
-    , cache_(api, node, db, chain, alloc)
+    , cache_(api, config, node, db, chain, alloc)
+    , last_prune_()
+    , last_compact_()
 {
     OT_ASSERT(validator_);
 }
 
 BlockOracle::Imp::Imp(
     const api::Session& api,
+    const internal::Config& config,
     const internal::Manager& node,
     const node::HeaderOracle& header,
     database::Block& db,
@@ -154,6 +189,7 @@ BlockOracle::Imp::Imp(
     const network::zeromq::BatchID batch,
     allocator_type alloc) noexcept
     : Imp(api,
+          config,
           node,
           header,
           db,
@@ -165,6 +201,24 @@ BlockOracle::Imp::Imp(
 {
 }
 
+auto BlockOracle::Imp::compact() noexcept -> bool
+{
+    const auto now = Clock::now();
+
+    if ((now - last_compact_) < compact_interval_) { return false; }
+
+    last_compact_ = now;
+    const auto count = db_.CompactStorage(compact_batch_);
+
+    if (compact_batch_ > count) { return false; }
+
+    // NOTE more items remain to be moved so the rate limit does not apply to
+    // the next pass
+    last_compact_ = {};
+
+    return true;
+}
+
 auto BlockOracle::Imp::do_shutdown() noexcept -> void
 {
     if (block_downloader_) { block_downloader_->Shutdown(); }
@@ -213,13 +267,30 @@ auto BlockOracle::Imp::Heartbeat() const noexcept -> void
     trigger();
 
     if (block_downloader_) { block_downloader_->Heartbeat(); }
+
+    const auto stats = CacheStatistics();
+    LogTrace()(OT_PRETTY_CLASS())(name_)(" block cache: ")(stats.blocks_)(
+        " blocks, ")(stats.bytes_)(" of ")(stats.limit_)(" bytes (")(
+        stats.recent_bytes_)(" recent, ")(stats.frequent_bytes_)(
+        " frequent, ")(stats.recent_target_)(" recent target), ")(
+        stats.evictions_)(" evictions")
+        .Flush();
+
+    for (const auto& [consumer, data] : stats.consumers_) {
+        LogTrace()(OT_PRETTY_CLASS())(name_)(" block cache consumer ")(
+            print(consumer))(": ")(data.hits_)(" hits, ")(data.misses_)(
+            " misses, ")(data.hit_bytes_)(" bytes served, ")(
+            data.loaded_bytes_)(" bytes loaded")
+            .Flush();
+    }
 }
 
-auto BlockOracle::Imp::LoadBitcoin(const block::Hash& block) const noexcept
-    -> BitcoinBlockResult
+auto BlockOracle::Imp::LoadBitcoin(
+    const block::Hash& block,
+    const BlockCacheConsumer consumer) const noexcept -> BitcoinBlockResult
 {
     tdiag("LoadBitcoinH before cache");
-    auto output = cache_.lock()->Request(block);
+    auto output = cache_.lock()->Request(block, consumer);
     tdiag("LoadBitcoinH after cache");
     trigger();
 
@@ -227,10 +298,11 @@ auto BlockOracle::Imp::LoadBitcoin(const block::Hash& block) const noexcept
 }
 
 auto BlockOracle::Imp::LoadBitcoin(
-    const Vector<block::Hash>& hashes) const noexcept -> BitcoinBlockResults
+    const Vector<block::Hash>& hashes,
+    const BlockCacheConsumer consumer) const noexcept -> BitcoinBlockResults
 {
     tdiag("LoadBitcoinV before cache");
-    auto output = cache_.lock()->Request(hashes);
+    auto output = cache_.lock()->Request(hashes, consumer);
     tdiag("LoadBitcoinV after cache");
     trigger();
 
@@ -239,6 +311,35 @@ auto BlockOracle::Imp::LoadBitcoin(
     return output;
 }
 
+auto BlockOracle::Imp::load_prefetched() noexcept -> bool
+{
+    for (auto n = 0_uz; n < prefetch_batch_; ++n) {
+        const auto next = cache_.lock()->NextPrefetch();
+
+        if (false == next.has_value()) { return false; }
+
+        const auto& hash = next.value();
+        // NOTE storage is read without holding the cache lock so that other
+        // threads may continue to request blocks in the meantime
+        auto block = db_.BlockLoadBitcoin(hash);
+        cache_.lock()->FinishPrefetch(hash, std::move(block));
+    }
+
+    return cache_.lock_shared()->HavePrefetch();
+}
+
+auto BlockOracle::Imp::Prefetch(
+    const Vector<block::Hash>& hashes,
+    const BlockCacheConsumer consumer) const noexcept -> BitcoinBlockResults
+{
+    auto output = cache_.lock()->Prefetch(hashes, consumer);
+    trigger();
+
+    OT_ASSERT(hashes.size() == output.size());
+
+    return output;
+}
+
 auto BlockOracle::Imp::to_str(Work w) const noexcept -> std::string
 {
     return std::string(print(w));
@@ -295,6 +396,26 @@ auto BlockOracle::Imp::StartDownloader() noexcept -> void
     pipeline_.Push(MakeWork(Work::start_downloader));
 }
 
+auto BlockOracle::Imp::prune() noexcept -> bool
+{
+    if ((0_uz == prune_depth_) && (0_uz == prune_bytes_)) { return false; }
+
+    const auto now = Clock::now();
+
+    if ((now - last_prune_) < prune_interval_) { return false; }
+
+    last_prune_ = now;
+    const auto count = db_.BlockPrune(prune_depth_, prune_bytes_, prune_batch_);
+
+    if (prune_batch_ > count) { return false; }
+
+    // NOTE more blocks remain to be pruned so the rate limit does not apply to
+    // the next pass
+    last_prune_ = {};
+
+    return true;
+}
+
 auto BlockOracle::Imp::SubmitBlock(const ReadView in) const noexcept -> void
 {
     auto work = MakeWork(Task::process_block);
@@ -304,9 +425,18 @@ auto BlockOracle::Imp::SubmitBlock(const ReadView in) const noexcept -> void
 
 auto BlockOracle::Imp::work() noexcept -> int
 {
+    // NOTE every step must run on each pass regardless of whether an earlier
+    // step has more work pending
+    const auto loaded = load_prefetched();
+    const auto pruned = prune();
+    const auto compacted = compact();
+    const auto more = loaded || pruned || compacted;
     tdiag("work before cache");
     auto milliseconds_to_return = cache_.lock()->StateMachine();
     tdiag("work after cache");
+
+    if (more && (SM_off != milliseconds_to_return)) { return 0; }
+
     return milliseconds_to_return;
 }
 
@@ -323,6 +453,11 @@ BlockOracle::BlockOracle(boost::shared_ptr<Imp>&& imp) noexcept
     imp_->Init(imp_);
 }
 
+auto BlockOracle::CacheStatistics() const noexcept -> BlockCacheStatistics
+{
+    return imp_->CacheStatistics();
+}
+
 auto BlockOracle::DownloadQueue() const noexcept -> std::size_t
 {
     return imp_->DownloadQueue();
@@ -350,16 +485,42 @@ auto BlockOracle::Heartbeat() const noexcept -> void
 
 auto BlockOracle::Init() noexcept -> void { imp_->StartDownloader(); }
 
+auto BlockOracle::IsPruned(const block::Hash& block) const noexcept -> bool
+{
+    return imp_->IsPruned(block);
+}
+
 auto BlockOracle::LoadBitcoin(const block::Hash& block) const noexcept
     -> BitcoinBlockResult
 {
-    return imp_->LoadBitcoin(block);
+    return LoadBitcoin(block, BlockCacheConsumer::unknown);
+}
+
+auto BlockOracle::LoadBitcoin(
+    const block::Hash& block,
+    const BlockCacheConsumer consumer) const noexcept -> BitcoinBlockResult
+{
+    return imp_->LoadBitcoin(block, consumer);
 }
 
 auto BlockOracle::LoadBitcoin(const Vector<block::Hash>& hashes) const noexcept
     -> BitcoinBlockResults
 {
-    return imp_->LoadBitcoin(hashes);
+    return LoadBitcoin(hashes, BlockCacheConsumer::unknown);
+}
+
+auto BlockOracle::LoadBitcoin(
+    const Vector<block::Hash>& hashes,
+    const BlockCacheConsumer consumer) const noexcept -> BitcoinBlockResults
+{
+    return imp_->LoadBitcoin(hashes, consumer);
+}
+
+auto BlockOracle::Prefetch(
+    const Vector<block::Hash>& hashes,
+    const BlockCacheConsumer consumer) const noexcept -> BitcoinBlockResults
+{
+    return imp_->Prefetch(hashes, consumer);
 }
 
 auto BlockOracle::Shutdown() noexcept -> void { imp_->Shutdown(); }
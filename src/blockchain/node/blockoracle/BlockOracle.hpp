@@ -83,6 +83,7 @@ namespace internal
 {
 class BlockBatch;
 class Manager;
+struct Config;
 }  // namespace internal
 
 class HeaderOracle;
@@ -111,6 +112,10 @@ namespace opentxs::blockchain::node::internal
 class BlockOracle::Imp final : public Actor<BlockOracleJobs>
 {
 public:
+    auto CacheStatistics() const noexcept -> BlockCacheStatistics
+    {
+        return cache_.lock_shared()->Statistics();
+    }
     auto DownloadQueue() const noexcept -> std::size_t
     {
         return cache_.lock_shared()->DownloadQueue();
@@ -126,12 +131,23 @@ public:
     auto GetBlockJob() const noexcept -> BlockJob;
 
     auto Heartbeat() const noexcept -> void;
+    auto IsPruned(const block::Hash& block) const noexcept -> bool
+    {
+        return db_.BlockPruned(block);
+    }
 
     // TODO assess the thread safety
-    auto LoadBitcoin(const block::Hash& block) const noexcept
-        -> BitcoinBlockResult;
+    auto LoadBitcoin(
+        const block::Hash& block,
+        const BlockCacheConsumer consumer) const noexcept -> BitcoinBlockResult;
     // TODO assess the thread safety
-    auto LoadBitcoin(const Vector<block::Hash>& hashes) const noexcept
+    auto LoadBitcoin(
+        const Vector<block::Hash>& hashes,
+        const BlockCacheConsumer consumer) const noexcept
+        -> BitcoinBlockResults;
+    auto Prefetch(
+        const Vector<block::Hash>& hashes,
+        const BlockCacheConsumer consumer) const noexcept
         -> BitcoinBlockResults;
 
     auto SubmitBlock(const ReadView in) const noexcept -> void;
@@ -151,6 +167,7 @@ public:
     auto StartDownloader() noexcept -> void;
 
     Imp(const api::Session& api,
+        const internal::Config& config,
         const internal::Manager& node,
         const node::HeaderOracle& header,
         database::Block& db,
@@ -175,23 +192,42 @@ protected:
 
 private:
     using Task = BlockOracleJobs;
+
+    // NOTE maximum number of prefetched blocks loaded from storage before
+    // yielding to other work
+    static constexpr auto prefetch_batch_ = std::size_t{16};
+    // NOTE maximum number of blocks removed from storage per pruning pass
+    static constexpr auto prune_batch_ = std::size_t{1000};
+    static constexpr auto prune_interval_ = std::chrono::minutes{1};
+    // NOTE maximum number of items moved per storage compaction pass
+    static constexpr auto compact_batch_ = std::size_t{1000};
+    static constexpr auto compact_interval_ = std::chrono::minutes{10};
     using Cache =
         libguarded::shared_guarded<blockoracle::Cache, std::shared_mutex>;
 
     const api::Session& api_;
     const internal::Manager& node_;
-    const database::Block& db_;
+    database::Block& db_;
+    const std::size_t prune_depth_;
+    const std::size_t prune_bytes_;
     const CString submit_endpoint_;
     const std::unique_ptr<const block::Validator> validator_;
     const std::unique_ptr<blockoracle::BlockDownloader> block_downloader_;
     mutable Cache cache_;
+    Time last_prune_;
+    Time last_compact_;
 
     static auto get_validator(
         const blockchain::Type chain,
         const node::HeaderOracle& headers) noexcept
         -> std::unique_ptr<const block::Validator>;
 
+    auto compact() noexcept -> bool;
+    auto load_prefetched() noexcept -> bool;
+    auto prune() noexcept -> bool;
+
     Imp(const api::Session& api,
+        const internal::Config& config,
         const internal::Manager& node,
         const node::HeaderOracle& header,
         database::Block& db,
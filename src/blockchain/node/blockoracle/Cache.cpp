@@ -19,6 +19,7 @@
 #include "internal/api/network/Blockchain.hpp"
 #include "internal/blockchain/database/Block.hpp"
 #include "internal/blockchain/database/Types.hpp"
+#include "internal/blockchain/node/Config.hpp"
 #include "internal/blockchain/node/Manager.hpp"
 #include "internal/network/zeromq/Context.hpp"
 #include "internal/util/LogMacros.hpp"
@@ -42,17 +43,16 @@
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/Log.hpp"
 #include "opentxs/util/WorkType.hpp"
-#include "util/ByteLiterals.hpp"
 #include "util/threadutil.hpp"
 #include "util/tuning.hpp"
 
 namespace opentxs::blockchain::node::blockoracle
 {
-const std::size_t Cache::cache_limit_{8_MiB};
 const std::chrono::seconds Cache::download_timeout_{60};
 
 Cache::Cache(
     const api::Session& api,
+    const internal::Config& config,
     const internal::Manager& node,
     database::Block& db,
     const blockchain::Type chain,
@@ -84,11 +84,12 @@ Cache::Cache(
         return out;
     }())
     , pending_(alloc)
+    , prefetch_(alloc)
     , queue_(alloc)
     , batch_index_(alloc)
     , hash_index_(alloc)
     , hash_cache_(alloc)
-    , mem_(cache_limit_, alloc)
+    , mem_(config.block_cache_bytes_, alloc)
     , peer_target_(std::nullopt)
     , running_(true)
 {
@@ -122,6 +123,38 @@ auto Cache::FinishBatch(const BatchID id) noexcept -> void
     publish_download_queue();
 }
 
+auto Cache::FinishPrefetch(
+    const block::Hash& id,
+    std::shared_ptr<const bitcoin::block::Block> block) noexcept -> void
+{
+    auto item = prefetch_.Extract(id);
+
+    if (false == item.has_value()) { return; }
+
+    auto& [promise, future, requestor] = *item;
+
+    if (block) {
+        // TODO this should be checked in the block factory function
+        OT_ASSERT(block->ID() == id);
+
+        promise.set_value(std::move(block));
+        mem_.push(block::Hash{id}, std::move(future), requestor);
+        publish(id);
+    } else {
+        LogTrace()(OT_PRETTY_CLASS())("prefetched block ")(id.asHex())(
+            " is not in storage, queueing for download")
+            .Flush();
+        queue_hash(id);
+        auto& [time, p, f, queued, consumer] = pending_[id];
+        time = Clock::now();
+        p = std::move(promise);
+        f = std::move(future);
+        queued = true;
+        consumer = requestor;
+        publish_download_queue();
+    }
+}
+
 auto Cache::GetBatch(allocator_type alloc) noexcept
     -> std::pair<BatchID, Vector<block::Hash>>
 {
@@ -199,6 +232,45 @@ auto Cache::next_batch_id() noexcept -> BatchID
     return ++counter;
 }
 
+auto Cache::NextPrefetch() noexcept -> std::optional<block::Hash>
+{
+    return prefetch_.Next();
+}
+
+auto Cache::Prefetch(
+    const Vector<block::Hash>& hashes,
+    const BlockCacheConsumer consumer) noexcept -> BitcoinBlockResults
+{
+    auto output = BitcoinBlockResults{};
+    output.reserve(hashes.size());
+
+    if (!running_) {
+        std::for_each(hashes.begin(), hashes.end(), [&](const auto&) {
+            auto promise = Promise{};
+            promise.set_value(nullptr);
+            output.emplace_back(promise.get_future());
+        });
+
+        return output;
+    }
+
+    for (const auto& block : hashes) {
+        if (auto future = mem_.find(block.Bytes(), consumer); future.valid()) {
+            output.emplace_back(std::move(future));
+            publish(block);
+        } else if (auto i = pending_.find(block); pending_.end() != i) {
+            const auto& [time, promise, f, queued, requestor] = i->second;
+            output.emplace_back(f);
+        } else {
+            output.emplace_back(prefetch_.Add(block, consumer));
+        }
+    }
+
+    OT_ASSERT(output.size() == hashes.size());
+
+    return output;
+}
+
 auto Cache::ProcessBlockRequests(network::zeromq::Message&& in) noexcept -> void
 {
     if (!running_) { return; }
@@ -292,11 +364,11 @@ auto Cache::ReceiveBlock(
         return;
     }
 
-    auto& [time, promise, future, queued] = pending->second;
+    auto& [time, promise, future, queued, requestor] = pending->second;
     promise.set_value(std::move(in));
     publish(id);
     LogVerbose()(OT_PRETTY_CLASS())("Cached block ")(id.asHex()).Flush();
-    mem_.push(block::Hash{id}, std::move(future));
+    mem_.push(block::Hash{id}, std::move(future), requestor);
     pending_.erase(pending);
     publish_download_queue();
 }
@@ -310,17 +382,20 @@ auto Cache::receive_block(const block::Hash& id) noexcept -> void
     }
 }
 
-auto Cache::Request(const block::Hash& block) noexcept -> BitcoinBlockResult
+auto Cache::Request(
+    const block::Hash& block,
+    const BlockCacheConsumer consumer) noexcept -> BitcoinBlockResult
 {
-    const auto output = Request(Vector<block::Hash>{block});
+    const auto output = Request(Vector<block::Hash>{block}, consumer);
 
     OT_ASSERT(1 == output.size());
 
     return output.at(0);
 }
 
-auto Cache::Request(const Vector<block::Hash>& hashes) noexcept
-    -> BitcoinBlockResults
+auto Cache::Request(
+    const Vector<block::Hash>& hashes,
+    const BlockCacheConsumer consumer) noexcept -> BitcoinBlockResults
 {
     auto output = BitcoinBlockResults{};
     output.reserve(hashes.size());
@@ -343,7 +418,7 @@ auto Cache::Request(const Vector<block::Hash>& hashes) noexcept
         const auto start = Clock::now();
         auto found{false};
 
-        if (auto future = mem_.find(block.Bytes()); future.valid()) {
+        if (auto future = mem_.find(block.Bytes(), consumer); future.valid()) {
             output.emplace_back(std::move(future));
             ready.emplace_back(&block);
             found = true;
@@ -363,9 +438,13 @@ auto Cache::Request(const Vector<block::Hash>& hashes) noexcept
             auto it = pending_.find(block);
 
             if (pending_.end() != it) {
-                const auto& [time, promise, future, queued] = it->second;
+                const auto& [time, promise, future, queued, requestor] =
+                    it->second;
                 output.emplace_back(future);
                 found = true;
+            } else if (auto future = prefetch_.Find(block); future.valid()) {
+                output.emplace_back(std::move(future));
+                found = true;
             }
         }
 
@@ -386,8 +465,9 @@ auto Cache::Request(const Vector<block::Hash>& hashes) noexcept
 
             auto promise = Promise{};
             promise.set_value(std::move(pBlock));
-            mem_.push(block::Hash{block}, promise.get_future());
-            output.emplace_back(mem_.find(block.Bytes()));
+            auto future = BitcoinBlockResult{promise.get_future()};
+            mem_.push(block::Hash{block}, BitcoinBlockResult{future}, consumer);
+            output.emplace_back(std::move(future));
             ready.emplace_back(&block);
             found = true;
         }
@@ -434,11 +514,12 @@ auto Cache::Request(const Vector<block::Hash>& hashes) noexcept
 
         for (auto& [hash, futureOut] : download) {
             queue_hash(hash);
-            auto& [time, promise, future, queued] = pending_[hash];
+            auto& [time, promise, future, queued, requestor] = pending_[hash];
             time = Clock::now();
             future = promise.get_future();
             *futureOut = future;
             queued = true;
+            requestor = consumer;
         }
 
         publish_download_queue();
@@ -456,11 +537,13 @@ auto Cache::Shutdown() noexcept -> void
         mem_.clear();
 
         for (auto& [hash, item] : pending_) {
-            auto& [time, promise, future, queued] = item;
+            auto& [time, promise, future, queued, requestor] = item;
             promise.set_value(nullptr);
         }
 
         pending_.clear();
+
+        prefetch_.Cancel();
         publish_download_queue();
     }
 }
@@ -476,7 +559,7 @@ auto Cache::StateMachine() noexcept -> int
     blockList.reserve(pending_.size());
 
     for (auto& [hash, item] : pending_) {
-        auto& [time, promise, future, queued] = item;
+        auto& [time, promise, future, queued, requestor] = item;
         const auto now = Clock::now();
         namespace c = std::chrono;
         const auto elapsed = std::chrono::nanoseconds{now - time};
@@ -17,6 +17,8 @@
 #include <utility>
 
 #include "blockchain/node/blockoracle/MemDB.hpp"
+#include "blockchain/node/blockoracle/Prefetcher.hpp"
+#include "internal/blockchain/node/Types.hpp"
 #include "internal/network/zeromq/socket/Raw.hpp"
 #include "opentxs/blockchain/Types.hpp"
 #include "opentxs/blockchain/block/Hash.hpp"
@@ -56,6 +58,7 @@ namespace node
 namespace internal
 {
 class Manager;
+struct Config;
 }  // namespace internal
 }  // namespace node
 }  // namespace blockchain
@@ -84,27 +87,46 @@ public:
     using BatchID = std::size_t;
 
     auto DownloadQueue() const noexcept -> std::size_t;
+    auto HavePrefetch() const noexcept -> bool
+    {
+        return prefetch_.HaveQueued();
+    }
+    auto Statistics() const noexcept -> BlockCacheStatistics
+    {
+        return mem_.Statistics();
+    }
     auto get_allocator() const noexcept -> allocator_type final
     {
         return pending_.get_allocator();
     }
 
     auto FinishBatch(const BatchID id) noexcept -> void;
+    auto FinishPrefetch(
+        const block::Hash& id,
+        std::shared_ptr<const bitcoin::block::Block> block) noexcept -> void;
     auto GetBatch(allocator_type alloc) noexcept
         -> std::pair<BatchID, Vector<block::Hash>>;
+    auto NextPrefetch() noexcept -> std::optional<block::Hash>;
+    auto Prefetch(
+        const Vector<block::Hash>& hashes,
+        const BlockCacheConsumer consumer) noexcept -> BitcoinBlockResults;
     auto ProcessBlockRequests(network::zeromq::Message&& in) noexcept -> void;
     auto ReceiveBlock(const network::zeromq::Frame& in) noexcept -> void;
     auto ReceiveBlock(const std::string_view in) noexcept -> void;
     auto ReceiveBlock(std::shared_ptr<const bitcoin::block::Block> in) noexcept
         -> void;
-    auto Request(const block::Hash& block) noexcept -> BitcoinBlockResult;
-    auto Request(const Vector<block::Hash>& hashes) noexcept
-        -> BitcoinBlockResults;
+    auto Request(
+        const block::Hash& block,
+        const BlockCacheConsumer consumer) noexcept -> BitcoinBlockResult;
+    auto Request(
+        const Vector<block::Hash>& hashes,
+        const BlockCacheConsumer consumer) noexcept -> BitcoinBlockResults;
     auto Shutdown() noexcept -> void;
     auto StateMachine() noexcept -> int;
 
     Cache(
         const api::Session& api_,
+        const internal::Config& config,
         const internal::Manager& node,
         database::Block& db,
         const blockchain::Type chain,
@@ -114,14 +136,14 @@ public:
 
 private:
     using Promise = std::promise<std::shared_ptr<const bitcoin::block::Block>>;
-    using PendingData = std::tuple<Time, Promise, BitcoinBlockResult, bool>;
+    using PendingData =
+        std::tuple<Time, Promise, BitcoinBlockResult, bool, BlockCacheConsumer>;
     using Pending = Map<block::Hash, PendingData>;
     using RequestQueue = Deque<block::Hash>;
     using BatchIndex = Map<BatchID, std::pair<std::size_t, Set<block::Hash>>>;
     using HashIndex = Map<block::Hash, BatchID>;
     using HashCache = Set<block::Hash>;
 
-    static const std::size_t cache_limit_;
     static const std::chrono::seconds download_timeout_;
 
     const api::Session& api_;
@@ -131,6 +153,7 @@ private:
     opentxs::network::zeromq::socket::Raw block_available_;
     opentxs::network::zeromq::socket::Raw cache_size_publisher_;
     Pending pending_;
+    Prefetcher prefetch_;
     RequestQueue queue_;
     BatchIndex batch_index_;
     HashIndex hash_index_;
@@ -7,11 +7,14 @@
 #include "1_Internal.hpp"                         // IWYU pragma: associated
 #include "blockchain/node/blockoracle/MemDB.hpp"  // IWYU pragma: associated
 
+#include <algorithm>
 #include <future>
+#include <iterator>
 #include <memory>
 
 #include "internal/blockchain/block/Block.hpp"
 #include "internal/util/LogMacros.hpp"
+#include "internal/util/P0330.hpp"
 #include "opentxs/blockchain/bitcoin/block/Block.hpp"
 #include "opentxs/util/Bytes.hpp"
 #include "opentxs/util/Log.hpp"
@@ -20,20 +23,120 @@ namespace opentxs::blockchain::node::blockoracle
 {
 MemDB::MemDB(const std::size_t limit, allocator_type alloc) noexcept
     : limit_(limit)
-    , bytes_(0)
-    , queue_(alloc)
+    , recent_target_(0)
+    , evictions_(0)
+    , bytes_()
+    , segments_({Items{alloc}, Items{alloc}, Items{alloc}, Items{alloc}})
     , index_(alloc)
+    , consumers_()
 {
+    bytes_.fill(0_uz);
+}
+
+auto MemDB::adapt(const Segment ghost, const std::size_t bytes) noexcept
+    -> void
+{
+    const auto other = (Segment::recent_ghost == ghost)
+                           ? Segment::frequent_ghost
+                           : Segment::recent_ghost;
+    // NOTE a hit in the smaller ghost segment is stronger evidence that the
+    // corresponding live segment is too small
+    const auto scale =
+        std::max(1_uz, this->bytes(other) / std::max(1_uz, this->bytes(ghost)));
+    const auto delta = bytes * scale;
+
+    if (Segment::recent_ghost == ghost) {
+        recent_target_ = std::min(limit_, recent_target_ + delta);
+    } else {
+        recent_target_ -= std::min(recent_target_, delta);
+    }
+}
+
+auto MemDB::bytes(const Segment segment) const noexcept -> std::size_t
+{
+    return bytes_[static_cast<std::size_t>(segment)];
+}
+
+auto MemDB::bytes(const Segment segment) noexcept -> std::size_t&
+{
+    return bytes_[static_cast<std::size_t>(segment)];
 }
 
 auto MemDB::clear() noexcept -> void
 {
     index_.clear();
-    queue_.clear();
-    bytes_ = 0;
+
+    for (auto& segment : segments_) { segment.clear(); }
+
+    bytes_.fill(0_uz);
+    recent_target_ = 0;
+}
+
+auto MemDB::demote(const Segment from, const Segment to) noexcept -> void
+{
+    auto& item = items(from).back();
+    LogTrace()(OT_PRETTY_CLASS())("evicting block ")(item.id_.asHex())(
+        " from cache due to exceeding byte limit")
+        .Flush();
+    item.block_ = {};
+    auto i = index_.find(item.id_.Bytes());
+
+    OT_ASSERT(index_.end() != i);
+
+    move(i, to);
+    ++evictions_;
+}
+
+auto MemDB::drop(const Segment segment) noexcept -> void
+{
+    auto& list = items(segment);
+    const auto& item = list.back();
+    bytes(segment) -= item.bytes_;
+    index_.erase(item.id_.Bytes());
+    list.pop_back();
+}
+
+auto MemDB::evict() noexcept -> void
+{
+    const auto live = [this] {
+        return bytes(Segment::recent) + bytes(Segment::frequent);
+    };
+
+    while (limit_ < live()) {
+        const auto& recent = items(Segment::recent);
+        const auto& frequent = items(Segment::frequent);
+
+        if (recent.empty() && frequent.empty()) { break; }
+
+        const auto fromRecent =
+            (false == recent.empty()) &&
+            ((bytes(Segment::recent) > recent_target_) || frequent.empty());
+
+        if (fromRecent) {
+            demote(Segment::recent, Segment::recent_ghost);
+        } else {
+            demote(Segment::frequent, Segment::frequent_ghost);
+        }
+    }
+
+    while ((limit_ < (bytes(Segment::recent) + bytes(Segment::recent_ghost))) &&
+           (false == items(Segment::recent_ghost).empty())) {
+        drop(Segment::recent_ghost);
+    }
+
+    const auto total = [&] {
+        return live() + bytes(Segment::recent_ghost) +
+               bytes(Segment::frequent_ghost);
+    };
+
+    while (((2_uz * limit_) < total()) &&
+           (false == items(Segment::frequent_ghost).empty())) {
+        drop(Segment::frequent_ghost);
+    }
 }
 
-auto MemDB::find(const ReadView id) const noexcept -> BitcoinBlockResult
+auto MemDB::find(const ReadView id, const BlockCacheConsumer consumer) noexcept
+    -> BitcoinBlockResult
 {
     if (!valid(id)) {
         LogError()(OT_PRETTY_CLASS())("invalid block id").Flush();
@@ -41,26 +144,64 @@ auto MemDB::find(const ReadView id) const noexcept -> BitcoinBlockResult
         return {};
     }
 
-    if (auto i = index_.find(id); index_.end() != i) {
+    auto& stats = consumers_[consumer];
+    auto i = index_.find(id);
 
-        return i->second->second;
-    } else {
+    if (index_.end() == i) {
+        ++stats.misses_;
 
         return {};
     }
+
+    switch (i->second.first) {
+        case Segment::recent:
+        case Segment::frequent: {
+            const auto& item = *i->second.second;
+            ++stats.hits_;
+            stats.hit_bytes_ += item.bytes_;
+            auto output = item.block_;
+            move(i, Segment::frequent);
+
+            return output;
+        }
+        case Segment::recent_ghost:
+        case Segment::frequent_ghost:
+        default: {
+            ++stats.misses_;
+
+            return {};
+        }
+    }
 }
 
-auto MemDB::push(block::Hash&& id, BitcoinBlockResult&& future) noexcept -> void
+auto MemDB::items(const Segment segment) const noexcept -> const Items&
 {
-    if (id.IsNull()) {
-        LogError()(OT_PRETTY_CLASS())("invalid block id").Flush();
+    return segments_[static_cast<std::size_t>(segment)];
+}
 
-        return;
-    }
+auto MemDB::items(const Segment segment) noexcept -> Items&
+{
+    return segments_[static_cast<std::size_t>(segment)];
+}
 
-    if (0u < index_.count(id.Bytes())) {
-        LogError()(OT_PRETTY_CLASS())("block ")(id.asHex())(" already cached")
-            .Flush();
+auto MemDB::move(Index::iterator i, const Segment to) noexcept -> void
+{
+    auto& [from, it] = i->second;
+    const auto size = it->bytes_;
+    bytes(from) -= size;
+    bytes(to) += size;
+    auto& destination = items(to);
+    destination.splice(destination.begin(), items(from), it);
+    from = to;
+}
+
+auto MemDB::push(
+    block::Hash&& id,
+    BitcoinBlockResult&& future,
+    const BlockCacheConsumer consumer) noexcept -> void
+{
+    if (id.IsNull()) {
+        LogError()(OT_PRETTY_CLASS())("invalid block id").Flush();
 
         return;
     }
@@ -71,20 +212,58 @@ auto MemDB::push(block::Hash&& id, BitcoinBlockResult&& future) noexcept -> void
 
     OT_ASSERT(pBlock);
 
-    const auto& block = *pBlock;
-    const auto& item = queue_.emplace_back(std::move(id), std::move(future));
-    bytes_ += block.Internal().CalculateSize();
-    index_.try_emplace(item.first.Bytes(), &item);
-
-    while ((bytes_ > limit_) && (!queue_.empty())) {
-        const auto& item = queue_.front();
-        const auto& id = item.first;
-        LogTrace()(OT_PRETTY_CLASS())("dropping oldest block ")(id.asHex())(
-            " from cache due to exceeding byte limit")
-            .Flush();
-        index_.erase(item.first.Bytes());
-        bytes_ -= item.second.get()->Internal().CalculateSize();
-        queue_.pop_front();
+    const auto size = pBlock->Internal().CalculateSize();
+    consumers_[consumer].loaded_bytes_ += size;
+
+    if (auto i = index_.find(id.Bytes()); index_.end() != i) {
+        const auto segment = i->second.first;
+
+        switch (segment) {
+            case Segment::recent_ghost:
+            case Segment::frequent_ghost: {
+                adapt(segment, size);
+                auto& item = *i->second.second;
+                bytes(segment) -= item.bytes_;
+                bytes(segment) += size;
+                item.bytes_ = size;
+                item.block_ = std::move(future);
+                move(i, Segment::frequent);
+            } break;
+            case Segment::recent:
+            case Segment::frequent:
+            default: {
+                LogError()(OT_PRETTY_CLASS())("block ")(id.asHex())(
+                    " already cached")
+                    .Flush();
+
+                return;
+            }
+        }
+    } else {
+        auto& list = items(Segment::recent);
+        const auto& item = list.emplace_front(
+            CachedBlock{std::move(id), std::move(future), size});
+        bytes(Segment::recent) += size;
+        index_.try_emplace(
+            item.id_.Bytes(), Location{Segment::recent, list.begin()});
     }
+
+    evict();
+}
+
+auto MemDB::Statistics() const noexcept -> BlockCacheStatistics
+{
+    auto output = BlockCacheStatistics{};
+    output.limit_ = limit_;
+    output.blocks_ =
+        items(Segment::recent).size() + items(Segment::frequent).size();
+    output.recent_bytes_ = bytes(Segment::recent);
+    output.frequent_bytes_ = bytes(Segment::frequent);
+    output.bytes_ = output.recent_bytes_ + output.frequent_bytes_;
+    output.recent_target_ = recent_target_;
+    output.evictions_ = evictions_;
+    output.consumers_ = consumers_;
+
+    return output;
 }
 }  // namespace opentxs::blockchain::node::blockoracle
@@ -5,14 +5,13 @@
 
 #pragma once
 
-#include <boost/container/flat_map.hpp>
-#include <boost/container/vector.hpp>
+#include <array>
 #include <cstddef>
-#include <functional>
+#include <cstdint>
 #include <string_view>
-#include <tuple>
 #include <utility>
 
+#include "internal/blockchain/node/Types.hpp"
 #include "opentxs/blockchain/block/Hash.hpp"
 #include "opentxs/blockchain/block/Types.hpp"
 #include "opentxs/blockchain/node/Types.hpp"
@@ -46,28 +45,72 @@ class Hash;
 
 namespace opentxs::blockchain::node::blockoracle
 {
+// Byte limited adaptive replacement cache for recently used blocks
+//
+// A block enters the recent segment the first time it is cached and is
+// promoted to the frequent segment when it is requested again. Evicted
+// blocks leave their id behind in a ghost segment, and a request for a ghost
+// moves the boundary between the recent and frequent segments in favor of
+// the segment it was evicted from. A rescan which reads every block once can
+// therefore only displace other blocks which have been read once.
 class MemDB final : public Allocated
 {
 public:
-    auto find(const ReadView id) const noexcept -> BitcoinBlockResult;
     auto get_allocator() const noexcept -> allocator_type final
     {
-        return queue_.get_allocator();
+        return index_.get_allocator();
     }
+    auto Statistics() const noexcept -> BlockCacheStatistics;
 
     auto clear() noexcept -> void;
-    auto push(block::Hash&& id, BitcoinBlockResult&& future) noexcept -> void;
+    auto find(const ReadView id, const BlockCacheConsumer consumer) noexcept
+        -> BitcoinBlockResult;
+    auto push(
+        block::Hash&& id,
+        BitcoinBlockResult&& future,
+        const BlockCacheConsumer consumer) noexcept -> void;
 
     MemDB(const std::size_t limit, allocator_type alloc) noexcept;
 
 private:
-    using CachedBlock = std::pair<block::Hash, BitcoinBlockResult>;
-    using Completed = Deque<CachedBlock>;
-    using Index = Map<ReadView, const CachedBlock*>;
+    enum class Segment : std::size_t {
+        recent = 0,
+        frequent = 1,
+        recent_ghost = 2,
+        frequent_ghost = 3,
+    };
+
+    struct CachedBlock {
+        block::Hash id_;
+        BitcoinBlockResult block_;
+        std::size_t bytes_;
+    };
+
+    using Items = List<CachedBlock>;
+    using Location = std::pair<Segment, Items::iterator>;
+    using Index = Map<ReadView, Location>;
+    using Consumers =
+        UnallocatedMap<BlockCacheConsumer, BlockCacheStatistics::Consumer>;
+
+    static constexpr auto segment_count_ = std::size_t{4};
 
     const std::size_t limit_;
-    std::size_t bytes_;
-    Completed queue_;
+    std::size_t recent_target_;
+    std::size_t evictions_;
+    std::array<std::size_t, segment_count_> bytes_;
+    std::array<Items, segment_count_> segments_;
     Index index_;
+    Consumers consumers_;
+
+    auto bytes(const Segment segment) const noexcept -> std::size_t;
+    auto items(const Segment segment) const noexcept -> const Items&;
+
+    auto adapt(const Segment ghost, const std::size_t bytes) noexcept -> void;
+    auto bytes(const Segment segment) noexcept -> std::size_t&;
+    auto demote(const Segment from, const Segment to) noexcept -> void;
+    auto drop(const Segment segment) noexcept -> void;
+    auto evict() noexcept -> void;
+    auto items(const Segment segment) noexcept -> Items&;
+    auto move(Index::iterator i, const Segment to) noexcept -> void;
 };
 }  // namespace opentxs::blockchain::node::blockoracle
@@ -0,0 +1,88 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"    // IWYU pragma: associated
+#include "1_Internal.hpp"  // IWYU pragma: associated
+#include "blockchain/node/blockoracle/Prefetcher.hpp"  // IWYU pragma: associated
+
+#include <utility>
+
+#include "opentxs/blockchain/bitcoin/block/Block.hpp"
+
+namespace opentxs::blockchain::node::blockoracle
+{
+Prefetcher::Prefetcher(allocator_type alloc) noexcept
+    : items_(alloc)
+    , queue_(alloc)
+{
+}
+
+auto Prefetcher::Add(
+    const block::Hash& id,
+    const BlockCacheConsumer consumer) noexcept -> BitcoinBlockResult
+{
+    if (auto i = items_.find(id); items_.end() != i) {
+        const auto& [promise, future, requestor] = i->second;
+
+        return future;
+    }
+
+    auto& [promise, future, requestor] = items_[id];
+    future = promise.get_future();
+    requestor = consumer;
+    queue_.emplace_back(id);
+
+    return future;
+}
+
+auto Prefetcher::Cancel() noexcept -> void
+{
+    for (auto& [hash, item] : items_) {
+        auto& [promise, future, requestor] = item;
+        promise.set_value(nullptr);
+    }
+
+    items_.clear();
+    queue_.clear();
+}
+
+auto Prefetcher::Extract(const block::Hash& id) noexcept -> std::optional<Item>
+{
+    auto i = items_.find(id);
+
+    if (items_.end() == i) { return std::nullopt; }
+
+    auto output = std::make_optional<Item>(std::move(i->second));
+    items_.erase(i);
+
+    return output;
+}
+
+auto Prefetcher::Find(const block::Hash& id) const noexcept
+    -> BitcoinBlockResult
+{
+    if (auto i = items_.find(id); items_.end() != i) {
+        const auto& [promise, future, requestor] = i->second;
+
+        return future;
+    }
+
+    return {};
+}
+
+auto Prefetcher::Next() noexcept -> std::optional<block::Hash>
+{
+    // NOTE the queue may contain blocks which were delivered by another path
+    // after they were queued
+    while (false == queue_.empty()) {
+        auto hash = std::move(queue_.front());
+        queue_.pop_front();
+
+        if (0u < items_.count(hash)) { return hash; }
+    }
+
+    return std::nullopt;
+}
+}  // namespace opentxs::blockchain::node::blockoracle
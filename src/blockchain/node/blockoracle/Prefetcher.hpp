@@ -0,0 +1,87 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <future>
+#include <memory>
+#include <optional>
+#include <tuple>
+
+#include "internal/blockchain/node/Types.hpp"
+#include "opentxs/blockchain/block/Hash.hpp"
+#include "opentxs/blockchain/node/Types.hpp"
+#include "opentxs/util/Allocated.hpp"
+#include "opentxs/util/Container.hpp"
+
+// NOLINTBEGIN(modernize-concat-nested-namespaces)
+namespace opentxs  // NOLINT
+{
+// inline namespace v1
+// {
+namespace blockchain
+{
+namespace bitcoin
+{
+namespace block
+{
+class Block;
+}  // namespace block
+}  // namespace bitcoin
+}  // namespace blockchain
+// }  // namespace v1
+}  // namespace opentxs
+// NOLINTEND(modernize-concat-nested-namespaces)
+
+namespace opentxs::blockchain::node::blockoracle
+{
+/// Blocks which have been requested ahead of time but not yet loaded
+///
+/// Each block is queued for loading once regardless of how many times it is
+/// requested and every requestor receives the same future.
+class Prefetcher final : public Allocated
+{
+public:
+    using Promise = std::promise<std::shared_ptr<const bitcoin::block::Block>>;
+    using Item = std::tuple<Promise, BitcoinBlockResult, BlockCacheConsumer>;
+
+    /// Returns an invalid future if the block is not being prefetched
+    auto Find(const block::Hash& id) const noexcept -> BitcoinBlockResult;
+    auto get_allocator() const noexcept -> allocator_type final
+    {
+        return items_.get_allocator();
+    }
+    auto HaveQueued() const noexcept -> bool { return false == queue_.empty(); }
+    auto size() const noexcept -> std::size_t { return items_.size(); }
+
+    auto Add(const block::Hash& id, const BlockCacheConsumer consumer) noexcept
+        -> BitcoinBlockResult;
+    /// Resolve every outstanding future with a null block
+    auto Cancel() noexcept -> void;
+    /// Remove a block so the caller can deliver it
+    ///
+    /// Returns an empty optional if the block is not being prefetched, for
+    /// example because it was already delivered.
+    auto Extract(const block::Hash& id) noexcept -> std::optional<Item>;
+    /// Returns the next block to load, in the order they were first requested
+    auto Next() noexcept -> std::optional<block::Hash>;
+
+    Prefetcher(allocator_type alloc) noexcept;
+    Prefetcher() = delete;
+    Prefetcher(const Prefetcher&) = delete;
+    Prefetcher(Prefetcher&&) = delete;
+    auto operator=(const Prefetcher&) -> Prefetcher& = delete;
+    auto operator=(Prefetcher&&) -> Prefetcher& = delete;
+
+    ~Prefetcher() final = default;
+
+private:
+    using Items = Map<block::Hash, Item>;
+    using Queue = Deque<block::Hash>;
+
+    Items items_;
+    Queue queue_;
+};
+}  // namespace opentxs::blockchain::node::blockoracle
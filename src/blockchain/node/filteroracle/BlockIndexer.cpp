@@ -10,21 +10,31 @@
 #include <boost/smart_ptr/make_shared.hpp>
 #include <algorithm>
 #include <chrono>
+#include <cstddef>
+#include <iterator>
+#include <memory>
 #include <mutex>
 #include <string_view>
+#include <thread>
+#include <tuple>
 #include <utility>
 
 #include "blockchain/DownloadManager.hpp"
+#include "blockchain/node/filteroracle/ProcessBatch.hpp"
 #include "internal/api/network/Asio.hpp"
 #include "internal/api/session/Endpoints.hpp"
+#include "internal/blockchain/Blockchain.hpp"
 #include "internal/blockchain/database/Cfilter.hpp"
+#include "internal/blockchain/node/BlockOracle.hpp"
 #include "internal/blockchain/node/Types.hpp"
 #include "internal/blockchain/node/filteroracle/FilterOracle.hpp"
 #include "internal/blockchain/node/filteroracle/Types.hpp"
 #include "internal/network/zeromq/Types.hpp"
 #include "internal/util/Future.hpp"
 #include "internal/util/LogMacros.hpp"
+#include "internal/util/P0330.hpp"
 #include "opentxs/api/network/Asio.hpp"
+#include "opentxs/api/network/Network.hpp"
 #include "opentxs/api/session/Session.hpp"
 #include "opentxs/blockchain/Types.hpp"
 #include "opentxs/blockchain/bitcoin/cfilter/GCS.hpp"
@@ -41,6 +51,7 @@
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/Log.hpp"
 #include "util/ScopeGuard.hpp"
+#include "util/Thread.hpp"
 #include "util/Work.hpp"
 #include "util/tuning.hpp"
 
@@ -56,6 +67,7 @@ auto print(BlockIndexerJob job) noexcept -> std::string_view
             {Job::header, "header"sv},
             {Job::reindex, "reindex"sv},
             {Job::reorg, "reorg"sv},
+            {Job::block_ready, "block_ready"sv},
             {Job::full_block, "full_block"sv},
             {Job::init, "init"sv},
             {Job::statemachine, "statemachine"sv},
@@ -104,6 +116,8 @@ BlockIndexer::Imp::Imp(
                Direction::Connect},
               {CString{api.Endpoints().BlockchainReorg(), alloc},
                Direction::Connect},
+              {CString{api.Endpoints().BlockchainBlockAvailable(), alloc},
+               Direction::Connect},
           })
     , api_(api)
     , node_(node)
@@ -117,77 +131,160 @@ BlockIndexer::Imp::Imp(
     , current_header_{}
     , best_position_{}
     , current_position_{}
+    , prefetch_(prefetch_window_, alloc)
+    , job_counter_()
 {
 }
 
-auto BlockIndexer::Imp::calculate_next_block() noexcept -> bool
+auto BlockIndexer::Imp::calculate_next_blocks() noexcept -> bool
 {
     OT_ASSERT(0 <= current_position_.height_);
 
-    const auto& blockOracle = node_.BlockOracle();
     const auto& headerOracle = node_.HeaderOracle();
-    auto position = headerOracle.GetPosition(current_position_.height_ + 1);
-    const auto& [height, hash] = position;
+    const auto start = current_position_.height_ + 1;
+    const auto limit = std::clamp<block::Height>(
+        best_position_.height_ - current_position_.height_,
+        1,
+        static_cast<block::Height>(prefetch_window_));
+    auto alloc = get_allocator();
+    const auto hashes = headerOracle.BestHashes(
+        start, static_cast<std::size_t>(limit), alloc.resource());
 
-    if (hash.empty()) {
+    if (hashes.empty()) {
         log_(OT_PRETTY_CLASS())(name_)(": block hash not found for height ")(
-            height)
+            start)
             .Flush();
 
         return true;
     }
 
-    auto future = blockOracle.LoadBitcoin(hash);
+    update_prefetch(hashes);
+    auto blocks = Blocks{alloc};
+    blocks.reserve(max_batch_);
+    auto retry = true;
 
-    if (false == IsReady(future)) {
-        log_(OT_PRETTY_CLASS())(name_)(": block ")
-            .asHex(hash)(" not yet downloaded")
-            .Flush();
+    {
+        const auto* parent = &current_position_.hash_;
+        auto height = start;
 
-        return true;
-    }
+        for (auto i = 0_uz; (i < prefetch_.size()) && (i < max_batch_);
+             ++i, ++height) {
+            const auto& [hash, future] = prefetch_.at(i);
 
-    const auto pBlock = future.get();
+            if (false == IsReady(future)) {
+                log_(OT_PRETTY_CLASS())(name_)(": block ")
+                    .asHex(hash)(" not yet downloaded")
+                    .Flush();
+                // NOTE the block oracle will announce the block when it
+                // becomes available
+                retry = false;
 
-    if (false == bool(pBlock)) {
-        // NOTE the only time the future should contain an uninitialized pointer
-        // is if the block oracle is shutting down
-        log_(OT_PRETTY_CLASS())(name_)(": block ")
-            .asHex(hash)(" unavailable")
-            .Flush();
+                break;
+            }
 
-        return false;
-    }
+            auto pBlock = future.get();
 
-    const auto& block = *pBlock;
+            if (false == bool(pBlock)) {
+                // NOTE the only time the future should contain an
+                // uninitialized pointer is if the block oracle is shutting down
+                log_(OT_PRETTY_CLASS())(name_)(": block ")
+                    .asHex(hash)(" unavailable")
+                    .Flush();
+                retry = false;
 
-    OT_ASSERT(block.ID() == hash);
+                break;
+            }
 
-    if (block.Header().ParentHash() != current_position_.hash_) {
-        log_(OT_PRETTY_CLASS())(name_)(": block ")
-            .asHex(hash)(" is not connected to current tip")
-            .Flush();
-        process_reorg(headerOracle.CommonParent(position).first);
+            OT_ASSERT(pBlock->ID() == hash);
 
-        return true;
+            if (pBlock->Header().ParentHash() != *parent) {
+                log_(OT_PRETTY_CLASS())(name_)(": block ")
+                    .asHex(hash)(" is not connected to current tip")
+                    .Flush();
+
+                if (blocks.empty()) {
+                    process_reorg(
+                        headerOracle.CommonParent(block::Position{height, hash})
+                            .first);
+
+                    return true;
+                }
+
+                break;
+            }
+
+            parent = &hash;
+            blocks.emplace_back(std::move(pBlock));
+        }
     }
 
-    auto alloc = get_allocator();
-    auto filters = Vector<database::Cfilter::CFilterParams>{alloc};
-    auto headers = Vector<database::Cfilter::CFHeaderParams>{alloc};
-    const auto& [ignore1, cfilter] = filters.emplace_back(
-        hash, parent_.Internal().ProcessBlock(filter_type_, block, alloc));
-
-    if (false == cfilter.IsValid()) {
-        log_(OT_PRETTY_CLASS())(name_)(": failed to calculate gcs for ")(
-            (position))
+    if (blocks.empty()) { return retry; }
+
+    const auto batch = blocks.size();
+    // NOTE these are modified by thread pool jobs so they must not use the
+    // actor's allocator
+    auto filters = Vector<database::Cfilter::CFilterParams>{};
+    auto headers = Vector<database::Cfilter::CFHeaderParams>{};
+    filters.reserve(batch);
+    headers.reserve(batch);
+
+    for (auto i = 0_uz; i < batch; ++i) {
+        filters.emplace_back(hashes[i], GCS{});
+        headers.emplace_back(hashes[i], cfilter::Header{}, cfilter::Hash{});
+    }
+
+    // NOTE filter construction for each block is independent and is spread
+    // across the thread pool. The resulting cfheaders depend on the previous
+    // cfheader and so are chained in order afterwards.
+    const auto process = [&](const std::size_t i) {
+        auto& cfilter = filters[i].second;
+        cfilter = parent_.Internal().ProcessBlock(filter_type_, *blocks[i], {});
+
+        if (cfilter.IsValid()) { std::get<2>(headers[i]) = cfilter.Hash(); }
+    };
+    ProcessBatch(
+        batch,
+        std::thread::hardware_concurrency(),
+        job_counter_,
+        [this](auto job) {
+            return api_.Network().Asio().Internal().Post(
+                ThreadPool::General, std::move(job), blockIndexerThreadName);
+        },
+        process);
+
+    // NOTE only the blocks preceding the first failure can be indexed. The
+    // failed block is dropped from the prefetch window so that it will be
+    // requested from the block oracle again on the next pass.
+    const auto count = static_cast<std::size_t>(std::distance(
+        filters.begin(),
+        std::find_if(filters.begin(), filters.end(), [](const auto& item) {
+            return false == item.second.IsValid();
+        })));
+    prefetch_.pop_front(std::min(count + 1_uz, batch));
+
+    if (count < batch) {
+        LogError()(OT_PRETTY_CLASS())(name_)(": failed to calculate gcs for ")(
+            block::Position{
+                start + static_cast<block::Height>(count), hashes[count]})
             .Flush();
+        const auto first = static_cast<std::ptrdiff_t>(count);
+        filters.erase(std::next(filters.begin(), first), filters.end());
+        headers.erase(std::next(headers.begin(), first), headers.end());
+    }
 
-        OT_FAIL;
+    if (0_uz == count) { return false; }
+
+    const auto* previous = &current_header_;
+
+    for (auto i = 0_uz; i < count; ++i) {
+        auto& [ignore, cfheader, cfhash] = headers[i];
+        cfheader = blockchain::internal::FilterHashToHeader(
+            api_, cfhash.Bytes(), previous->Bytes());
+        previous = &cfheader;
     }
 
-    auto& [ignore2, cfheader, cfhash] = headers.emplace_back(
-        hash, cfilter.Header(current_header_), cfilter.Hash());
+    auto position = block::Position{
+        start + static_cast<block::Height>(count - 1_uz), hashes[count - 1_uz]};
     const auto rc = db_.StoreFilters(filter_type_, headers, filters, position);
 
     if (false == rc) {
@@ -196,8 +293,12 @@ auto BlockIndexer::Imp::calculate_next_block() noexcept -> bool
         OT_FAIL;
     }
 
-    previous_header_ = std::move(current_header_);
-    current_header_ = std::move(cfheader);
+    log_(OT_PRETTY_CLASS())(name_)(": indexed ")(count)(" blocks ending at ")(
+        position)
+        .Flush();
+    previous_header_ = (1_uz < count) ? std::get<1>(headers[count - 2_uz])
+                                      : std::move(current_header_);
+    current_header_ = std::move(std::get<1>(headers[count - 1_uz]));
     current_position_ = std::move(position);
     notify_(filter_type_, current_position_);
 
@@ -206,6 +307,7 @@ auto BlockIndexer::Imp::calculate_next_block() noexcept -> bool
 
 auto BlockIndexer::Imp::do_shutdown() noexcept -> void
 {
+    prefetch_.clear();
     current_header_ = {};
     previous_header_ = {};
     best_position_ = block::Position{};
@@ -326,6 +428,21 @@ auto BlockIndexer::Imp::process_block(block::Position&& position) noexcept
     }
 }
 
+auto BlockIndexer::Imp::process_block_ready(
+    network::zeromq::Message&& in) noexcept -> void
+{
+    const auto body = in.Body();
+
+    OT_ASSERT(2 < body.size());
+
+    if (chain_ != body.at(1).as<blockchain::Type>()) { return; }
+    if (prefetch_.empty()) { return; }
+
+    const auto& [next, future] = prefetch_.front();
+
+    if (next.Bytes() == body.at(2).Bytes()) { do_work(); }
+}
+
 auto BlockIndexer::Imp::process_reindex(network::zeromq::Message&&) noexcept
     -> void
 {
@@ -368,6 +485,7 @@ auto BlockIndexer::Imp::reset(block::Position&& to) noexcept -> void
     const auto before = current_position_;
     auto post =
         ScopeGuard{[&] { update_position(before, before, current_position_); }};
+    prefetch_.clear();
     find_best_position(std::move(to));
 }
 
@@ -394,6 +512,9 @@ auto BlockIndexer::Imp::state_normal(
             process_block(std::move(msg));
             do_work();
         } break;
+        case BlockIndexerJob::block_ready: {
+            process_block_ready(std::move(msg));
+        } break;
         case BlockIndexerJob::init: {
             do_init();
         } break;
@@ -417,6 +538,15 @@ auto BlockIndexer::Imp::transition_state_shutdown() noexcept -> void
     signal_shutdown();
 }
 
+auto BlockIndexer::Imp::update_prefetch(
+    const Vector<block::Hash>& hashes) noexcept -> void
+{
+    prefetch_.Update(hashes, [this](const auto& next) {
+        return node_.BlockOracle().Internal().Prefetch(
+            next, BlockCacheConsumer::filter_oracle);
+    });
+}
+
 auto BlockIndexer::Imp::update_position(
     const block::Position& previousCfheader,
     const block::Position& previousCfilter,
@@ -445,7 +575,8 @@ auto BlockIndexer::Imp::work() noexcept -> int
 {
     if (current_position_ == best_position_) { return -1; }
 
-    return calculate_next_block() ? SM_BlockIndexer_fast : SM_BlockIndexer_slow;
+    return calculate_next_blocks() ? SM_BlockIndexer_fast
+                                   : SM_BlockIndexer_slow;
 }
 
 BlockIndexer::Imp::~Imp() { signal_shutdown(); }
@@ -9,8 +9,11 @@
 #pragma once
 
 #include <boost/smart_ptr/shared_ptr.hpp>
+#include <cstddef>
+#include <memory>
 #include <string_view>
 
+#include "blockchain/node/filteroracle/PrefetchWindow.hpp"
 #include "internal/blockchain/node/filteroracle/BlockIndexer.hpp"
 #include "internal/blockchain/node/filteroracle/Types.hpp"
 #include "internal/network/zeromq/Types.hpp"
@@ -22,9 +25,11 @@
 #include "opentxs/blockchain/bitcoin/cfilter/Types.hpp"
 #include "opentxs/blockchain/block/Hash.hpp"
 #include "opentxs/blockchain/block/Position.hpp"
+#include "opentxs/blockchain/node/Types.hpp"
 #include "opentxs/util/Allocated.hpp"
 #include "opentxs/util/Container.hpp"
 #include "util/Actor.hpp"
+#include "util/JobCounter.hpp"
 
 // NOLINTBEGIN(modernize-concat-nested-namespaces)
 namespace opentxs  // NOLINT
@@ -108,6 +113,15 @@ private:
         shutdown,
     };
 
+    using Blocks = Vector<std::shared_ptr<const bitcoin::block::Block>>;
+
+    // NOTE maximum number of blocks indexed in parallel and committed to the
+    // database in a single transaction
+    static constexpr auto max_batch_ = std::size_t{64};
+    // NOTE number of blocks requested from the block oracle ahead of the
+    // current position so the next batch is loaded while this one is indexed
+    static constexpr auto prefetch_window_ = 2u * max_batch_;
+
     const api::Session& api_;
     const node::Manager& node_;
     const node::FilterOracle& parent_;
@@ -121,13 +135,16 @@ private:
     cfilter::Header current_header_;
     block::Position best_position_;
     block::Position current_position_;
+    PrefetchWindow prefetch_;
+    JobCounter job_counter_;
 
-    auto calculate_next_block() noexcept -> bool;
+    auto calculate_next_blocks() noexcept -> bool;
     auto do_shutdown() noexcept -> void final;
     auto do_startup() noexcept -> void final;
     auto find_best_position(block::Position candidate) noexcept -> void;
     auto process_block(network::zeromq::Message&& in) noexcept -> void;
     auto process_block(block::Position&& position) noexcept -> void;
+    auto process_block_ready(network::zeromq::Message&& in) noexcept -> void;
     auto process_reindex(network::zeromq::Message&& in) noexcept -> void;
     auto process_reorg(network::zeromq::Message&& in) noexcept -> void;
     auto process_reorg(block::Position&& commonParent) noexcept -> void;
@@ -136,6 +153,7 @@ private:
         const BlockIndexerJob work,
         network::zeromq::Message&& msg) noexcept -> void;
     auto transition_state_shutdown() noexcept -> void;
+    auto update_prefetch(const Vector<block::Hash>& hashes) noexcept -> void;
     auto update_position(
         const block::Position& previousCfheader,
         const block::Position& previousCfilter,
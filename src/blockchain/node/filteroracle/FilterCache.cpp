@@ -0,0 +1,75 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"    // IWYU pragma: associated
+#include "1_Internal.hpp"  // IWYU pragma: associated
+#include "blockchain/node/filteroracle/FilterCache.hpp"  // IWYU pragma: associated
+
+#include <iterator>
+
+#include "internal/blockchain/bitcoin/cfilter/GCS.hpp"
+#include "internal/util/LogMacros.hpp"
+#include "opentxs/util/Log.hpp"
+
+namespace opentxs::blockchain::node::filteroracle
+{
+FilterCache::FilterCache(const std::size_t limit, allocator_type alloc) noexcept
+    : limit_(limit)
+    , bytes_(0)
+    , hits_(0)
+    , misses_(0)
+    , lru_(alloc)
+    , index_(alloc)
+{
+}
+
+auto FilterCache::find(const block::Hash& block, allocator_type alloc) noexcept
+    -> GCS
+{
+    if (auto i = index_.find(block); index_.end() != i) {
+        ++hits_;
+        auto& entry = i->second;
+        lru_.splice(lru_.end(), lru_, entry);
+
+        return {entry->filter_, alloc};
+    } else {
+        ++misses_;
+
+        return GCS{alloc};
+    }
+}
+
+auto FilterCache::push(const block::Hash& block, const GCS& filter) noexcept
+    -> void
+{
+    if (false == filter.IsValid()) { return; }
+
+    if (contains(block)) { return; }
+
+    const auto bytes = filter.Internal().CalculateSize();
+
+    if (bytes > limit_) { return; }
+
+    auto& entry = lru_.emplace_back(
+        Entry{block, GCS{filter, get_allocator()}, bytes});
+    index_.try_emplace(entry.block_, std::prev(lru_.end()));
+    bytes_ += bytes;
+
+    while ((bytes_ > limit_) && (false == lru_.empty())) {
+        const auto& oldest = lru_.front();
+        LogTrace()(OT_PRETTY_CLASS())("dropping cfilter for block ")(
+            oldest.block_.asHex())(" from cache due to exceeding byte limit")
+            .Flush();
+        bytes_ -= oldest.bytes_;
+        index_.erase(oldest.block_);
+        lru_.pop_front();
+    }
+}
+
+auto FilterCache::Stats() const noexcept -> CacheStats
+{
+    return {bytes_, lru_.size(), hits_, misses_};
+}
+}  // namespace opentxs::blockchain::node::filteroracle
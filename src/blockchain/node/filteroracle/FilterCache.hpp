@@ -0,0 +1,70 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <utility>
+
+#include "internal/blockchain/node/filteroracle/Types.hpp"
+#include "opentxs/blockchain/bitcoin/cfilter/GCS.hpp"
+#include "opentxs/blockchain/block/Hash.hpp"
+#include "opentxs/util/Allocated.hpp"
+#include "opentxs/util/Container.hpp"
+
+namespace opentxs::blockchain::node::filteroracle
+{
+/// Byte-limited LRU cache of parsed cfilters
+///
+/// A single instance is shared by every consumer of a FilterOracle so that
+/// wallet subchains scanning the same range of blocks only pay to load and
+/// parse each cfilter once. Entries are keyed by block hash and a cfilter
+/// never changes for a given block, so nothing needs to be evicted on reorg.
+class FilterCache final : public Allocated
+{
+public:
+    auto contains(const block::Hash& block) const noexcept -> bool
+    {
+        return 0u < index_.count(block);
+    }
+    auto get_allocator() const noexcept -> allocator_type final
+    {
+        return lru_.get_allocator();
+    }
+    auto Stats() const noexcept -> CacheStats;
+
+    /// Returns a copy of the cached filter, or an invalid filter if the block
+    /// is not in the cache
+    auto find(const block::Hash& block, allocator_type alloc) noexcept -> GCS;
+    /// Add a filter which was loaded from the database after a cache miss
+    auto push(const block::Hash& block, const GCS& filter) noexcept -> void;
+
+    FilterCache(const std::size_t limit, allocator_type alloc) noexcept;
+    FilterCache() = delete;
+    FilterCache(const FilterCache&) = delete;
+    FilterCache(FilterCache&&) = delete;
+    auto operator=(const FilterCache&) -> FilterCache& = delete;
+    auto operator=(FilterCache&&) -> FilterCache& = delete;
+
+    ~FilterCache() final = default;
+
+private:
+    struct Entry {
+        block::Hash block_;
+        GCS filter_;
+        std::size_t bytes_;
+    };
+
+    using LRU = List<Entry>;
+    using Index = UnorderedMap<block::Hash, LRU::iterator>;
+
+    const std::size_t limit_;
+    std::size_t bytes_;
+    std::size_t hits_;
+    std::size_t misses_;
+    LRU lru_;
+    Index index_;
+};
+}  // namespace opentxs::blockchain::node::filteroracle
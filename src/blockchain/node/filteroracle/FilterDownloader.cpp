@@ -7,9 +7,16 @@
 #include "1_Internal.hpp"  // IWYU pragma: associated
 #include "blockchain/node/filteroracle/FilterOracle.hpp"  // IWYU pragma: associated
 
+#include <cstddef>
+#include <exception>
+#include <utility>
+
 #include "blockchain/node/filteroracle/FilterDownloader.hpp"
+#include "internal/blockchain/Blockchain.hpp"
 #include "internal/blockchain/database/Cfilter.hpp"
 #include "internal/blockchain/node/Manager.hpp"
+#include "internal/util/LogMacros.hpp"
+#include "internal/util/P0330.hpp"
 
 namespace opentxs::blockchain::node::implementation
 {
@@ -150,20 +157,52 @@ auto FilterOracle::FilterDownloader::queue_processing(
 {
     if (data.empty()) { return; }
 
-    auto filters = Vector<database::Cfilter::CFilterParams>{};
+    // NOTE each filter is serialized once and the filter hashes for the whole
+    // batch are calculated together. The tasks in a batch are consecutive so
+    // the cfheaders are chained from the cfheader preceding the first task.
+    const auto count = data.size();
+    auto serialized = Vector<Vector<std::byte>>{};
+    auto views = Vector<ReadView>{};
+    serialized.reserve(count);
+    views.reserve(count);
 
     for (const auto& task : data) {
-        const auto& priorCfheader = task->previous_.get();
+        auto& bytes = serialized.emplace_back();
+        task->data_.get().Encode(writer(bytes));
+        views.emplace_back(reader(bytes));
+    }
+
+    auto [hashes, cfheaders] = [&] {
+        try {
+            auto filterHashes =
+                blockchain::internal::FiltersToHashes(api_, views, {});
+            auto filterHeaders = blockchain::internal::FilterHashesToHeaders(
+                api_, filterHashes, data.front()->previous_.get().Bytes(), {});
+
+            return std::make_pair(
+                std::move(filterHashes), std::move(filterHeaders));
+        } catch (const std::exception& e) {
+            LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+
+            OT_FAIL;
+        }
+    }();
+    auto filters = Vector<database::Cfilter::CFilterParams>{};
+    filters.reserve(count);
+
+    for (auto i = 0_uz; i < count; ++i) {
+        const auto& task = data[i];
         auto& cfilter = const_cast<GCS&>(task->data_.get());
         const auto& block = task->position_.hash_;
         const auto expected = db_.LoadFilterHash(type_, block.Bytes());
+        const auto& received = hashes[i];
 
-        if (expected == cfilter.Hash()) {
-            task->process(cfilter.Header(priorCfheader));
+        if (expected == received) {
+            task->process(std::move(cfheaders[i]));
             filters.emplace_back(block, std::move(cfilter));
         } else {
             LogError()("Filter for block ")(task->position_)(
-                " does not match header. Received: ")(cfilter.Hash().asHex())(
+                " does not match header. Received: ")(received.asHex())(
                 " expected: ")(expected.asHex())
                 .Flush();
             task->redownload();
@@ -13,6 +13,7 @@
 #include <exception>
 #include <future>
 #include <iterator>
+#include <optional>
 #include <stdexcept>
 #include <string_view>
 #include <tuple>
@@ -149,6 +150,8 @@ FilterOracle::FilterOracle(
     , chain_(chain)
     , default_type_(filter)
     , lock_()
+    , cache_(cache_limit_, alloc::Default{})
+    , matcher_()
     , new_filters_([&] {
         auto socket = api_.Network().ZeroMQ().PublishSocket();
         auto started = socket->Start(
@@ -224,6 +227,11 @@ FilterOracle::FilterOracle(
     compare_tips_to_checkpoint();
 }
 
+auto FilterOracle::CacheStats() const noexcept -> filteroracle::CacheStats
+{
+    return cache_.lock()->Stats();
+}
+
 auto FilterOracle::compare_header_to_checkpoint(
     const block::Position& block,
     const cfilter::Header& receivedHeader) noexcept -> block::Position
@@ -367,6 +375,12 @@ auto FilterOracle::Heartbeat() const noexcept -> void
     if ((Clock::now() - last_sync_progress_) > limit) {
         new_tip(lock, default_type_, database_.FilterTip(default_type_));
     }
+
+    const auto stats = CacheStats();
+    LogTrace()(OT_PRETTY_CLASS())(print(chain_))(" cfilter cache: ")(
+        stats.count_)(" filters, ")(stats.bytes_)(" bytes, ")(stats.hits_)(
+        " hits, ")(stats.misses_)(" misses")
+        .Flush();
 }
 
 auto FilterOracle::LoadFilter(
@@ -374,14 +388,86 @@ auto FilterOracle::LoadFilter(
     const block::Hash& block,
     alloc::Default alloc) const noexcept -> GCS
 {
-    return database_.LoadFilter(type, block.Bytes(), alloc);
+    if (type != default_type_) {
+
+        return database_.LoadFilter(type, block.Bytes(), alloc);
+    }
+
+    if (auto cached = cache_.lock()->find(block, alloc); cached.IsValid()) {
+
+        return cached;
+    }
+
+    auto output = database_.LoadFilter(type, block.Bytes(), alloc);
+    cache_.lock()->push(block, output);
+
+    return output;
 }
 
 auto FilterOracle::LoadFilters(
     const cfilter::Type type,
     const Vector<block::Hash>& blocks) const noexcept -> Vector<GCS>
 {
-    return database_.LoadFilters(type, blocks);
+    if (type != default_type_) { return database_.LoadFilters(type, blocks); }
+
+    const auto alloc = blocks.get_allocator();
+    auto output = Vector<GCS>{alloc};
+    output.reserve(blocks.size());
+    auto missing = Vector<block::Hash>{alloc};
+    missing.reserve(blocks.size());
+    auto i = blocks.cbegin();
+
+    // NOTE the database returns filters for the longest prefix of the
+    // requested blocks which it contains, so the cache must preserve that
+    // behavior: consecutive cache misses are loaded as a batch and the
+    // search stops at the first block for which no filter exists
+    while (blocks.cend() != i) {
+        {
+            auto handle = cache_.lock();
+            auto& cache = *handle;
+
+            for (; blocks.cend() != i; ++i) {
+                auto cached = cache.find(*i, alloc);
+
+                if (cached.IsValid()) {
+                    output.emplace_back(std::move(cached));
+                } else {
+
+                    break;
+                }
+            }
+
+            for (auto j = i; blocks.cend() != j; ++j) {
+                if (cache.contains(*j)) { break; }
+
+                missing.emplace_back(*j);
+            }
+        }
+
+        if (missing.empty()) { break; }
+
+        auto loaded = database_.LoadFilters(type, missing);
+        const auto complete = (loaded.size() == missing.size());
+
+        {
+            auto handle = cache_.lock();
+            auto& cache = *handle;
+            auto hash = missing.cbegin();
+
+            for (auto& filter : loaded) {
+                cache.push(*hash, filter);
+                output.emplace_back(std::move(filter));
+                ++hash;
+                ++i;
+            }
+        }
+
+        if (false == complete) { break; }
+
+        missing.clear();
+    }
+
+    return output;
 }
 
 auto FilterOracle::LoadFilterHeader(
@@ -414,6 +500,24 @@ auto FilterOracle::LoadFilterOrResetTip(
     return {};
 }
 
+auto FilterOracle::LoadSerializedFilters(
+    const cfilter::Type type,
+    const Vector<block::Hash>& blocks,
+    alloc::Default alloc) const noexcept -> Vector<Vector<std::byte>>
+{
+    return database_.LoadSerializedFilters(type, blocks, alloc);
+}
+
+auto FilterOracle::MatchPrehashed(
+    const cfilter::Type type,
+    const block::Hash& block,
+    const GCS& filter,
+    const blockchain::internal::GCS::PrehashedSets& targets) const noexcept
+    -> Vector<blockchain::internal::GCS::PrehashedMatches>
+{
+    return matcher_.Match(type, block, filter, targets);
+}
+
 auto FilterOracle::new_tip(
     const rLock&,
     const cfilter::Type type,
@@ -515,8 +619,19 @@ auto FilterOracle::ProcessBlock(
 {
     const auto& id = block.ID();
     const auto params = blockchain::internal::GetFilterParams(filterType);
+    const auto extracted = block.Internal().ExtractElements(filterType);
+
+    if (false == extracted.has_value()) {
+        LogError()(OT_PRETTY_CLASS())("failed to extract elements from ")(
+            print(chain_))(" block ")
+            .asHex(id)
+            .Flush();
+
+        return GCS{alloc};
+    }
+
     const auto elements = [&] {
-        const auto input = block.Internal().ExtractElements(filterType);
+        const auto& input = extracted.value();
         auto output = Vector<OTData>{};
         std::transform(
             input.begin(),
@@ -6,8 +6,10 @@
 #pragma once
 
 #include <boost/circular_buffer.hpp>
+#include <cs_plain_guarded.h>
 #include <atomic>
 #include <chrono>
+#include <cstddef>
 #include <functional>
 #include <future>
 #include <iosfwd>
@@ -19,6 +21,8 @@
 #include <utility>
 
 #include "1_Internal.hpp"
+#include "blockchain/node/filteroracle/FilterCache.hpp"
+#include "blockchain/node/filteroracle/Matcher.hpp"
 #include "core/Worker.hpp"
 #include "internal/blockchain/node/Types.hpp"
 #include "internal/blockchain/node/filteroracle/FilterOracle.hpp"
@@ -50,6 +54,7 @@
 #include "opentxs/util/Pimpl.hpp"
 #include "opentxs/util/Time.hpp"
 #include "opentxs/util/WorkType.hpp"
+#include "util/ByteLiterals.hpp"
 #include "util/JobCounter.hpp"
 #include "util/Work.hpp"
 
@@ -148,6 +153,7 @@ public:
 
     static auto to_str(Work) -> std::string;
 
+    auto CacheStats() const noexcept -> filteroracle::CacheStats final;
     auto DefaultType() const noexcept -> cfilter::Type final
     {
         return default_type_;
@@ -170,6 +176,17 @@ public:
         const cfilter::Type type,
         const block::Position& position,
         alloc::Default alloc) const noexcept -> GCS final;
+    auto LoadSerializedFilters(
+        const cfilter::Type type,
+        const Vector<block::Hash>& blocks,
+        alloc::Default alloc) const noexcept
+        -> Vector<Vector<std::byte>> final;
+    auto MatchPrehashed(
+        const cfilter::Type type,
+        const block::Hash& block,
+        const GCS& filter,
+        const blockchain::internal::GCS::PrehashedSets& targets) const noexcept
+        -> Vector<blockchain::internal::GCS::PrehashedMatches> final;
     auto ProcessBlock(const bitcoin::block::Block& block) const noexcept
         -> bool final;
     auto ProcessBlock(
@@ -211,8 +228,10 @@ private:
     using ChainMap = UnallocatedMap<block::Height, FilterHeaderMap>;
     using CheckpointMap = UnallocatedMap<blockchain::Type, ChainMap>;
     using OutstandingMap = UnallocatedMap<int, std::atomic_int>;
+    using Cache = libguarded::plain_guarded<filteroracle::FilterCache>;
 
     static const CheckpointMap filter_checkpoints_;
+    static constexpr auto cache_limit_ = std::size_t{64_MiB};
 
     const api::Session& api_;
     const internal::Manager& node_;
@@ -222,6 +241,8 @@ private:
     const blockchain::Type chain_;
     const cfilter::Type default_type_;
     mutable std::recursive_mutex lock_;
+    mutable Cache cache_;
+    const filteroracle::Matcher matcher_;
     OTZMQPublishSocket new_filters_;
     const filteroracle::NotifyCallback cb_;
     mutable std::unique_ptr<FilterDownloader> filter_downloader_;
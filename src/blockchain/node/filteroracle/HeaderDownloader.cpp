@@ -170,19 +170,36 @@ auto FilterOracle::HeaderDownloader::queue_processing(
 {
     if (data.empty()) { return; }
 
+    // NOTE the tasks in a batch are consecutive so the entire cfheader chain
+    // can be calculated before any of them are processed
     auto hashes = Vector<cfilter::Hash>{};
+    hashes.reserve(data.size());
+
+    for (const auto& task : data) { hashes.emplace_back(task->data_.get()); }
+
+    auto cfheaders = [&] {
+        try {
+
+            return blockchain::internal::FilterHashesToHeaders(
+                api_, hashes, data.front()->previous_.get().Bytes(), {});
+        } catch (const std::exception& e) {
+            LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+
+            OT_FAIL;
+        }
+    }();
     auto headers = Vector<database::Cfilter::CFHeaderParams>{};
+    headers.reserve(data.size());
+    auto hash = hashes.begin();
+    auto header = cfheaders.begin();
 
     for (const auto& task : data) {
-        const auto& hash = hashes.emplace_back(task->data_.get());
-        auto header = blockchain::internal::FilterHashToHeader(
-            api_, hash.Bytes(), task->previous_.get().Bytes());
         const auto& position = task->position_;
-        const auto check = checkpoint_(position, header);
+        const auto check = checkpoint_(position, *header);
 
         if (check == position) {
-            headers.emplace_back(position.hash_, header, hash);
-            task->process(std::move(header));
+            headers.emplace_back(position.hash_, *header, std::move(*hash));
+            task->process(std::move(*header));
         } else {
             const auto good = db_.LoadFilterHeader(type_, check.hash_.Bytes());
 
@@ -193,7 +210,12 @@ auto FilterOracle::HeaderDownloader::queue_processing(
             work.AddFrame(check.hash_);
             work.AddFrame(good);
             pipeline_.Push(std::move(work));
+
+            break;
         }
+
+        ++hash;
+        ++header;
     }
 
     const auto saved = db_.StoreFilterHeaders(type_, std::move(headers));
@@ -0,0 +1,100 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"    // IWYU pragma: associated
+#include "1_Internal.hpp"  // IWYU pragma: associated
+#include "blockchain/node/filteroracle/Matcher.hpp"  // IWYU pragma: associated
+
+#include <iterator>
+#include <utility>
+
+#include "internal/util/LogMacros.hpp"
+#include "opentxs/blockchain/bitcoin/cfilter/GCS.hpp"
+
+namespace opentxs::blockchain::node::filteroracle
+{
+Matcher::Matcher() noexcept
+    : pending_()
+{
+}
+
+auto Matcher::Match(
+    const cfilter::Type type,
+    const block::Hash& block,
+    const GCS& filter,
+    const Sets& targets) const noexcept -> Results
+{
+    const auto key = Key{type, block};
+    auto request = Request{targets, {}};
+    auto future = request.promise_.get_future();
+
+    const auto join = [&] {
+        auto handle = pending_.lock();
+        auto& batch = (*handle)[key];
+        batch.queue_.emplace_back(&request);
+
+        if (batch.running_) { return true; }
+
+        batch.running_ = true;
+
+        return false;
+    }();
+
+    // NOTE another thread is already matching this block and will pick up the
+    // request on its next pass
+    if (join) { return future.get(); }
+
+    while (true) {
+        auto queue = Vector<Request*>{};
+
+        {
+            auto handle = pending_.lock();
+            auto i = handle->find(key);
+
+            OT_ASSERT(handle->end() != i);
+
+            auto& batch = i->second;
+
+            if (batch.queue_.empty()) {
+                handle->erase(i);
+
+                break;
+            }
+
+            queue.swap(batch.queue_);
+        }
+
+        run(filter, queue);
+    }
+
+    return future.get();
+}
+
+auto Matcher::run(const GCS& filter, const Vector<Request*>& batch) noexcept
+    -> void
+{
+    auto sets = Sets{};
+
+    for (const auto* request : batch) {
+        const auto& targets = request->targets_;
+        sets.insert(sets.end(), targets.begin(), targets.end());
+    }
+
+    auto results = filter.Internal().Match(sets, {});
+
+    OT_ASSERT(results.size() == sets.size());
+
+    auto result = results.begin();
+
+    for (auto* request : batch) {
+        const auto count = request->targets_.size();
+        auto output = Results{};
+        output.reserve(count);
+        std::move(result, std::next(result, count), std::back_inserter(output));
+        std::advance(result, count);
+        request->promise_.set_value(std::move(output));
+    }
+}
+}  // namespace opentxs::blockchain::node::filteroracle
@@ -0,0 +1,80 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cs_plain_guarded.h>
+#include <future>
+#include <utility>
+
+#include "internal/blockchain/bitcoin/cfilter/GCS.hpp"
+#include "opentxs/blockchain/bitcoin/cfilter/FilterType.hpp"
+#include "opentxs/blockchain/block/Hash.hpp"
+#include "opentxs/util/Container.hpp"
+
+// NOLINTBEGIN(modernize-concat-nested-namespaces)
+namespace opentxs  // NOLINT
+{
+// inline namespace v1
+// {
+namespace blockchain
+{
+class GCS;
+}  // namespace blockchain
+// }  // namespace v1
+}  // namespace opentxs
+// NOLINTEND(modernize-concat-nested-namespaces)
+
+namespace opentxs::blockchain::node::filteroracle
+{
+/// Combines concurrent prehashed cfilter matches for the same filter
+///
+/// Wallet subchains which scan the same blocks at the same time submit their
+/// targets here instead of matching against the filter individually. The first
+/// caller for a given filter type and block runs the match immediately on its
+/// own thread. Requests which arrive while that pass is running are queued and
+/// served together by the next pass, which is also run by the first caller, so
+/// the compressed filter is decoded once per batch instead of once per
+/// subchain.
+class Matcher
+{
+public:
+    using Sets = blockchain::internal::GCS::PrehashedSets;
+    using Results = Vector<blockchain::internal::GCS::PrehashedMatches>;
+
+    /// Returns one entry per element of targets, in the same order
+    auto Match(
+        const cfilter::Type type,
+        const block::Hash& block,
+        const GCS& filter,
+        const Sets& targets) const noexcept -> Results;
+
+    Matcher() noexcept;
+    Matcher(const Matcher&) = delete;
+    Matcher(Matcher&&) = delete;
+    auto operator=(const Matcher&) -> Matcher& = delete;
+    auto operator=(Matcher&&) -> Matcher& = delete;
+
+    ~Matcher() = default;
+
+private:
+    struct Request {
+        const Sets& targets_;
+        std::promise<Results> promise_;
+    };
+    struct Batch {
+        Vector<Request*> queue_{};
+        bool running_{false};
+    };
+
+    using Key = std::pair<cfilter::Type, block::Hash>;
+    using Pending = libguarded::plain_guarded<Map<Key, Batch>>;
+
+    mutable Pending pending_;
+
+    static auto run(const GCS& filter, const Vector<Request*>& batch) noexcept
+        -> void;
+};
+}  // namespace opentxs::blockchain::node::filteroracle
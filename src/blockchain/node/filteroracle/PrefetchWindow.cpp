@@ -0,0 +1,81 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"    // IWYU pragma: associated
+#include "1_Internal.hpp"  // IWYU pragma: associated
+#include "blockchain/node/filteroracle/PrefetchWindow.hpp"  // IWYU pragma: associated
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+#include "internal/util/LogMacros.hpp"
+#include "internal/util/P0330.hpp"
+
+namespace opentxs::blockchain::node::filteroracle
+{
+PrefetchWindow::PrefetchWindow(
+    std::size_t limit,
+    allocator_type alloc) noexcept
+    : limit_(limit)
+    , blocks_(alloc)
+{
+    OT_ASSERT(0_uz < limit_);
+}
+
+auto PrefetchWindow::at(std::size_t index) const noexcept -> const value_type&
+{
+    OT_ASSERT(index < blocks_.size());
+
+    return blocks_[index];
+}
+
+auto PrefetchWindow::front() const noexcept -> const value_type&
+{
+    OT_ASSERT(false == blocks_.empty());
+
+    return blocks_.front();
+}
+
+auto PrefetchWindow::pop_front(std::size_t count) noexcept -> void
+{
+    blocks_.erase(
+        blocks_.begin(),
+        std::next(
+            blocks_.begin(),
+            static_cast<std::ptrdiff_t>(std::min(count, blocks_.size()))));
+}
+
+auto PrefetchWindow::Update(
+    const Vector<block::Hash>& hashes,
+    const Request& request) noexcept -> void
+{
+    const auto target = std::min(hashes.size(), limit_);
+    // NOTE discard prefetched blocks which are no longer in the best chain
+    const auto end = std::min(target, blocks_.size());
+    auto keep = 0_uz;
+
+    while ((keep < end) && (blocks_[keep].first == hashes[keep])) { ++keep; }
+
+    blocks_.erase(
+        std::next(blocks_.begin(), static_cast<std::ptrdiff_t>(keep)),
+        blocks_.end());
+
+    if (blocks_.size() >= target) { return; }
+
+    const auto first = hashes.begin();
+    const auto next = Vector<block::Hash>{
+        std::next(first, static_cast<std::ptrdiff_t>(blocks_.size())),
+        std::next(first, static_cast<std::ptrdiff_t>(target)),
+        get_allocator()};
+    auto futures = request(next);
+
+    OT_ASSERT(futures.size() == next.size());
+
+    for (auto i = 0_uz; i < next.size(); ++i) {
+        blocks_.emplace_back(next[i], std::move(futures[i]));
+    }
+}
+}  // namespace opentxs::blockchain::node::filteroracle
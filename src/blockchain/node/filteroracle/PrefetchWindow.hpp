@@ -0,0 +1,65 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <utility>
+
+#include "opentxs/blockchain/block/Hash.hpp"
+#include "opentxs/blockchain/node/Types.hpp"
+#include "opentxs/util/Allocated.hpp"
+#include "opentxs/util/Container.hpp"
+
+namespace opentxs::blockchain::node::filteroracle
+{
+/// Blocks requested from the block oracle ahead of the indexing position
+///
+/// The window holds at most limit_ blocks, in best chain order starting from
+/// the block after the current position.
+class PrefetchWindow final : public Allocated
+{
+public:
+    using value_type = std::pair<block::Hash, BitcoinBlockResult>;
+    using Request =
+        std::function<BitcoinBlockResults(const Vector<block::Hash>&)>;
+
+    const std::size_t limit_;
+
+    auto at(std::size_t index) const noexcept -> const value_type&;
+    auto empty() const noexcept -> bool { return blocks_.empty(); }
+    auto front() const noexcept -> const value_type&;
+    auto get_allocator() const noexcept -> allocator_type final
+    {
+        return blocks_.get_allocator();
+    }
+    auto size() const noexcept -> std::size_t { return blocks_.size(); }
+
+    auto clear() noexcept -> void { blocks_.clear(); }
+    /// Remove up to count blocks from the front of the window
+    auto pop_front(std::size_t count) noexcept -> void;
+    /// Synchronize the window with the best chain
+    ///
+    /// Blocks which are already in the window at the same offset are kept and
+    /// everything after the first mismatch is discarded. Only the blocks which
+    /// are missing from the window are passed to request.
+    auto Update(
+        const Vector<block::Hash>& hashes,
+        const Request& request) noexcept -> void;
+
+    PrefetchWindow(std::size_t limit, allocator_type alloc) noexcept;
+    PrefetchWindow() = delete;
+    PrefetchWindow(const PrefetchWindow&) = delete;
+    PrefetchWindow(PrefetchWindow&&) = delete;
+    auto operator=(const PrefetchWindow&) -> PrefetchWindow& = delete;
+    auto operator=(PrefetchWindow&&) -> PrefetchWindow& = delete;
+
+    ~PrefetchWindow() final = default;
+
+private:
+    Deque<value_type> blocks_;
+};
+}  // namespace opentxs::blockchain::node::filteroracle
@@ -0,0 +1,53 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"    // IWYU pragma: associated
+#include "1_Internal.hpp"  // IWYU pragma: associated
+#include "blockchain/node/filteroracle/ProcessBatch.hpp"  // IWYU pragma: associated
+
+#include <algorithm>
+#include <memory>
+
+#include "internal/util/P0330.hpp"
+#include "util/JobCounter.hpp"
+#include "util/ScopeGuard.hpp"
+
+namespace opentxs::blockchain::node::filteroracle
+{
+auto ProcessBatch(
+    const std::size_t batch,
+    const std::size_t jobs,
+    JobCounter& counter,
+    const BatchPost& post,
+    const BatchJob& process) noexcept -> void
+{
+    const auto tasks = std::min(batch, std::max(jobs, 1_uz));
+
+    if (1_uz < tasks) {
+        // NOTE the destructor of outstanding blocks until every posted task
+        // has finished
+        auto outstanding = counter.Allocate();
+
+        for (auto n = 0_uz; n < tasks; ++n) {
+            const auto posted = post(
+                [&process,
+                 batch,
+                 tasks,
+                 n,
+                 guard = std::make_shared<ScopeGuard>(
+                     [&outstanding] { ++outstanding; },
+                     [&outstanding] { --outstanding; })] {
+                    for (auto i = n; i < batch; i += tasks) { process(i); }
+                });
+
+            if (false == posted) {
+                for (auto i = n; i < batch; i += tasks) { process(i); }
+            }
+        }
+    } else {
+        for (auto i = 0_uz; i < batch; ++i) { process(i); }
+    }
+}
+}  // namespace opentxs::blockchain::node::filteroracle
@@ -0,0 +1,40 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+#include "opentxs/util/Types.hpp"
+
+// NOLINTBEGIN(modernize-concat-nested-namespaces)
+namespace opentxs  // NOLINT
+{
+// inline namespace v1
+// {
+class JobCounter;
+// }  // namespace v1
+}  // namespace opentxs
+// NOLINTEND(modernize-concat-nested-namespaces)
+
+namespace opentxs::blockchain::node::filteroracle
+{
+using BatchJob = std::function<void(std::size_t)>;
+using BatchPost = std::function<bool(SimpleCallback)>;
+
+/// Calls process exactly once for every index in [0, batch)
+///
+/// The indices are divided between at most jobs tasks which are handed to
+/// post. A task which can not be posted runs on the calling thread, as does
+/// the entire batch when only one task is needed. Returns after every index
+/// has been processed.
+auto ProcessBatch(
+    const std::size_t batch,
+    const std::size_t jobs,
+    JobCounter& counter,
+    const BatchPost& post,
+    const BatchJob& process) noexcept -> void;
+}  // namespace opentxs::blockchain::node::filteroracle
@@ -42,6 +42,7 @@
 #include "internal/core/PaymentCode.hpp"
 #include "internal/identity/Nym.hpp"
 #include "internal/network/p2p/Factory.hpp"
+#include "internal/util/P0330.hpp"
 #include "opentxs/api/crypto/Blockchain.hpp"
 #include "opentxs/api/network/Asio.hpp"
 #include "opentxs/api/network/Blockchain.hpp"
@@ -276,6 +277,7 @@ Base::Base(
     , header_p_(factory::HeaderOracle(api, *database_p_, chain_))
     , block_(factory::BlockOracle(
           api,
+          config_,
           *this,
           *header_p_,
           *database_p_,
@@ -377,7 +379,7 @@ Base::Base(
     OT_ASSERT(peer_p_);
     OT_ASSERT(wallet_p_);
 
-    header_.Internal().Init();
+    header_.Internal().Init(config_);
     init_executor({UnallocatedCString{
         api_.Endpoints().Internal().BlockchainFilterUpdated(chain_)}});
     LogVerbose()(config_.print()).Flush();
@@ -481,7 +483,9 @@ auto Base::AddBlock(const std::shared_ptr<const bitcoin::block::Block> pBlock)
 
     const auto& id = block.ID();
 
-    if (std::future_status::ready != block_.LoadBitcoin(id).wait_for(60s)) {
+    const auto future = block_.LoadBitcoin(id, BlockCacheConsumer::manager);
+
+    if (std::future_status::ready != future.wait_for(60s)) {
         LogError()(OT_PRETTY_CLASS())("failed to load ")(print(chain_))(
             " block")
             .Flush();
@@ -842,10 +846,20 @@ auto Base::process_header(network::zeromq::Message&& in) noexcept -> void
     }
 
     auto headers = UnallocatedVector<std::unique_ptr<block::Header>>{};
-
-    for (const auto& header : input) {
-        headers.emplace_back(instantiate_header(header));
-    }
+    headers.resize(input.size());
+    // NOTE parsing, hashing, and proof of work validation do not depend on the
+    // state of the chain so every header is instantiated independently. Proof
+    // of work hashing is expensive for some chains so the batch is split more
+    // finely than the default.
+    blockchain::internal::ForEachParallel(
+        api_,
+        input.size(),
+        [&](const std::size_t first, const std::size_t last) {
+            for (auto i = first; i < last; ++i) {
+                headers[i] = instantiate_header(input[i]);
+            }
+        },
+        64_uz);
 
     if (!headers.empty()) { header_.AddHeaders(headers); }
 
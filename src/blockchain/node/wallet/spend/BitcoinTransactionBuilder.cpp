@@ -10,6 +10,7 @@
 #include <boost/endian/buffers.hpp>
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
@@ -24,6 +25,7 @@
 
 #include "Proto.hpp"
 #include "internal/api/crypto/Blockchain.hpp"
+#include "internal/api/network/Asio.hpp"
 #include "internal/api/session/FactoryAPI.hpp"
 #include "internal/blockchain/Blockchain.hpp"
 #include "internal/blockchain/Params.hpp"
@@ -88,6 +90,15 @@ namespace be = boost::endian;
 namespace opentxs::blockchain::node::wallet
 {
 struct BitcoinTransactionBuilder::Imp {
+    auto FundingTarget() const noexcept -> Amount
+    {
+        const auto required = output_value_ + required_fee();
+
+        if (input_value_ > required) { return Amount{0}; }
+
+        // NOTE IsFunded requires the input value to exceed the requirement
+        return (required - input_value_) + Amount{1};
+    }
     auto IsFunded() const noexcept -> bool
     {
         return input_value_ > (output_value_ + required_fee());
@@ -363,20 +374,34 @@ struct BitcoinTransactionBuilder::Imp {
     }
     auto SignInputs() noexcept -> bool
     {
-        auto index = int{-1};
         auto txcopy = Transaction{};
         auto bip143 = std::optional<bitcoin::Bip143Hashes>{};
 
-        for (const auto& [input, value] : inputs_) {
-            if (!sign_input(++index, *input, txcopy, bip143)) {
-                LogError()(OT_PRETTY_CLASS())("Failed to sign input ")(index)
-                    .Flush();
+        if (false == prepare_signing(txcopy, bip143)) { return false; }
 
-                return false;
-            }
-        }
+        // NOTE every input signs its own preimage so after the shared state
+        // has been prepared the inputs can be signed in any order
+        auto failed = std::atomic<bool>{false};
+        blockchain::internal::ForEachParallel(
+            api_,
+            ThreadPool::General,
+            inputs_.size(),
+            [&](const auto first, const auto last) {
+                for (auto i = first; i < last; ++i) {
+                    const auto index = static_cast<int>(i);
+                    auto& input = *inputs_[i].first;
+
+                    if (!sign_input(index, input, txcopy, bip143)) {
+                        LogError()(OT_PRETTY_CLASS())("Failed to sign input ")(
+                            index)
+                            .Flush();
+                        failed.store(true);
+                    }
+                }
+            },
+            signing_chunk_);
 
-        return true;
+        return false == failed.load();
     }
 
     Imp(const api::Session& api,
@@ -445,7 +470,10 @@ private:
     using Bip143 = std::optional<bitcoin::Bip143Hashes>;
     using Hash = std::array<std::byte, 32>;
 
+    enum class Signing { Unsupported, BCH, BTC, Segwit };
+
     static constexpr auto p2pkh_output_bytes_ = 34_uz;
+    static constexpr auto signing_chunk_ = 16_uz;
 
     const api::Session& api_;
     const Nym_p sender_;
@@ -1007,41 +1035,63 @@ private:
     {
         return (bytes() * fee_rate_) / 1000;
     }
+    auto prepare_signing(Transaction& txcopy, Bip143& bip143) const noexcept
+        -> bool
+    {
+        for (const auto& [input, value] : inputs_) {
+            switch (signing_mode(*input)) {
+                case Signing::Segwit: {
+                    segwit_ = true;
+                    [[fallthrough]];
+                }
+                case Signing::BCH: {
+                    if (!init_bip143(bip143)) {
+                        LogError()(OT_PRETTY_CLASS())(
+                            "Error instantiating bip143")
+                            .Flush();
+
+                        return false;
+                    }
+                } break;
+                case Signing::BTC: {
+                    if (!init_txcopy(txcopy)) {
+                        LogError()(OT_PRETTY_CLASS())(
+                            "Error instantiating txcopy")
+                            .Flush();
+
+                        return false;
+                    }
+                } break;
+                case Signing::Unsupported:
+                default: {
+                    LogError()(OT_PRETTY_CLASS())("Unsupported chain").Flush();
+
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
     auto sign_input(
         const int index,
         bitcoin::block::internal::Input& input,
-        Transaction& txcopy,
-        Bip143& bip143) const noexcept -> bool
+        const Transaction& txcopy,
+        const Bip143& bip143) const noexcept -> bool
     {
-        switch (chain_) {
-            case Type::BitcoinCash:
-            case Type::BitcoinCash_testnet3:
-            case Type::BitcoinSV:
-            case Type::BitcoinSV_testnet3:
-            case Type::eCash:
-            case Type::eCash_testnet3: {
+        switch (signing_mode(input)) {
+            case Signing::BCH:
+            case Signing::Segwit: {
+                OT_ASSERT(bip143.has_value());
 
-                return sign_input_bch(index, input, bip143);
+                return sign_input_bip143(index, input, bip143.value());
             }
-            case Type::Bitcoin:
-            case Type::Bitcoin_testnet3:
-            case Type::Litecoin:
-            case Type::Litecoin_testnet4:
-            case Type::PKT:
-            case Type::PKT_testnet:
-            case Type::UnitTest: {
-                if (is_segwit(input)) {
-
-                    return sign_input_segwit(index, input, bip143);
-                }
+            case Signing::BTC: {
+                OT_ASSERT(txcopy);
 
-                return sign_input_btc(index, input, txcopy);
+                return sign_input_btc(index, input, *txcopy);
             }
-            case Type::Unknown:
-            case Type::Ethereum_frontier:
-            case Type::Ethereum_ropsten:
-            case Type::Casper:
-            case Type::Casper_testnet:
+            case Signing::Unsupported:
             default: {
                 LogError()(OT_PRETTY_CLASS())("Unsupported chain").Flush();
 
@@ -1049,19 +1099,13 @@ private:
             }
         }
     }
-    auto sign_input_bch(
+    auto sign_input_bip143(
         const int index,
         bitcoin::block::internal::Input& input,
-        Bip143& bip143) const noexcept -> bool
+        const bitcoin::Bip143Hashes& bip143) const noexcept -> bool
     {
-        if (!init_bip143(bip143)) {
-            LogError()(OT_PRETTY_CLASS())("Error instantiating bip143").Flush();
-
-            return false;
-        }
-
         const auto sigHash = blockchain::bitcoin::SigHash{chain_};
-        const auto preimage = bip143->Preimage(
+        const auto preimage = bip143.Preimage(
             index, outputs_.size(), version_, lock_time_, sigHash, input);
 
         return add_signatures(reader(preimage), sigHash, input);
@@ -1069,16 +1113,11 @@ private:
     auto sign_input_btc(
         const int index,
         bitcoin::block::internal::Input& input,
-        Transaction& txcopy) const noexcept -> bool
+        const bitcoin::block::internal::Transaction& txcopy) const noexcept
+        -> bool
     {
-        if (!init_txcopy(txcopy)) {
-            LogError()(OT_PRETTY_CLASS())("Error instantiating txcopy").Flush();
-
-            return false;
-        }
-
         const auto sigHash = blockchain::bitcoin::SigHash{chain_};
-        auto preimage = txcopy->GetPreimageBTC(index, sigHash);
+        auto preimage = txcopy.GetPreimageBTC(index, sigHash);
 
         if (preimage.empty()) {
             LogError()(OT_PRETTY_CLASS())("Error obtaining signing preimage")
@@ -1091,23 +1130,40 @@ private:
 
         return add_signatures(reader(preimage), sigHash, input);
     }
-    auto sign_input_segwit(
-        const int index,
-        bitcoin::block::internal::Input& input,
-        Bip143& bip143) const noexcept -> bool
+    auto signing_mode(const bitcoin::block::internal::Input& input)
+        const noexcept -> Signing
     {
-        if (!init_bip143(bip143)) {
-            LogError()(OT_PRETTY_CLASS())("Error instantiating bip143").Flush();
+        switch (chain_) {
+            case Type::BitcoinCash:
+            case Type::BitcoinCash_testnet3:
+            case Type::BitcoinSV:
+            case Type::BitcoinSV_testnet3:
+            case Type::eCash:
+            case Type::eCash_testnet3: {
 
-            return false;
-        }
+                return Signing::BCH;
+            }
+            case Type::Bitcoin:
+            case Type::Bitcoin_testnet3:
+            case Type::Litecoin:
+            case Type::Litecoin_testnet4:
+            case Type::PKT:
+            case Type::PKT_testnet:
+            case Type::UnitTest: {
+                if (is_segwit(input)) { return Signing::Segwit; }
 
-        segwit_ = true;
-        const auto sigHash = blockchain::bitcoin::SigHash{chain_};
-        const auto preimage = bip143->Preimage(
-            index, outputs_.size(), version_, lock_time_, sigHash, input);
+                return Signing::BTC;
+            }
+            case Type::Unknown:
+            case Type::Ethereum_frontier:
+            case Type::Ethereum_ropsten:
+            case Type::Casper:
+            case Type::Casper_testnet:
+            default: {
 
-        return add_signatures(reader(preimage), sigHash, input);
+                return Signing::Unsupported;
+            }
+        }
     }
     enum class Match : bool { ByValue, ByHash };
     auto validate(
@@ -1310,6 +1366,11 @@ auto BitcoinTransactionBuilder::FinalizeTransaction() noexcept -> Transaction
     return imp_->FinalizeTransaction();
 }
 
+auto BitcoinTransactionBuilder::FundingTarget() const noexcept -> Amount
+{
+    return imp_->FundingTarget();
+}
+
 auto BitcoinTransactionBuilder::IsFunded() const noexcept -> bool
 {
     return imp_->IsFunded();
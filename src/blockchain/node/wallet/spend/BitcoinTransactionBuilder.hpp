@@ -104,6 +104,8 @@ public:
     using KeyID = blockchain::crypto::Key;
     using Proposal = proto::BlockchainTransactionProposal;
 
+    // Value the inputs must provide after deducting the fees for spending them
+    auto FundingTarget() const noexcept -> Amount;
     auto IsFunded() const noexcept -> bool;
     auto Spender() const noexcept -> const identifier::Nym&;
 
@@ -217,8 +217,9 @@ private:
         auto output = BuildResult::Success;
         auto rc = SendResult::UnspecifiedError;
         auto txid{blank};
-        auto builder = BitcoinTransactionBuilder{
-            api_, db_, id, proposal, chain_, node_.FeeRate()};
+        const auto feeRate = node_.FeeRate();
+        auto builder =
+            BitcoinTransactionBuilder{api_, db_, id, proposal, chain_, feeRate};
         auto post = ScopeGuard{[&] {
             switch (output) {
                 case BuildResult::TemporaryFailure: {
@@ -252,6 +253,29 @@ private:
             return output;
         }
 
+        {
+            auto policy = node::internal::SpendPolicy{};
+            const auto utxos = db_.ReserveUTXOs(
+                builder.Spender(),
+                id,
+                builder.FundingTarget(),
+                feeRate,
+                policy);
+
+            for (const auto& utxo : utxos) {
+                if (!builder.AddInput(utxo)) {
+                    LogError()(OT_PRETTY_CLASS())("Failed to add input")
+                        .Flush();
+                    output = BuildResult::PermanentFailure;
+                    rc = SendResult::InputCreationError;
+
+                    return output;
+                }
+            }
+        }
+
+        // NOTE coin selection uses estimated input sizes so the selected
+        // inputs may fall slightly short of the actual fee
         while (!builder.IsFunded()) {
             auto policy = node::internal::SpendPolicy{};
             auto utxo = db_.ReserveUTXO(builder.Spender(), id, policy);
@@ -19,6 +19,7 @@
 #include <iterator>
 #include <memory>
 #include <numeric>
+#include <optional>
 #include <sstream>
 #include <stdexcept>
 #include <thread>
@@ -210,7 +211,8 @@ public:
     }
 
     PrehashData(
-        const api::Session& api,
+        const node::internal::FilterOracle& filters,
+        const cfilter::Type type,
         const BlockTargets& targets,
         const std::string_view name,
         wallet::MatchCache::Results& results,
@@ -218,7 +220,8 @@ public:
         std::size_t jobs,
         allocator_type alloc) noexcept
         : job_count_(jobs)
-        , api_(api)
+        , filters_(filters)
+        , type_(type)
         , targets_(targets)
         , name_(name)
         , data_(alloc)
@@ -227,18 +230,10 @@ public:
 
         data_.reserve(targets.size());
 
-        for (const auto& [block, elements] : targets) {
-            const auto& [e20, e32, e33, e64, e65, eTxo] = elements;
-            auto& [height, data20, data32, data33, data64, data65, dataTxo] =
-                data_.emplace_back();
-            data20.first.reserve(e20.first.size());
-            data32.first.reserve(e32.first.size());
-            data33.first.reserve(e33.first.size());
-            data64.first.reserve(e64.first.size());
-            data65.first.reserve(e65.first.size());
-            dataTxo.first.reserve(eTxo.first.size());
+        for (const auto& target : targets) {
+            auto& height = std::get<0>(data_.emplace_back());
             height = start++;
-            results[block::Position{height, block}];
+            results[block::Position{height, target.first}];
         }
 
         OT_ASSERT(targets_.size() == data_.size());
@@ -261,7 +256,8 @@ private:
         TxoData>;
     using Data = Vector<BlockData>;
 
-    const api::Session& api_;
+    const node::internal::FilterOracle& filters_;
+    const cfilter::Type type_;
     const BlockTargets& targets_;
     const std::string_view name_;
     Data data_;
@@ -288,14 +284,13 @@ private:
             blockchain::internal::BlockHashToFilterKey(block.Bytes());
         const auto& [indices, bytes] = targets;
         auto& [hashes, map] = dest;
+        hashes = gcs::Siphash(key, bytes, hashes.get_allocator());
+
+        OT_ASSERT(hashes.size() == indices.size());
+
         auto i = indices.cbegin();
-        auto t = bytes.cbegin();
-        auto end = indices.cend();
 
-        for (; i < end; ++i, ++t) {
-            auto& hash = hashes.emplace_back(gcs::Siphash(api_, key, *t));
-            map[hash].emplace_back(&(*i));
-        }
+        for (const auto& hash : hashes) { map[hash].emplace_back(&(*i++)); }
 
         dedup(hashes);
     }
@@ -310,29 +305,34 @@ private:
         wallet::MatchCache::Index& results) const noexcept -> void
     {
         const auto alloc = results.get_allocator();
-        const auto GetKeys = [&](const auto& data) {
-            auto out = Set<Bip32Index>{alloc};
-            const auto& [hashes, map] = data;
-            const auto start = hashes.cbegin();
-
-            for (const auto& match : cfilter.Internal().Match(hashes)) {
-                const auto dist = std::distance(start, match);
-
-                OT_ASSERT(0 <= dist);
-
-                const auto& hash = hashes.at(static_cast<std::size_t>(dist));
-
-                for (const auto* item : map.at(hash)) { out.emplace(*item); }
-            }
-
-            return out;
-        };
-        const auto GetOutpoints = [&](const auto& data) {
-            auto out = Set<block::Outpoint>{alloc};
+        const auto& [height, p20, p32, p33, p64, p65, pTxo] = prehashed;
+        // NOTE all six target classes are matched in a single pass over the
+        // filter, which may also be shared with other subchains scanning the
+        // same block
+        const auto matched = filters_.MatchPrehashed(
+            type_,
+            position.hash_,
+            cfilter,
+            [&] {
+                auto out = blockchain::internal::GCS::PrehashedSets{alloc};
+                out.reserve(6u);
+                out.emplace_back(&p20.first);
+                out.emplace_back(&p32.first);
+                out.emplace_back(&p33.first);
+                out.emplace_back(&p64.first);
+                out.emplace_back(&p65.first);
+                out.emplace_back(&pTxo.first);
+
+                return out;
+            }());
+
+        OT_ASSERT(6u == matched.size());
+
+        const auto Get = [&](const auto& data, const auto& matches, auto out) {
             const auto& [hashes, map] = data;
             const auto start = hashes.cbegin();
 
-            for (const auto& match : cfilter.Internal().Match(hashes)) {
+            for (const auto& match : matches) {
                 const auto dist = std::distance(start, match);
 
                 OT_ASSERT(0 <= dist);
@@ -344,13 +344,14 @@ private:
 
             return out;
         };
-        const auto GetResults = [&](const auto& cb,
-                                    const auto& prehashed,
+        const auto GetResults = [&](const auto& prehashed,
+                                    const auto& matched,
                                     const auto& selected,
                                     auto& clean,
                                     auto& dirty,
                                     auto& output) {
-            const auto matches = cb(prehashed);
+            using Item = typename std::decay_t<decltype(clean)>::value_type;
+            const auto matches = Get(prehashed, matched, Set<Item>{alloc});
 
             for (const auto& index : selected.first) {
                 if (0u == matches.count(index)) {
@@ -364,47 +365,46 @@ private:
             output.second += selected.first.size();
         };
         const auto& selected = targets.second;
-        const auto& [height, p20, p32, p33, p64, p65, pTxo] = prehashed;
         const auto& [s20, s32, s33, s64, s65, sTxo] = selected;
         auto output = std::pair<std::size_t, std::size_t>{};
         GetResults(
-            GetKeys,
             p20,
+            matched.at(0),
             s20,
             results.confirmed_no_match_.match_20_,
             results.confirmed_match_.match_20_,
             output);
         GetResults(
-            GetKeys,
             p32,
+            matched.at(1),
             s32,
             results.confirmed_no_match_.match_32_,
             results.confirmed_match_.match_32_,
             output);
         GetResults(
-            GetKeys,
             p33,
+            matched.at(2),
             s33,
             results.confirmed_no_match_.match_33_,
             results.confirmed_match_.match_33_,
             output);
         GetResults(
-            GetKeys,
             p64,
+            matched.at(3),
             s64,
             results.confirmed_no_match_.match_64_,
             results.confirmed_match_.match_64_,
             output);
         GetResults(
-            GetKeys,
             p65,
+            matched.at(4),
             s65,
             results.confirmed_no_match_.match_65_,
             results.confirmed_match_.match_65_,
             output);
         GetResults(
-            GetOutpoints,
             pTxo,
+            matched.at(5),
             sTxo,
             results.confirmed_no_match_.match_txo_,
             results.confirmed_match_.match_txo_,
@@ -997,7 +997,16 @@ auto SubchainStateData::ProcessBlock(
         return block.Internal().FindMatches(type, outpoint, key, log);
     }();
     const auto haveMatches = Clock::now();
-    const auto& [utxo, general] = confirmed;
+
+    if (false == confirmed.has_value()) {
+        LogError()(OT_PRETTY_CLASS())(name)(" failed to search block ")(
+            position)(" for matches")
+            .Flush();
+
+        return false;
+    }
+
+    const auto& [utxo, general] = confirmed.value();
     const auto& oracle = node.HeaderOracle();
     const auto pHeader = oracle.LoadHeader(blockHash);
 
@@ -1008,7 +1017,7 @@ auto SubchainStateData::ProcessBlock(
     OT_ASSERT(position == header.Position());
 
     const auto haveHeader = Clock::now();
-    handle_confirmed_matches(block, position, confirmed, log);
+    handle_confirmed_matches(block, position, confirmed.value(), log);
     const auto handledMatches = Clock::now();
     LogConsole()(name)(" processed block ")(position)(" in ")(
         std::chrono::nanoseconds{Clock::now() - start})
@@ -1240,7 +1249,8 @@ auto SubchainStateData::scan(
             select_targets(*handle, blocks, elements, startHeight, selected);
             auto results = wallet::MatchCache::Results{get_allocator()};
             auto prehash = PrehashData{
-                api_,
+                filters,
+                type,
                 selected,
                 name_,
                 results,
@@ -11,6 +11,7 @@
 
 #include <boost/smart_ptr/make_shared.hpp>
 #include <boost/smart_ptr/shared_ptr.hpp>
+#include <algorithm>
 #include <chrono>
 #include <future>
 #include <memory>
@@ -22,6 +23,7 @@
 #include "blockchain/node/wallet/subchain/SubchainStateData.hpp"
 #include "internal/api/network/Asio.hpp"
 #include "internal/blockchain/Params.hpp"
+#include "internal/blockchain/node/BlockOracle.hpp"
 #include "internal/blockchain/node/Manager.hpp"
 #include "internal/blockchain/node/Mempool.hpp"
 #include "internal/blockchain/node/wallet/Types.hpp"
@@ -30,6 +32,7 @@
 #include "internal/network/zeromq/socket/Pipeline.hpp"
 #include "internal/network/zeromq/socket/Raw.hpp"
 #include "internal/util/LogMacros.hpp"
+#include "internal/util/P0330.hpp"
 #include "opentxs/api/session/Factory.hpp"
 #include "opentxs/api/session/Session.hpp"
 #include "opentxs/blockchain/BlockchainType.hpp"
@@ -83,6 +86,7 @@ Process::Imp::Imp(
     , downloading_index_(alloc)
     , ready_(alloc)
     , processing_(alloc)
+    , failed_(alloc)
     , txid_cache_()
     , counter_()
     , running_(counter_.Allocate())
@@ -145,7 +149,14 @@ auto Process::Imp::do_process_common(
 {
     OT_ASSERT(block);
 
-    if (false == parent_.ProcessBlock(position, *block)) { OT_FAIL; }
+    if (false == parent_.ProcessBlock(position, *block)) {
+        LogError()(OT_PRETTY_CLASS())(parent_.name_)(
+            " failed to process block ")(position)
+            .Flush();
+        // NOTE the block must not be reported as processed. process_process
+        // will return it to the download queue so it is retried.
+        failed_.lock()->emplace(position);
+    }
 }
 
 auto Process::Imp::do_process_update(Message&& msg) noexcept -> void
@@ -184,12 +195,6 @@ auto Process::Imp::download(
     downloading_index_.emplace(it->first.hash_, it);
 }
 
-auto Process::Imp::download(block::Position&& position) noexcept -> void
-{
-    auto future = parent_.node_.BlockOracle().LoadBitcoin(position.hash_);
-    download(std::move(position), std::move(future));
-}
-
 auto Process::Imp::have_items() const noexcept -> bool
 {
     return 0u < ready_.size();
@@ -289,6 +294,7 @@ auto Process::Imp::process_do_rescan(Message&& in) noexcept -> void
     downloading_index_.clear();
     ready_.clear();
     processing_.clear();
+    failed_.lock()->clear();
     txid_cache_.clear();
     parent_.process_queue_.store(0);
     to_index_.Send(std::move(in));
@@ -328,15 +334,24 @@ auto Process::Imp::process_mempool(Message&& in) noexcept -> void
 auto Process::Imp::process_process(block::Position&& pos) noexcept -> void
 {
     if (const auto i = processing_.find(pos); i == processing_.end()) {
+        failed_.lock()->erase(pos);
         log_(OT_PRETTY_CLASS())(parent_.name_)(" block ")(
             pos)(" has been removed from the processing list due to reorg")
             .Flush();
     } else {
-        --parent_.process_queue_;
         processing_.erase(i);
-        log_(OT_PRETTY_CLASS())(parent_.name_)(" finished processing block ")(
-            pos)
-            .Flush();
+
+        if (0u < failed_.lock()->erase(pos)) {
+            log_(OT_PRETTY_CLASS())(parent_.name_)(" block ")(
+                pos)(" returned to download queue for retry")
+                .Flush();
+            waiting_.emplace_front(std::move(pos));
+        } else {
+            --parent_.process_queue_;
+            log_(OT_PRETTY_CLASS())(parent_.name_)(
+                " finished processing block ")(pos)
+                .Flush();
+        }
     }
 
     do_work();
@@ -354,7 +369,8 @@ auto Process::Imp::process_reprocess(Message&& msg) noexcept -> void
         log_(OT_PRETTY_CLASS())(parent_.name_)(
             " scheduling re-processing for block ")(position)
             .Flush();
-        auto future = parent_.node_.BlockOracle().LoadBitcoin(position.hash_);
+        auto future = parent_.node_.BlockOracle().Internal().LoadBitcoin(
+            position.hash_, BlockCacheConsumer::wallet);
         static constexpr auto ready = std::future_status::ready;
         using namespace std::literals;
         // NOTE re-process requests are holding up the Rescan job from updating
@@ -380,12 +396,31 @@ auto Process::Imp::process_reprocess(Message&& msg) noexcept -> void
 
 auto Process::Imp::queue_downloads() noexcept -> void
 {
-    while ((downloading_.size() < download_limit_) && (0u < waiting_.size())) {
-        auto& position = waiting_.front();
+    const auto active = std::min(downloading_.size(), download_limit_);
+    const auto count = std::min(download_limit_ - active, waiting_.size());
+
+    if (0u == count) { return; }
+
+    auto hashes = Vector<block::Hash>{get_allocator()};
+    hashes.reserve(count);
+
+    for (auto i = 0_uz; i < count; ++i) {
+        const auto& position = waiting_[i];
         log_(OT_PRETTY_CLASS())(parent_.name_)(" adding block ")(
             position)(" to download queue")
             .Flush();
-        download(std::move(position));
+        hashes.emplace_back(position.hash_);
+    }
+
+    // NOTE the block oracle loads these blocks in the background and announces
+    // each one as it becomes ready, so this thread never waits for storage
+    auto futures = parent_.node_.BlockOracle().Internal().Prefetch(
+        hashes, BlockCacheConsumer::wallet);
+
+    OT_ASSERT(futures.size() == count);
+
+    for (auto& future : futures) {
+        download(std::move(waiting_.front()), std::move(future));
         waiting_.pop_front();
     }
 }
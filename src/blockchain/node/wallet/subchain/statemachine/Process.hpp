@@ -8,6 +8,7 @@
 #include "internal/blockchain/node/wallet/subchain/statemachine/Process.hpp"
 
 #include <boost/smart_ptr/shared_ptr.hpp>
+#include <cs_plain_guarded.h>
 #include <robin_hood.h>
 #include <atomic>
 #include <cstddef>
@@ -102,6 +103,7 @@ private:
     using DownloadIndex = Map<block::Hash, Downloading::iterator>;
     using Ready =
         Map<block::Position, std::shared_ptr<const bitcoin::block::Block>>;
+    using Failed = libguarded::plain_guarded<Set<block::Position>>;
 
     const std::size_t download_limit_;
     network::zeromq::socket::Raw& to_index_;
@@ -110,6 +112,7 @@ private:
     DownloadIndex downloading_index_;
     Ready ready_;
     Ready processing_;
+    Failed failed_;
     robin_hood::unordered_flat_set<block::pTxid> txid_cache_;
     JobCounter counter_;
     Outstanding running_;
@@ -130,7 +133,6 @@ private:
         -> void;
     auto do_process_update(Message&& msg) noexcept -> void final;
     auto do_startup() noexcept -> void final;
-    auto download(block::Position&& position) noexcept -> void;
     auto download(
         block::Position&& position,
         BitcoinBlockResult&& future) noexcept -> void;
@@ -86,7 +86,7 @@ auto parse_pkt_block(
     const auto* const proofEnd{it};
     auto sizeData = ReturnType::CalculatedSize{
         in.size(), network::blockchain::bitcoin::CompactSize{}};
-    auto [index, transactions] =
+    auto [index, ranges] =
         parse_transactions(api, chain, in, header, sizeData, it, expectedSize);
 
     return std::make_shared<ReturnType>(
@@ -95,7 +95,8 @@ auto parse_pkt_block(
         std::move(pHeader),
         std::move(proofs),
         std::move(index),
-        std::move(transactions),
+        std::move(ranges),
+        space(in.substr(0, sizeData.first)),
         static_cast<std::size_t>(std::distance(proofStart, proofEnd)),
         std::move(sizeData));
 }
@@ -109,15 +110,17 @@ Block::Block(
     std::unique_ptr<const blockchain::bitcoin::block::Header> header,
     Proofs&& proofs,
     TxidIndex&& index,
-    TransactionMap&& transactions,
+    TransactionRanges&& ranges,
+    Space&& serialized,
     std::optional<std::size_t>&& proofBytes,
-    std::optional<CalculatedSize>&& size) noexcept(false)
+    CalculatedSize&& size) noexcept(false)
     : ot_super(
           api,
           chain,
           std::move(header),
           std::move(index),
-          std::move(transactions),
+          std::move(ranges),
+          std::move(serialized),
           std::move(size))
     , proofs_(std::move(proofs))
     , proof_bytes_(std::move(proofBytes))
@@ -68,9 +68,10 @@ public:
         std::unique_ptr<const blockchain::bitcoin::block::Header> header,
         Proofs&& proofs,
         TxidIndex&& index,
-        TransactionMap&& transactions,
-        std::optional<std::size_t>&& proofBytes = {},
-        std::optional<CalculatedSize>&& size = {}) noexcept(false);
+        TransactionRanges&& ranges,
+        Space&& serialized,
+        std::optional<std::size_t>&& proofBytes,
+        CalculatedSize&& size) noexcept(false);
     Block() = delete;
     Block(const Block&) = delete;
     Block(Block&&) = delete;
@@ -126,6 +126,11 @@ auto Bip32::DeserializePublic(
         serialized, network, depth, parent, index, chainCode, key);
 }
 
+auto Bip32::Internal() const noexcept -> const internal::Bip32&
+{
+    return *imp_;
+}
+
 auto Bip32::Internal() noexcept -> internal::Bip32& { return *imp_; }
 
 auto Bip32::SeedID(const ReadView entropy) const -> OTIdentifier
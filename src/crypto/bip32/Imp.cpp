@@ -35,6 +35,8 @@ namespace opentxs::crypto
 Bip32::Imp::Imp(const api::Crypto& crypto) noexcept
     : crypto_(crypto)
     , blank_()
+    , cache_lock_()
+    , cache_()
 {
 }
 
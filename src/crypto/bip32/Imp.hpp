@@ -7,7 +7,10 @@
 
 #include <boost/endian/buffers.hpp>
 #include <boost/endian/conversion.hpp>
+#include <cstddef>
+#include <mutex>
 #include <optional>
+#include <utility>
 
 #include "crypto/HDNode.hpp"
 #include "internal/crypto/Crypto.hpp"
@@ -52,6 +55,12 @@ namespace opentxs::crypto
 {
 struct Bip32::Imp final : public internal::Bip32 {
 public:
+    auto DeriveChildren(
+        const key::HD& parent,
+        const Bip32Index first,
+        const std::size_t count,
+        const PasswordPrompt& reason) const noexcept(false)
+        -> UnallocatedVector<Key> final;
     auto DeriveKey(
         const EcdsaCurve& curve,
         const Secret& seed,
@@ -108,12 +117,25 @@ public:
 
 private:
     using HDNode = implementation::HDNode;
+    // NOTE seed id, path from the root node
+    using CacheKey = std::pair<UnallocatedCString, Path>;
+    using Cache = UnallocatedMap<CacheKey, Key>;
+
+    static constexpr auto cache_limit_ = std::size_t{4096};
 
     const api::Crypto& crypto_;
     const std::optional<Key> blank_;
+    mutable std::mutex cache_lock_;
+    mutable Cache cache_;
 
     static auto IsHard(const Bip32Index) noexcept -> bool;
 
+    auto cache(
+        const UnallocatedCString& seed,
+        Path&& path,
+        const HDNode& node,
+        const Bip32Fingerprint parent) const noexcept -> void;
+
     auto ckd_hardened(
         const HDNode& node,
         const be::big_uint32_buf_t i,
@@ -138,6 +160,12 @@ private:
         Bip32Fingerprint& parent,
         Bip32Index& index,
         Data& chainCode) const noexcept -> bool;
+    auto load(const Key& key, HDNode& node) const noexcept(false) -> void;
+    auto load_cached(
+        const UnallocatedCString& seed,
+        const Path& path,
+        HDNode& node,
+        Bip32Fingerprint& parent) const noexcept(false) -> std::size_t;
     auto provider(const EcdsaCurve& curve) const noexcept
         -> const crypto::EcdsaProvider&;
     auto root_node(
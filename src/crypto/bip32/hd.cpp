@@ -11,11 +11,15 @@
 #include <cstdint>
 #include <cstring>
 #include <iterator>
+#include <mutex>
 #include <stdexcept>
 #include <tuple>
+#include <utility>
 
 #include "crypto/HDNode.hpp"
 #include "internal/util/LogMacros.hpp"
+#include "internal/util/Mutex.hpp"
+#include "internal/util/P0330.hpp"
 #include "opentxs/api/crypto/Crypto.hpp"
 #include "opentxs/api/crypto/Hash.hpp"
 #include "opentxs/core/Secret.hpp"
@@ -29,6 +33,105 @@
 
 namespace opentxs::crypto
 {
+auto Bip32::Imp::cache(
+    const UnallocatedCString& seed,
+    Path&& path,
+    const HDNode& node,
+    const Bip32Fingerprint parent) const noexcept -> void
+{
+    try {
+        auto key{blank_.value()};
+        node.Assign(EcdsaCurve::secp256k1, key);
+        std::get<3>(key) = path;
+        std::get<4>(key) = parent;
+        auto lock = Lock{cache_lock_};
+
+        // NOTE the number of distinct account level keys is small in practice
+        // so there is no need for anything more sophisticated than a reset
+        if (cache_limit_ <= cache_.size()) { cache_.clear(); }
+
+        cache_.try_emplace(
+            std::make_pair(seed, std::move(path)), std::move(key));
+    } catch (const std::exception& e) {
+        LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+    }
+}
+
+auto Bip32::Imp::DeriveChildren(
+    const key::HD& key,
+    const Bip32Index first,
+    const std::size_t count,
+    const PasswordPrompt& reason) const noexcept(false)
+    -> UnallocatedVector<Key>
+{
+    static constexpr auto limit = std::uint64_t{1} << 32u;
+
+    if (limit < (std::uint64_t{first} + count)) {
+        throw std::runtime_error("Child index out of range");
+    }
+
+    const auto curve = [&] {
+        if (crypto::key::asymmetric::Algorithm::ED25519 == key.keyType()) {
+
+            return EcdsaCurve::ed25519;
+        } else {
+
+            return EcdsaCurve::secp256k1;
+        }
+    }();
+    const auto path = [&] {
+        auto out = Path{};
+        auto proto = proto::HDPath{};
+
+        if (key.Path(proto)) {
+            for (const auto& child : proto.child()) { out.emplace_back(child); }
+        }
+
+        return out;
+    }();
+    const auto hasPrivate = key.HasPrivate();
+    // NOTE retrieve the parent key material once for the entire batch rather
+    // than once per child
+    const auto privateKey = hasPrivate ? key.PrivateKey(reason) : ReadView{};
+    const auto chainCode = key.Chaincode(reason);
+    const auto publicKey = key.PublicKey();
+    auto output = UnallocatedVector<Key>{};
+    output.reserve(count);
+
+    for (auto n = 0_uz; n < count; ++n) {
+        const auto index = static_cast<Bip32Index>(first + n);
+        auto& out = output.emplace_back(blank_.value());
+        auto& [privateOut, codeOut, publicOut, pathOut, parent] = out;
+        pathOut = path;
+        pathOut.emplace_back(index);
+        auto node = HDNode{crypto_};
+
+        if (hasPrivate && (false == copy(privateKey, node.InitPrivate()))) {
+            throw std::runtime_error("Failed to initialize private key");
+        }
+
+        if (false == copy(chainCode, node.InitCode())) {
+            throw std::runtime_error("Failed to initialize chain code");
+        }
+
+        if (false == copy(publicKey, node.InitPublic())) {
+            throw std::runtime_error("Failed to initialize public key");
+        }
+
+        node.check();
+        const auto derived = hasPrivate ? derive_private(node, parent, index)
+                                        : derive_public(node, parent, index);
+
+        if (false == derived) {
+            throw std::runtime_error("Failed to derive child node");
+        }
+
+        node.Assign(curve, out);
+    }
+
+    return output;
+}
+
 auto Bip32::Imp::DeriveKey(
     const EcdsaCurve& curve,
     const Secret& seed,
@@ -39,28 +142,37 @@ auto Bip32::Imp::DeriveKey(
     try {
         auto& [privateKey, chainCode, publicKey, pathOut, parent] = output;
         pathOut = path;
-        auto node = [&] {
-            auto ret = HDNode{crypto_};
+        const auto id = SeedID(seed.Bytes())->str();
+        auto node = HDNode{crypto_};
+        auto depth = load_cached(id, path, node, parent);
+
+        if (0_uz == depth) {
             const auto init = root_node(
                 EcdsaCurve::secp256k1,
                 seed.Bytes(),
-                ret.InitPrivate(),
-                ret.InitCode(),
-                ret.InitPublic());
+                node.InitPrivate(),
+                node.InitCode(),
+                node.InitPublic());
 
             if (false == init) {
                 throw std::runtime_error("Failed to derive root node");
             }
 
-            ret.check();
+            node.check();
+        }
 
-            return ret;
-        }();
+        // NOTE the parent of the requested key is typically an account or
+        // chain level key which is shared by every sibling
+        const auto cacheAt = path.empty() ? 0_uz : path.size() - 1_uz;
 
-        for (const auto& child : path) {
-            if (false == derive_private(node, parent, child)) {
+        for (auto i = path.cbegin() + depth; i != path.cend(); ++i) {
+            if (false == derive_private(node, parent, *i)) {
                 throw std::runtime_error("Failed to derive child node");
             }
+
+            if (++depth == cacheAt) {
+                cache(id, Path{path.cbegin(), std::next(i)}, node, parent);
+            }
         }
 
         node.Assign(curve, output);
@@ -205,6 +317,52 @@ auto Bip32::Imp::DerivePublicKey(
     return output;
 }
 
+auto Bip32::Imp::load(const Key& key, HDNode& node) const noexcept(false)
+    -> void
+{
+    const auto& [privateKey, chainCode, publicKey, path, parent] = key;
+
+    if (false == copy(privateKey->Bytes(), node.InitPrivate())) {
+        throw std::runtime_error("Failed to initialize private key");
+    }
+
+    if (false == copy(chainCode->Bytes(), node.InitCode())) {
+        throw std::runtime_error("Failed to initialize chain code");
+    }
+
+    if (false == copy(publicKey->Bytes(), node.InitPublic())) {
+        throw std::runtime_error("Failed to initialize public key");
+    }
+
+    node.check();
+}
+
+auto Bip32::Imp::load_cached(
+    const UnallocatedCString& seed,
+    const Path& path,
+    HDNode& node,
+    Bip32Fingerprint& parent) const noexcept(false) -> std::size_t
+{
+    auto lock = Lock{cache_lock_};
+
+    if (cache_.empty()) { return 0_uz; }
+
+    for (auto depth = path.size(); 0_uz < depth; --depth) {
+        const auto it = cache_.find(
+            std::make_pair(seed, Path{path.cbegin(), path.cbegin() + depth}));
+
+        if (cache_.end() != it) {
+            const auto& key = it->second;
+            load(key, node);
+            parent = std::get<4>(key);
+
+            return depth;
+        }
+    }
+
+    return 0_uz;
+}
+
 auto Bip32::Imp::root_node(
     const EcdsaCurve& curve,
     const ReadView entropy,
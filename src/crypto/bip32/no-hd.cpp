@@ -7,8 +7,19 @@
 #include "1_Internal.hpp"        // IWYU pragma: associated
 #include "crypto/bip32/Imp.hpp"  // IWYU pragma: associated
 
+#include <cstddef>
+
 namespace opentxs::crypto
 {
+auto Bip32::Imp::DeriveChildren(
+    const key::HD&,
+    const Bip32Index,
+    const std::size_t,
+    const PasswordPrompt&) const noexcept(false) -> UnallocatedVector<Key>
+{
+    return {};
+}
+
 auto Bip32::Imp::DeriveKey(const EcdsaCurve&, const Secret&, const Path&) const
     -> Key
 {
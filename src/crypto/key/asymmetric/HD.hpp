@@ -5,14 +5,17 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <tuple>
 
 #include "Proto.hpp"
 #include "crypto/key/asymmetric/EllipticCurve.hpp"
+#include "internal/crypto/key/HD.hpp"
 #include "internal/util/Mutex.hpp"
 #include "opentxs/Version.hpp"
 #include "opentxs/core/Secret.hpp"
+#include "opentxs/crypto/Bip32.hpp"
 #include "opentxs/crypto/Types.hpp"
 #include "opentxs/crypto/key/Asymmetric.hpp"
 #include "opentxs/crypto/key/HD.hpp"
@@ -59,13 +62,20 @@ class PasswordPrompt;
 
 namespace opentxs::crypto::key::implementation
 {
-class HD : virtual public key::HD, public EllipticCurve
+class HD : virtual public key::HD,
+           public internal::HD,
+           public EllipticCurve
 {
 public:
     auto Chaincode(const PasswordPrompt& reason) const noexcept
         -> ReadView final;
     auto ChildKey(const Bip32Index index, const PasswordPrompt& reason)
         const noexcept -> std::unique_ptr<key::HD> final;
+    auto ChildKeys(
+        const Bip32Index first,
+        const std::size_t count,
+        const PasswordPrompt& reason) const noexcept
+        -> UnallocatedVector<std::unique_ptr<key::HD>> final;
     auto Depth() const noexcept -> int final;
     auto Fingerprint() const noexcept -> Bip32Fingerprint final;
     auto Parent() const noexcept -> Bip32Fingerprint final { return parent_; }
@@ -145,6 +155,12 @@ private:
         noexcept(false) -> Secret&;
     auto get_params() const noexcept
         -> std::tuple<bool, Bip32Depth, Bip32Index>;
+    auto instantiate_child(
+        const Bip32::Key& serialized,
+        const Bip32Index index,
+        const bool hasPrivate,
+        const PasswordPrompt& reason) const noexcept(false)
+        -> std::unique_ptr<key::HD>;
     auto serialize(const Lock& lock, Serialized& serialized) const noexcept
         -> bool final;
 };
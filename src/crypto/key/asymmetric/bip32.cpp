@@ -8,6 +8,7 @@
 #include "crypto/key/asymmetric/HD.hpp"  // IWYU pragma: associated
 
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <iterator>
 #include <stdexcept>
@@ -16,8 +17,10 @@
 
 #include "Proto.hpp"
 #include "internal/api/Crypto.hpp"
+#include "internal/crypto/Crypto.hpp"
 #include "internal/crypto/key/Factory.hpp"
 #include "internal/util/LogMacros.hpp"
+#include "internal/util/P0330.hpp"
 #include "opentxs/api/session/Crypto.hpp"
 #include "opentxs/api/session/Factory.hpp"
 #include "opentxs/api/session/Session.hpp"
@@ -35,7 +38,6 @@ auto HD::ChildKey(const Bip32Index index, const PasswordPrompt& reason)
     const noexcept -> std::unique_ptr<key::HD>
 {
     try {
-        static const auto blank = api_.Factory().Secret(0);
         const auto hasPrivate = [&] {
             auto lock = Lock{lock_};
 
@@ -63,53 +65,106 @@ auto HD::ChildKey(const Bip32Index index, const PasswordPrompt& reason)
                     *this, {index}, reason);
             }
         }();
-        const auto& [privkey, ccode, pubkey, spath, parent] = serialized;
-        const auto path = [&] {
-            auto out = proto::HDPath{};
 
-            if (path_) {
-                out = *path_;
-                out.add_child(index);
-            }
+        return instantiate_child(serialized, index, hasPrivate, reason);
+    } catch (const std::exception& e) {
+        LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+
+        return {};
+    }
+}
+
+auto HD::ChildKeys(
+    const Bip32Index first,
+    const std::size_t count,
+    const PasswordPrompt& reason) const noexcept
+    -> UnallocatedVector<std::unique_ptr<key::HD>>
+{
+    try {
+        const auto hasPrivate = [&] {
+            auto lock = Lock{lock_};
 
-            return out;
+            return has_private(lock);
         }();
+        const auto& bip32 = api_.Crypto().BIP32().Internal();
+        const auto serialized =
+            bip32.DeriveChildren(*this, first, count, reason);
 
-        switch (type_) {
-            case crypto::key::asymmetric::Algorithm::ED25519: {
-                return factory::Ed25519Key(
-                    api_,
-                    api_.Crypto().Internal().EllipticProvider(type_),
-                    hasPrivate ? privkey : blank,
-                    ccode,
-                    pubkey,
-                    path,
-                    parent,
-                    role_,
-                    version_,
-                    reason);
-            }
-            case crypto::key::asymmetric::Algorithm::Secp256k1: {
-                return factory::Secp256k1Key(
-                    api_,
-                    api_.Crypto().Internal().EllipticProvider(type_),
-                    hasPrivate ? privkey : blank,
-                    ccode,
-                    pubkey,
-                    path,
-                    parent,
-                    role_,
-                    version_,
-                    reason);
-            }
-            default: {
-                throw std::runtime_error{"Unsupported key type"};
+        if (serialized.size() != count) {
+            throw std::runtime_error{"Failed to derive child keys"};
+        }
+
+        auto output = UnallocatedVector<std::unique_ptr<key::HD>>{};
+        output.reserve(count);
+
+        for (auto n = 0_uz; n < count; ++n) {
+            const auto index = static_cast<Bip32Index>(first + n);
+            auto& child = output.emplace_back(instantiate_child(
+                serialized.at(n), index, hasPrivate, reason));
+
+            if (false == bool(child)) {
+                throw std::runtime_error{"Failed to instantiate child key"};
             }
         }
+
+        return output;
     } catch (const std::exception& e) {
         LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
 
         return {};
     }
 }
+
+auto HD::instantiate_child(
+    const Bip32::Key& serialized,
+    const Bip32Index index,
+    const bool hasPrivate,
+    const PasswordPrompt& reason) const noexcept(false)
+    -> std::unique_ptr<key::HD>
+{
+    static const auto blank = api_.Factory().Secret(0);
+    const auto& [privkey, ccode, pubkey, spath, parent] = serialized;
+    const auto path = [&] {
+        auto out = proto::HDPath{};
+
+        if (path_) {
+            out = *path_;
+            out.add_child(index);
+        }
+
+        return out;
+    }();
+
+    switch (type_) {
+        case crypto::key::asymmetric::Algorithm::ED25519: {
+            return factory::Ed25519Key(
+                api_,
+                api_.Crypto().Internal().EllipticProvider(type_),
+                hasPrivate ? privkey : blank,
+                ccode,
+                pubkey,
+                path,
+                parent,
+                role_,
+                version_,
+                reason);
+        }
+        case crypto::key::asymmetric::Algorithm::Secp256k1: {
+            return factory::Secp256k1Key(
+                api_,
+                api_.Crypto().Internal().EllipticProvider(type_),
+                hasPrivate ? privkey : blank,
+                ccode,
+                pubkey,
+                path,
+                parent,
+                role_,
+                version_,
+                reason);
+        }
+        default: {
+            throw std::runtime_error{"Unsupported key type"};
+        }
+    }
+}
 }  // namespace opentxs::crypto::key::implementation
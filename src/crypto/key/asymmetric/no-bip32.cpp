@@ -7,8 +7,12 @@
 #include "1_Internal.hpp"                // IWYU pragma: associated
 #include "crypto/key/asymmetric/HD.hpp"  // IWYU pragma: associated
 
+#include <cstddef>
+#include <memory>
+
 #include "internal/util/LogMacros.hpp"
 #include "opentxs/crypto/key/HD.hpp"
+#include "opentxs/util/Container.hpp"
 #include "opentxs/util/Log.hpp"
 
 namespace opentxs::crypto::key::implementation
@@ -20,4 +24,12 @@ auto HD::ChildKey(const Bip32Index, const PasswordPrompt&) const noexcept
 
     return {};
 }
+
+auto HD::ChildKeys(const Bip32Index, const std::size_t, const PasswordPrompt&)
+    const noexcept -> UnallocatedVector<std::unique_ptr<key::HD>>
+{
+    LogError()(OT_PRETTY_CLASS())("HD key support missing").Flush();
+
+    return {};
+}
 }  // namespace opentxs::crypto::key::implementation
@@ -0,0 +1,513 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"    // IWYU pragma: associated
+#include "1_Internal.hpp"  // IWYU pragma: associated
+#include "internal/crypto/library/Sha256.hpp"  // IWYU pragma: associated
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+
+#include "internal/util/P0330.hpp"
+#include "opentxs/util/Container.hpp"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define OT_SHA256_X86 1
+#include <cpuid.h>
+#include <immintrin.h>
+#else
+#define OT_SHA256_X86 0
+#endif
+
+namespace opentxs::crypto::sha256
+{
+// SHA-256 as specified by FIPS 180-4
+//
+// Block validation, merkle trees and cfilter indexing hash very large numbers
+// of small independent messages. The general hash providers process one
+// message per call, so batches are dispatched here instead. The fastest
+// kernel supported by the cpu is chosen at runtime:
+//
+// - sha extensions: one message at a time using the dedicated instructions
+// - avx2: eight messages of the same padded length in lockstep, one per lane
+// - portable: one message at a time
+using State = std::array<std::uint32_t, 8>;
+using Block = std::array<std::uint8_t, 64>;
+
+static constexpr auto block_size_ = 64_uz;
+static constexpr auto initial_ = State{
+    0x6a09e667,
+    0xbb67ae85,
+    0x3c6ef372,
+    0xa54ff53a,
+    0x510e527f,
+    0x9b05688c,
+    0x1f83d9ab,
+    0x5be0cd19};
+alignas(16) static constexpr std::uint32_t k_[64]{
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1,
+    0x923f82a4, 0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+    0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786,
+    0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147,
+    0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+    0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
+    0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a,
+    0x5b9cca4f, 0x682e6ff3, 0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+    0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+static auto load32(const std::uint8_t* in) noexcept -> std::uint32_t
+{
+    return (std::uint32_t{in[0]} << 24u) | (std::uint32_t{in[1]} << 16u) |
+           (std::uint32_t{in[2]} << 8u) | std::uint32_t{in[3]};
+}
+
+static auto store32(const std::uint32_t value, std::uint8_t* out) noexcept
+    -> void
+{
+    out[0] = static_cast<std::uint8_t>(value >> 24u);
+    out[1] = static_cast<std::uint8_t>(value >> 16u);
+    out[2] = static_cast<std::uint8_t>(value >> 8u);
+    out[3] = static_cast<std::uint8_t>(value);
+}
+
+// Number of compression blocks required for a message after padding
+static auto count_blocks(const std::size_t size) noexcept -> std::size_t
+{
+    return (size + 9_uz + (block_size_ - 1_uz)) / block_size_;
+}
+
+// Copy block n of the padded message into out
+static auto padded_block(
+    const ReadView in,
+    const std::size_t n,
+    const std::size_t blocks,
+    std::uint8_t* out) noexcept -> void
+{
+    const auto size = in.size();
+    const auto offset = block_size_ * n;
+    const auto* data = reinterpret_cast<const std::uint8_t*>(in.data());
+
+    if ((offset + block_size_) <= size) {
+        std::memcpy(out, std::next(data, offset), block_size_);
+
+        return;
+    }
+
+    std::memset(out, 0, block_size_);
+
+    if (offset < size) {
+        std::memcpy(out, std::next(data, offset), size - offset);
+    }
+
+    if (offset <= size) { out[size - offset] = 0x80; }
+
+    if ((n + 1_uz) == blocks) {
+        const auto bits = static_cast<std::uint64_t>(size) << 3u;
+        store32(static_cast<std::uint32_t>(bits >> 32u), std::next(out, 56));
+        store32(static_cast<std::uint32_t>(bits), std::next(out, 60));
+    }
+}
+
+static auto store_state(const State& state, std::byte* out) noexcept -> void
+{
+    auto* it = reinterpret_cast<std::uint8_t*>(out);
+
+    for (const auto word : state) {
+        store32(word, it);
+        std::advance(it, sizeof(word));
+    }
+}
+
+static constexpr auto rotr(const std::uint32_t x, const unsigned n) noexcept
+    -> std::uint32_t
+{
+    return (x >> n) | (x << (32u - n));
+}
+
+static auto transform_portable(State& state, const std::uint8_t* block) noexcept
+    -> void
+{
+    auto w = std::array<std::uint32_t, 64>{};
+
+    for (auto t = 0_uz; t < 16_uz; ++t) {
+        w[t] = load32(std::next(block, 4 * t));
+    }
+
+    for (auto t = 16_uz; t < 64_uz; ++t) {
+        const auto s0 =
+            rotr(w[t - 15], 7u) ^ rotr(w[t - 15], 18u) ^ (w[t - 15] >> 3u);
+        const auto s1 =
+            rotr(w[t - 2], 17u) ^ rotr(w[t - 2], 19u) ^ (w[t - 2] >> 10u);
+        w[t] = w[t - 16] + s0 + w[t - 7] + s1;
+    }
+
+    auto [a, b, c, d, e, f, g, h] = state;
+
+    for (auto t = 0_uz; t < 64_uz; ++t) {
+        const auto s1 = rotr(e, 6u) ^ rotr(e, 11u) ^ rotr(e, 25u);
+        const auto ch = (e & f) ^ (~e & g);
+        const auto t1 = h + s1 + ch + k_[t] + w[t];
+        const auto s0 = rotr(a, 2u) ^ rotr(a, 13u) ^ rotr(a, 22u);
+        const auto maj = (a & b) ^ (a & c) ^ (b & c);
+        const auto t2 = s0 + maj;
+        h = g;
+        g = f;
+        f = e;
+        e = d + t1;
+        d = c;
+        c = b;
+        b = a;
+        a = t1 + t2;
+    }
+
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+    state[4] += e;
+    state[5] += f;
+    state[6] += g;
+    state[7] += h;
+}
+
+template <void (*Transform)(State&, const std::uint8_t*) noexcept>
+static auto hash_one(const ReadView in, std::byte* out) noexcept -> void
+{
+    const auto blocks = count_blocks(in.size());
+    auto state = initial_;
+    auto block = Block{};
+
+    for (auto n = 0_uz; n < blocks; ++n) {
+        padded_block(in, n, blocks, block.data());
+        Transform(state, block.data());
+    }
+
+    store_state(state, out);
+}
+
+static auto digest_portable(
+    const Vector<ReadView>& inputs,
+    std::byte* out) noexcept -> void
+{
+    for (const auto& in : inputs) {
+        hash_one<transform_portable>(in, out);
+        std::advance(out, digest_size_);
+    }
+}
+
+#if OT_SHA256_X86
+[[gnu::target("sha,sse4.1,ssse3")]] static auto transform_shani(
+    State& state,
+    const std::uint8_t* block) noexcept -> void
+{
+    const auto mask =
+        _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+    auto tmp = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&state[0]));
+    auto state1 =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(&state[4]));
+    tmp = _mm_shuffle_epi32(tmp, 0xb1);
+    state1 = _mm_shuffle_epi32(state1, 0x1b);
+    auto state0 = _mm_alignr_epi8(tmp, state1, 8);
+    state1 = _mm_blend_epi16(state1, tmp, 0xf0);
+    const auto abef = state0;
+    const auto cdgh = state1;
+    __m128i msg[4];
+
+    // NOTE each iteration performs four rounds. The message schedule for
+    // later rounds is calculated in place as the words become available.
+#pragma GCC unroll 16
+    for (auto g = 0; g < 16; ++g) {
+        auto& current = msg[g % 4];
+
+        if (g < 4) {
+            current = _mm_shuffle_epi8(
+                _mm_loadu_si128(
+                    reinterpret_cast<const __m128i*>(std::next(block, 16 * g))),
+                mask);
+        }
+
+        auto m = _mm_add_epi32(
+            current,
+            _mm_load_si128(reinterpret_cast<const __m128i*>(&k_[4 * g])));
+        state1 = _mm_sha256rnds2_epu32(state1, state0, m);
+
+        if ((3 <= g) && (g <= 14)) {
+            auto& next = msg[(g + 1) % 4];
+            next = _mm_add_epi32(
+                next, _mm_alignr_epi8(current, msg[(g + 3) % 4], 4));
+            next = _mm_sha256msg2_epu32(next, current);
+        }
+
+        m = _mm_shuffle_epi32(m, 0x0e);
+        state0 = _mm_sha256rnds2_epu32(state0, state1, m);
+
+        if ((1 <= g) && (g <= 12)) {
+            auto& previous = msg[(g + 3) % 4];
+            previous = _mm_sha256msg1_epu32(previous, current);
+        }
+    }
+
+    state0 = _mm_add_epi32(state0, abef);
+    state1 = _mm_add_epi32(state1, cdgh);
+    tmp = _mm_shuffle_epi32(state0, 0x1b);
+    state1 = _mm_shuffle_epi32(state1, 0xb1);
+    state0 = _mm_blend_epi16(tmp, state1, 0xf0);
+    state1 = _mm_alignr_epi8(state1, tmp, 8);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&state[0]), state0);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&state[4]), state1);
+}
+
+[[gnu::target("sha,sse4.1,ssse3"), gnu::flatten]] static auto digest_shani(
+    const Vector<ReadView>& inputs,
+    std::byte* out) noexcept -> void
+{
+    for (const auto& in : inputs) {
+        hash_one<transform_shani>(in, out);
+        std::advance(out, digest_size_);
+    }
+}
+
+[[gnu::target("avx2"), gnu::always_inline]] static inline auto rotr8(
+    const __m256i x,
+    const int n) noexcept -> __m256i
+{
+    return _mm256_or_si256(
+        _mm256_srli_epi32(x, n), _mm256_slli_epi32(x, 32 - n));
+}
+
+[[gnu::target("avx2"), gnu::always_inline]] static inline auto xor3(
+    const __m256i a,
+    const __m256i b,
+    const __m256i c) noexcept -> __m256i
+{
+    return _mm256_xor_si256(_mm256_xor_si256(a, b), c);
+}
+
+// Compress one block of each of eight messages, one message per 32 bit lane
+[[gnu::target("avx2")]] static auto transform8(
+    __m256i* state,
+    const Block* blocks) noexcept -> void
+{
+    __m256i w[64];
+
+    for (auto t = 0; t < 16; ++t) {
+        const auto word = [&](const int lane) {
+            return static_cast<int>(
+                load32(std::next(blocks[lane].data(), 4 * t)));
+        };
+        w[t] = _mm256_set_epi32(
+            word(7),
+            word(6),
+            word(5),
+            word(4),
+            word(3),
+            word(2),
+            word(1),
+            word(0));
+    }
+
+    for (auto t = 16; t < 64; ++t) {
+        const auto s0 = xor3(
+            rotr8(w[t - 15], 7),
+            rotr8(w[t - 15], 18),
+            _mm256_srli_epi32(w[t - 15], 3));
+        const auto s1 = xor3(
+            rotr8(w[t - 2], 17),
+            rotr8(w[t - 2], 19),
+            _mm256_srli_epi32(w[t - 2], 10));
+        w[t] = _mm256_add_epi32(
+            _mm256_add_epi32(w[t - 16], s0), _mm256_add_epi32(w[t - 7], s1));
+    }
+
+    auto a = state[0];
+    auto b = state[1];
+    auto c = state[2];
+    auto d = state[3];
+    auto e = state[4];
+    auto f = state[5];
+    auto g = state[6];
+    auto h = state[7];
+
+    for (auto t = 0; t < 64; ++t) {
+        const auto s1 = xor3(rotr8(e, 6), rotr8(e, 11), rotr8(e, 25));
+        const auto ch =
+            _mm256_xor_si256(_mm256_and_si256(e, f), _mm256_andnot_si256(e, g));
+        const auto t1 = _mm256_add_epi32(
+            _mm256_add_epi32(h, s1),
+            _mm256_add_epi32(
+                _mm256_add_epi32(ch, w[t]),
+                _mm256_set1_epi32(static_cast<int>(k_[t]))));
+        const auto s0 = xor3(rotr8(a, 2), rotr8(a, 13), rotr8(a, 22));
+        const auto maj = _mm256_or_si256(
+            _mm256_and_si256(a, b), _mm256_and_si256(c, _mm256_or_si256(a, b)));
+        const auto t2 = _mm256_add_epi32(s0, maj);
+        h = g;
+        g = f;
+        f = e;
+        e = _mm256_add_epi32(d, t1);
+        d = c;
+        c = b;
+        b = a;
+        a = _mm256_add_epi32(t1, t2);
+    }
+
+    state[0] = _mm256_add_epi32(state[0], a);
+    state[1] = _mm256_add_epi32(state[1], b);
+    state[2] = _mm256_add_epi32(state[2], c);
+    state[3] = _mm256_add_epi32(state[3], d);
+    state[4] = _mm256_add_epi32(state[4], e);
+    state[5] = _mm256_add_epi32(state[5], f);
+    state[6] = _mm256_add_epi32(state[6], g);
+    state[7] = _mm256_add_epi32(state[7], h);
+}
+
+// Hashes eight messages which have the same number of padded blocks
+[[gnu::target("avx2")]] static auto hash8(
+    const ReadView* inputs,
+    std::byte* out) noexcept -> void
+{
+    static constexpr auto lanes = 8_uz;
+    const auto blocks = count_blocks(inputs[0].size());
+    __m256i state[8];
+    Block block[lanes];
+
+    for (auto i = 0_uz; i < initial_.size(); ++i) {
+        state[i] = _mm256_set1_epi32(static_cast<int>(initial_[i]));
+    }
+
+    for (auto n = 0_uz; n < blocks; ++n) {
+        for (auto lane = 0_uz; lane < lanes; ++lane) {
+            padded_block(inputs[lane], n, blocks, block[lane].data());
+        }
+
+        transform8(state, block);
+    }
+
+    alignas(32) std::uint32_t words[8][lanes];
+
+    for (auto i = 0_uz; i < initial_.size(); ++i) {
+        _mm256_store_si256(reinterpret_cast<__m256i*>(words[i]), state[i]);
+    }
+
+    for (auto lane = 0_uz; lane < lanes; ++lane) {
+        auto digest = State{};
+
+        for (auto i = 0_uz; i < digest.size(); ++i) {
+            digest[i] = words[i][lane];
+        }
+
+        store_state(digest, std::next(out, digest_size_ * lane));
+    }
+}
+
+[[gnu::target("avx2")]] static auto digest_avx2(
+    const Vector<ReadView>& inputs,
+    std::byte* out) noexcept -> void
+{
+    static constexpr auto lanes = 8_uz;
+    const auto count = inputs.size();
+    auto i = 0_uz;
+
+    // NOTE transactions, merkle nodes and the second round of SHA-256d are
+    // dominated by runs of messages with the same padded length, which is
+    // what allows them to be processed in lockstep
+    while ((i + lanes) <= count) {
+        const auto* group = std::next(inputs.data(), i);
+        const auto blocks = count_blocks(group[0].size());
+        auto same = true;
+
+        for (auto lane = 1_uz; lane < lanes; ++lane) {
+            same &= (blocks == count_blocks(group[lane].size()));
+        }
+
+        if (same) {
+            hash8(group, std::next(out, digest_size_ * i));
+            i += lanes;
+        } else {
+            hash_one<transform_portable>(
+                group[0], std::next(out, digest_size_ * i));
+            ++i;
+        }
+    }
+
+    for (; i < count; ++i) {
+        hash_one<transform_portable>(
+            inputs[i], std::next(out, digest_size_ * i));
+    }
+}
+
+static auto supports_sha() noexcept -> bool
+{
+    auto eax = 0u;
+    auto ebx = 0u;
+    auto ecx = 0u;
+    auto edx = 0u;
+
+    if (0 == __get_cpuid(1, &eax, &ebx, &ecx, &edx)) { return false; }
+
+    const auto ssse3 = (0u != (ecx & bit_SSSE3));
+    const auto sse41 = (0u != (ecx & bit_SSE4_1));
+
+    if (0 == __get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) { return false; }
+
+    const auto sha = (0u != (ebx & (1u << 29u)));
+
+    return ssse3 && sse41 && sha;
+}
+#endif  // OT_SHA256_X86
+
+struct Kernel {
+    decltype(&digest_portable) digest_;
+    bool accelerated_;
+};
+
+static auto kernel() noexcept -> const Kernel&
+{
+    static const auto out = []() -> Kernel {
+#if OT_SHA256_X86
+        if (supports_sha()) { return {digest_shani, true}; }
+
+        __builtin_cpu_init();
+
+        if (__builtin_cpu_supports("avx2")) { return {digest_avx2, true}; }
+#endif  // OT_SHA256_X86
+
+        return {digest_portable, false};
+    }();
+
+    return out;
+}
+
+auto Accelerated() noexcept -> bool { return kernel().accelerated_; }
+
+auto Digest(
+    const Vector<ReadView>& inputs,
+    const bool twice,
+    std::byte* out) noexcept -> void
+{
+    const auto& digest = kernel().digest_;
+    digest(inputs, out);
+
+    if (false == twice) { return; }
+
+    // NOTE every kernel reads all the blocks of a message before writing its
+    // digest so the second round can overwrite its own input
+    auto intermediate = Vector<ReadView>{};
+    intermediate.reserve(inputs.size());
+
+    for (auto i = 0_uz; i < inputs.size(); ++i) {
+        intermediate.emplace_back(
+            reinterpret_cast<const char*>(std::next(out, digest_size_ * i)),
+            digest_size_);
+    }
+
+    digest(intermediate, out);
+}
+}  // namespace opentxs::crypto::sha256
@@ -6,12 +6,24 @@
 #pragma once
 
 #include "opentxs/api/crypto/Hash.hpp"
+#include "opentxs/crypto/Types.hpp"
+#include "opentxs/util/Bytes.hpp"
+#include "opentxs/util/Container.hpp"
 
 namespace opentxs::api::crypto::internal
 {
 class Hash : virtual public api::crypto::Hash
 {
 public:
+    using api::crypto::Hash::Digest;
+    /// Calculate the digest of every input
+    ///
+    /// The destination is invoked once and receives the digests of all inputs
+    /// stored contiguously in the same order as the inputs.
+    virtual auto Digest(
+        const opentxs::crypto::HashType hashType,
+        const Vector<ReadView>& data,
+        const AllocateOutput destination) const noexcept -> bool = 0;
     auto InternalHash() const noexcept -> const Hash& final { return *this; }
 
     auto InternalHash() noexcept -> Hash& final { return *this; }
@@ -46,6 +46,11 @@ class Session;
 
 namespace blockchain
 {
+namespace bitcoin
+{
+class UInt256;
+}  // namespace bitcoin
+
 namespace block
 {
 class Block;
@@ -74,6 +79,7 @@ class GCS;
 }  // namespace proto
 
 class Amount;
+enum class ThreadPool;
 // }  // namespace v1
 }  // namespace opentxs
 // NOLINTEND(modernize-concat-nested-namespaces)
@@ -147,6 +153,15 @@ struct SerializedBloomFilter {
 
 using FilterParams = std::pair<std::uint8_t, std::uint32_t>;
 
+/// Batch equivalent of BlockHash
+///
+/// The output receives one hash per input, stored contiguously in the same
+/// order as the inputs.
+auto BlockHashes(
+    const api::Session& api,
+    const Type chain,
+    const Vector<ReadView>& inputs,
+    const AllocateOutput output) noexcept -> bool;
 auto DefaultFilter(const Type type) noexcept -> cfilter::Type;
 auto DecodeSerializedCfilter(const ReadView bytes) noexcept(false)
     -> std::pair<std::uint32_t, ReadView>;
@@ -155,24 +170,70 @@ auto Deserialize(const Type chain, const std::uint8_t type) noexcept
 auto Deserialize(const api::Session& api, const ReadView bytes) noexcept
     -> block::Position;
 auto BlockHashToFilterKey(const ReadView hash) noexcept(false) -> ReadView;
+auto FilterHashes(
+    const api::Session& api,
+    const Type chain,
+    const Vector<ReadView>& inputs,
+    const AllocateOutput output) noexcept -> bool;
 auto FilterHashToHeader(
     const api::Session& api,
     const ReadView hash,
     const ReadView previous = {}) noexcept -> cfilter::Header;
+/// Calculate the cfheaders for a sequence of consecutive filter hashes
+///
+/// The first hash is chained to the specified previous cfheader (or to a null
+/// header if previous is empty) and each subsequent hash to the cfheader
+/// calculated before it.
+auto FilterHashesToHeaders(
+    const api::Session& api,
+    const Vector<cfilter::Hash>& hashes,
+    const ReadView previous,
+    alloc::Default alloc) noexcept(false) -> Vector<cfilter::Header>;
 auto FilterToHash(const api::Session& api, const ReadView filter) noexcept
     -> cfilter::Hash;
+auto FiltersToHashes(
+    const api::Session& api,
+    const Vector<ReadView>& filters,
+    alloc::Default alloc) noexcept(false) -> Vector<cfilter::Hash>;
 auto FilterToHeader(
     const api::Session& api,
     const ReadView filter,
     const ReadView previous = {}) noexcept -> cfilter::Header;
+/// Invokes job for a set of disjoint ranges [first, last) covering [0, count)
+///
+/// Batches larger than one chunk are split across the blockchain thread pool.
+/// The calling thread claims work alongside the pool so completion never
+/// depends on the availability of a pool thread.
+auto ForEachParallel(
+    const api::Session& api,
+    const std::size_t count,
+    const std::function<void(std::size_t, std::size_t)>& job,
+    const std::size_t chunk = 256_uz) noexcept -> void;
+/// Identical to the above except the work is split across the specified pool
+auto ForEachParallel(
+    const api::Session& api,
+    const ThreadPool pool,
+    const std::size_t count,
+    const std::function<void(std::size_t, std::size_t)>& job,
+    const std::size_t chunk = 256_uz) noexcept -> void;
 auto Format(const Type chain, const opentxs::Amount&) noexcept
     -> UnallocatedCString;
 auto GetFilterParams(const cfilter::Type type) noexcept(false) -> FilterParams;
 auto Grind(const std::function<void()> function) noexcept -> void;
+auto MerkleHashes(
+    const api::Session& api,
+    const Type chain,
+    const Vector<ReadView>& inputs,
+    const AllocateOutput output) noexcept -> bool;
 auto Serialize(const Type chain, const cfilter::Type type) noexcept(false)
     -> std::uint8_t;
 auto Serialize(const block::Position& position) noexcept -> Space;
 auto Ticker(const Type chain) noexcept -> UnallocatedCString;
+auto TransactionHashes(
+    const api::Session& api,
+    const Type chain,
+    const Vector<ReadView>& inputs,
+    const AllocateOutput output) noexcept -> bool;
 }  // namespace opentxs::blockchain::internal
 
 namespace opentxs::blockchain::script
@@ -231,6 +292,7 @@ auto NumericHashNBits(const std::uint32_t nBits) noexcept
     -> std::unique_ptr<blockchain::NumericHash>;
 #if OT_BLOCKCHAIN
 auto Work(const UnallocatedCString& hex) -> blockchain::Work*;
+auto Work(const blockchain::bitcoin::UInt256& value) -> blockchain::Work*;
 auto Work(const blockchain::Type chain, const blockchain::NumericHash& target)
     -> blockchain::Work*;
 #endif  // OT_BLOCKCHAIN
@@ -0,0 +1,361 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+#include "opentxs/util/Bytes.hpp"
+#include "opentxs/util/Container.hpp"
+
+namespace opentxs::blockchain::bitcoin
+{
+// An unsigned 256 bit integer with inline storage
+//
+// None of the operations allocate. Arithmetic wraps modulo 2^256.
+class UInt256
+{
+public:
+    static constexpr auto size_ = std::size_t{32};
+
+    using ByteArray = std::array<std::uint8_t, size_>;
+
+    // Decodes the compact target format used by the nBits header field
+    //
+    // Returns nullopt if the encoded value does not fit in 256 bits
+    static constexpr auto FromCompact(const std::uint32_t nBits) noexcept
+        -> std::optional<UInt256>
+    {
+        const auto mantissa = std::uint32_t{nBits & 0x007fffff};
+        const auto exponent = std::size_t{(nBits & 0xff000000) >> 24};
+        auto output = UInt256{mantissa};
+
+        if (3 >= exponent) {
+            output >>= 8 * (3 - exponent);
+        } else {
+            if (output.Bits() + 8 * (exponent - 3) > 256) {
+
+                return std::nullopt;
+            }
+
+            output <<= 8 * (exponent - 3);
+        }
+
+        return output;
+    }
+    // Returns nullopt if the input is longer than 32 bytes
+    static constexpr auto FromBigEndian(const ReadView bytes) noexcept
+        -> std::optional<UInt256>
+    {
+        if (size_ < bytes.size()) { return std::nullopt; }
+
+        auto output = UInt256{};
+
+        for (auto i = std::size_t{0}; i < bytes.size(); ++i) {
+            output.set_byte(
+                bytes.size() - i - 1, static_cast<std::uint8_t>(bytes[i]));
+        }
+
+        return output;
+    }
+    // Returns nullopt if the input is longer than 32 bytes
+    static constexpr auto FromLittleEndian(const ReadView bytes) noexcept
+        -> std::optional<UInt256>
+    {
+        if (size_ < bytes.size()) { return std::nullopt; }
+
+        auto output = UInt256{};
+
+        for (auto i = std::size_t{0}; i < bytes.size(); ++i) {
+            output.set_byte(i, static_cast<std::uint8_t>(bytes[i]));
+        }
+
+        return output;
+    }
+
+    constexpr auto operator+=(const UInt256& rhs) noexcept -> UInt256&
+    {
+        auto carry = std::uint64_t{0};
+
+        for (auto i = std::size_t{0}; i < limbs_; ++i) {
+            const auto sum = std::uint64_t{limb_[i]} + rhs.limb_[i] + carry;
+            limb_[i] = static_cast<std::uint32_t>(sum);
+            carry = sum >> 32;
+        }
+
+        return *this;
+    }
+    constexpr auto operator-=(const UInt256& rhs) noexcept -> UInt256&
+    {
+        auto borrow = std::uint64_t{0};
+
+        for (auto i = std::size_t{0}; i < limbs_; ++i) {
+            const auto diff = std::uint64_t{limb_[i]} - rhs.limb_[i] - borrow;
+            limb_[i] = static_cast<std::uint32_t>(diff);
+            borrow = (diff >> 32) & 0x1;
+        }
+
+        return *this;
+    }
+    constexpr auto operator<<=(const std::size_t bits) noexcept -> UInt256&
+    {
+        if (256 <= bits) { return *this = UInt256{}; }
+
+        const auto words = bits / 32;
+        const auto shift = bits % 32;
+
+        for (auto i = limbs_; i > 0; --i) {
+            const auto to = i - 1;
+            auto value = std::uint32_t{0};
+
+            if (to >= words) {
+                const auto from = to - words;
+                value = limb_[from] << shift;
+
+                if ((0 < shift) && (0 < from)) {
+                    value |= limb_[from - 1] >> (32 - shift);
+                }
+            }
+
+            limb_[to] = value;
+        }
+
+        return *this;
+    }
+    constexpr auto operator>>=(const std::size_t bits) noexcept -> UInt256&
+    {
+        if (256 <= bits) { return *this = UInt256{}; }
+
+        const auto words = bits / 32;
+        const auto shift = bits % 32;
+
+        for (auto to = std::size_t{0}; to < limbs_; ++to) {
+            auto value = std::uint32_t{0};
+
+            if (const auto from = to + words; from < limbs_) {
+                value = limb_[from] >> shift;
+
+                if ((0 < shift) && (from + 1 < limbs_)) {
+                    value |= limb_[from + 1] << (32 - shift);
+                }
+            }
+
+            limb_[to] = value;
+        }
+
+        return *this;
+    }
+    // Integer division. Division by zero produces zero.
+    constexpr auto operator/=(const UInt256& rhs) noexcept -> UInt256&
+    {
+        const auto divisorBits = rhs.Bits();
+        const auto dividendBits = Bits();
+
+        if ((0 == divisorBits) || (dividendBits < divisorBits)) {
+
+            return *this = UInt256{};
+        }
+
+        // NOTE only the bit positions where the quotient may be non-zero are
+        // visited so the cost scales with the size of the result
+        auto shift = dividendBits - divisorBits;
+        auto divisor = rhs;
+        divisor <<= shift;
+        auto remainder = *this;
+        auto quotient = UInt256{};
+
+        while (true) {
+            if (0 <= remainder.Compare(divisor)) {
+                remainder -= divisor;
+                quotient.set_bit(shift);
+            }
+
+            if (0 == shift) { break; }
+
+            divisor >>= 1;
+            --shift;
+        }
+
+        return *this = quotient;
+    }
+
+    // Encodes as big endian hex with leading zero bytes removed, but at least
+    // minimumBytes (and never less than one byte) long
+    auto asHex(const std::size_t minimumBytes = 0) const noexcept
+        -> UnallocatedCString
+    {
+        static constexpr auto digits = std::string_view{"0123456789abcdef"};
+        const auto significant = std::max<std::size_t>((Bits() + 7) / 8, 1);
+        const auto size = std::max(significant, minimumBytes);
+        auto output = UnallocatedCString{};
+        output.reserve(2 * size);
+        output.append(2 * (size - significant), '0');
+
+        for (auto i = significant; i > 0; --i) {
+            const auto byte = get_byte(i - 1);
+            output.push_back(digits[byte >> 4]);
+            output.push_back(digits[byte & 0x0f]);
+        }
+
+        return output;
+    }
+    constexpr auto Bits() const noexcept -> std::size_t
+    {
+        for (auto i = limbs_; i > 0; --i) {
+            if (const auto limb = limb_[i - 1]; 0 != limb) {
+                auto bits = std::size_t{0};
+
+                for (auto value = limb; 0 != value; value >>= 1) { ++bits; }
+
+                return (32 * (i - 1)) + bits;
+            }
+        }
+
+        return 0;
+    }
+    constexpr auto BigEndian() const noexcept -> ByteArray
+    {
+        auto output = ByteArray{};
+
+        for (auto i = std::size_t{0}; i < size_; ++i) {
+            output[size_ - i - 1] = get_byte(i);
+        }
+
+        return output;
+    }
+    constexpr auto Compare(const UInt256& rhs) const noexcept -> int
+    {
+        for (auto i = limbs_; i > 0; --i) {
+            const auto& lhs = limb_[i - 1];
+            const auto& other = rhs.limb_[i - 1];
+
+            if (lhs < other) {
+
+                return -1;
+            } else if (lhs > other) {
+
+                return 1;
+            }
+        }
+
+        return 0;
+    }
+    auto Decimal() const noexcept -> UnallocatedCString
+    {
+        auto output = UnallocatedCString{};
+        auto value = *this;
+
+        do {
+            const auto digit = value.divide(10);
+            output.push_back(static_cast<char>('0' + digit));
+        } while (false == value.IsZero());
+
+        std::reverse(output.begin(), output.end());
+
+        return output;
+    }
+    constexpr auto IsZero() const noexcept -> bool
+    {
+        for (const auto& limb : limb_) {
+            if (0 != limb) { return false; }
+        }
+
+        return true;
+    }
+
+    constexpr UInt256() noexcept
+        : limb_()
+    {
+    }
+    constexpr UInt256(const std::uint64_t value) noexcept
+        : limb_()
+    {
+        limb_[0] = static_cast<std::uint32_t>(value);
+        limb_[1] = static_cast<std::uint32_t>(value >> 32);
+    }
+    constexpr UInt256(const UInt256&) noexcept = default;
+    constexpr auto operator=(const UInt256&) noexcept -> UInt256& = default;
+
+private:
+    static constexpr auto limbs_ = std::size_t{8};
+
+    // NOTE least significant limb first
+    std::array<std::uint32_t, limbs_> limb_;
+
+    constexpr auto divide(const std::uint32_t divisor) noexcept
+        -> std::uint32_t
+    {
+        auto remainder = std::uint64_t{0};
+
+        for (auto i = limbs_; i > 0; --i) {
+            const auto current = (remainder << 32) | limb_[i - 1];
+            limb_[i - 1] = static_cast<std::uint32_t>(current / divisor);
+            remainder = current % divisor;
+        }
+
+        return static_cast<std::uint32_t>(remainder);
+    }
+    constexpr auto get_byte(const std::size_t index) const noexcept
+        -> std::uint8_t
+    {
+        return static_cast<std::uint8_t>(
+            limb_[index / 4] >> (8 * (index % 4)));
+    }
+    constexpr auto set_bit(const std::size_t index) noexcept -> void
+    {
+        limb_[index / 32] |= std::uint32_t{1} << (index % 32);
+    }
+    constexpr auto set_byte(
+        const std::size_t index,
+        const std::uint8_t value) noexcept -> void
+    {
+        limb_[index / 4] |= std::uint32_t{value} << (8 * (index % 4));
+    }
+};
+
+constexpr auto operator==(const UInt256& lhs, const UInt256& rhs) noexcept
+    -> bool
+{
+    return 0 == lhs.Compare(rhs);
+}
+constexpr auto operator!=(const UInt256& lhs, const UInt256& rhs) noexcept
+    -> bool
+{
+    return 0 != lhs.Compare(rhs);
+}
+constexpr auto operator<(const UInt256& lhs, const UInt256& rhs) noexcept
+    -> bool
+{
+    return 0 > lhs.Compare(rhs);
+}
+constexpr auto operator<=(const UInt256& lhs, const UInt256& rhs) noexcept
+    -> bool
+{
+    return 0 >= lhs.Compare(rhs);
+}
+constexpr auto operator>(const UInt256& lhs, const UInt256& rhs) noexcept
+    -> bool
+{
+    return 0 < lhs.Compare(rhs);
+}
+constexpr auto operator>=(const UInt256& lhs, const UInt256& rhs) noexcept
+    -> bool
+{
+    return 0 <= lhs.Compare(rhs);
+}
+constexpr auto operator+(UInt256 lhs, const UInt256& rhs) noexcept -> UInt256
+{
+    return lhs += rhs;
+}
+constexpr auto operator/(UInt256 lhs, const UInt256& rhs) noexcept -> UInt256
+{
+    return lhs /= rhs;
+}
+}  // namespace opentxs::blockchain::bitcoin
@@ -66,6 +66,11 @@ struct EncodedTransaction;
 
 namespace block
 {
+namespace internal
+{
+struct HeaderRecord;
+}  // namespace internal
+
 class Hash;
 class Header;
 class Outpoint;
@@ -132,6 +137,10 @@ auto BitcoinBlockHeader(
     const api::Session& api,
     const proto::BlockchainBlockHeader& serialized) noexcept
     -> std::unique_ptr<blockchain::bitcoin::block::Header>;
+auto BitcoinBlockHeader(
+    const api::Session& api,
+    const blockchain::block::internal::HeaderRecord& record) noexcept
+    -> std::unique_ptr<blockchain::bitcoin::block::Header>;
 auto BitcoinBlockHeader(
     const api::Session& api,
     const blockchain::Type chain,
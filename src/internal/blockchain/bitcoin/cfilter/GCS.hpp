@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 
 #include "opentxs/blockchain/bitcoin/cfilter/GCS.hpp"
@@ -43,6 +44,19 @@ auto GolombDecode(
     const std::uint8_t P,
     const Vector<std::byte>& encoded,
     alloc::Default alloc) noexcept(false) -> Elements;
+/// Intersect a compressed set with a sorted, deduplicated list of targets
+///
+/// The encoded set is decoded incrementally and compared with the targets as
+/// it is read. Decoding stops as soon as all targets have been consumed, or
+/// after the first match if firstOnly is true. Matching elements are appended
+/// to out.
+auto GolombIntersect(
+    const std::uint32_t N,
+    const std::uint8_t P,
+    const Vector<std::byte>& encoded,
+    const Elements& targets,
+    const bool firstOnly,
+    Elements& out) noexcept(false) -> void;
 auto GolombEncode(
     const std::uint8_t P,
     const Elements& hashedSet,
@@ -53,6 +67,11 @@ auto HashToRange(
     const Range range,
     const ReadView item) noexcept(false) -> Element;
 auto HashToRange(const Range range, const Hash hash) noexcept(false) -> Element;
+/// Map every element of a batch of SipHash outputs to [0, range)
+auto HashToRange(
+    const Range range,
+    const Hashes& hashes,
+    alloc::Default alloc) noexcept -> Elements;
 auto HashedSetConstruct(
     const api::Session& api,
     const ReadView key,
@@ -64,6 +83,14 @@ auto Siphash(
     const api::Session& api,
     const ReadView key,
     const ReadView item) noexcept(false) -> Hash;
+/// Calculate SipHash-2-4 for every item under a single 16 byte key
+///
+/// Items of equal length are hashed several at a time when the cpu supports
+/// it. The output contains one hash per item, in the same order.
+auto Siphash(
+    const ReadView key,
+    const blockchain::GCS::Targets& items,
+    alloc::Default alloc) noexcept(false) -> Hashes;
 }  // namespace opentxs::gcs
 
 namespace opentxs::blockchain::internal
@@ -72,9 +99,16 @@ class GCS
 {
 public:
     using PrehashedMatches = Vector<gcs::Hashes::const_iterator>;
+    using PrehashedSets = Vector<const gcs::Hashes*>;
 
+    virtual auto CalculateSize() const noexcept -> std::size_t = 0;
     virtual auto Match(const gcs::Hashes& prehashed) const noexcept
         -> PrehashedMatches = 0;
+    /// Match several sets of prehashed targets in a single pass
+    ///
+    /// The output contains one entry for each input set, in the same order.
+    virtual auto Match(const PrehashedSets& sets, alloc::Default alloc)
+        const noexcept -> Vector<PrehashedMatches> = 0;
     virtual auto Range() const noexcept -> gcs::Range = 0;
     virtual auto Serialize(proto::GCS& out) const noexcept -> bool = 0;
     virtual auto Test(const gcs::Hashes& targets) const noexcept -> bool = 0;
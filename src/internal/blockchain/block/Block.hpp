@@ -6,6 +6,7 @@
 #pragma once
 
 #include <cstddef>
+#include <optional>
 
 #include "internal/blockchain/block/Types.hpp"
 #include "opentxs/blockchain/bitcoin/cfilter/Types.hpp"
@@ -26,13 +27,15 @@ namespace opentxs::blockchain::block::internal
 {
 struct Block : virtual public block::Block {
     virtual auto CalculateSize() const noexcept -> std::size_t = 0;
+    /// Returns an empty optional if any transaction fails to deserialize
     virtual auto ExtractElements(const cfilter::Type style) const noexcept
-        -> Vector<Vector<std::byte>> = 0;
+        -> std::optional<Vector<Vector<std::byte>>> = 0;
+    /// Returns an empty optional if any transaction fails to deserialize
     virtual auto FindMatches(
         const cfilter::Type type,
         const Patterns& txos,
         const Patterns& elements,
-        const Log& log) const noexcept -> Matches = 0;
+        const Log& log) const noexcept -> std::optional<Matches> = 0;
 
     ~Block() override = default;
 };
@@ -24,6 +24,8 @@ class BlockchainBlockHeader;
 
 namespace opentxs::blockchain::block::internal
 {
+struct LocalRecord;
+
 class Header
 {
 public:
@@ -43,6 +45,7 @@ public:
     virtual auto IsDisconnected() const noexcept -> bool = 0;
     virtual auto LocalState() const noexcept -> Status = 0;
     virtual auto Serialize(SerializedType& out) const noexcept -> bool = 0;
+    virtual auto SerializeLocal(LocalRecord& out) const noexcept -> bool = 0;
 
     virtual auto CompareToCheckpoint(const block::Position& checkpoint) noexcept
         -> void = 0;
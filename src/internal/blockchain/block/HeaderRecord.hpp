@@ -0,0 +1,161 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <boost/endian/buffers.hpp>
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+#include "internal/blockchain/bitcoin/UInt256.hpp"
+#include "internal/blockchain/block/Header.hpp"
+#include "opentxs/blockchain/BlockchainType.hpp"
+#include "opentxs/blockchain/block/Types.hpp"
+#include "opentxs/util/Bytes.hpp"
+
+namespace opentxs  // NOLINT
+{
+namespace proto
+{
+class BlockchainBlockHeader;
+class BlockchainBlockLocalData;
+}  // namespace proto
+}  // namespace opentxs
+
+namespace opentxs::blockchain::block::internal
+{
+namespace be = boost::endian;
+
+// Fixed layout storage records for block headers
+//
+// Every field is a byte array or little endian buffer so the records contain
+// no padding and may be read directly from mapped storage. The first byte is
+// always 0xff, which is never a valid protobuf tag, so records can be told
+// apart from the protobuf format used by earlier versions.
+struct LocalRecord {
+    static constexpr auto marker_value_ = std::uint8_t{0xff};
+    static constexpr auto version_value_ = std::uint8_t{1};
+
+    be::little_uint8_buf_t marker_;
+    be::little_uint8_buf_t version_;
+    be::little_int64_buf_t height_;
+    be::little_uint32_buf_t status_;
+    be::little_uint32_buf_t inherit_status_;
+    bitcoin::UInt256::ByteArray work_;
+    bitcoin::UInt256::ByteArray inherit_work_;
+
+    // Returns true if bytes contain a record in this format
+    static auto Check(const ReadView bytes) noexcept -> bool
+    {
+        return (sizeof(LocalRecord) == bytes.size()) &&
+               (marker_value_ == static_cast<std::uint8_t>(bytes[0])) &&
+               (version_value_ == static_cast<std::uint8_t>(bytes[1]));
+    }
+    static auto Read(const ReadView bytes) noexcept -> LocalRecord
+    {
+        auto output = LocalRecord{};
+        std::memcpy(static_cast<void*>(&output), bytes.data(), sizeof(output));
+
+        return output;
+    }
+
+    auto Bytes() const noexcept -> ReadView
+    {
+        return {reinterpret_cast<const char*>(this), sizeof(*this)};
+    }
+    auto InheritStatus() const noexcept -> Header::Status
+    {
+        return static_cast<Header::Status>(inherit_status_.value());
+    }
+    auto InheritWork() const noexcept -> bitcoin::UInt256
+    {
+        return bitcoin::UInt256::FromBigEndian(
+                   {reinterpret_cast<const char*>(inherit_work_.data()),
+                    inherit_work_.size()})
+            .value();
+    }
+    auto Status() const noexcept -> Header::Status
+    {
+        return static_cast<Header::Status>(status_.value());
+    }
+    auto Work() const noexcept -> bitcoin::UInt256
+    {
+        return bitcoin::UInt256::FromBigEndian(
+                   {reinterpret_cast<const char*>(work_.data()), work_.size()})
+            .value();
+    }
+
+    LocalRecord() noexcept
+        : marker_(marker_value_)
+        , version_(version_value_)
+        , height_(-1)
+        , status_(static_cast<std::uint32_t>(Header::Status::Normal))
+        , inherit_status_(static_cast<std::uint32_t>(Header::Status::Normal))
+        , work_()
+        , inherit_work_()
+    {
+        static_assert(82 == sizeof(LocalRecord));
+    }
+};
+
+struct HeaderRecord {
+    static constexpr auto marker_value_ = LocalRecord::marker_value_;
+    static constexpr auto version_value_ = std::uint8_t{1};
+    static constexpr auto raw_size_ = std::size_t{80};
+
+    be::little_uint8_buf_t marker_;
+    be::little_uint8_buf_t version_;
+    be::little_uint32_buf_t type_;
+    std::array<char, raw_size_> raw_;
+    LocalRecord local_;
+
+    // Returns true if bytes contain a record in this format
+    static auto Check(const ReadView bytes) noexcept -> bool
+    {
+        return (sizeof(HeaderRecord) == bytes.size()) &&
+               (marker_value_ == static_cast<std::uint8_t>(bytes[0])) &&
+               (version_value_ == static_cast<std::uint8_t>(bytes[1]));
+    }
+    static auto Read(const ReadView bytes) noexcept -> HeaderRecord
+    {
+        auto output = HeaderRecord{};
+        std::memcpy(static_cast<void*>(&output), bytes.data(), sizeof(output));
+
+        return output;
+    }
+
+    auto Bytes() const noexcept -> ReadView
+    {
+        return {reinterpret_cast<const char*>(this), sizeof(*this)};
+    }
+    auto Raw() const noexcept -> ReadView { return {raw_.data(), raw_.size()}; }
+    auto Type() const noexcept -> blockchain::Type
+    {
+        return static_cast<blockchain::Type>(type_.value());
+    }
+
+    HeaderRecord() noexcept
+        : marker_(marker_value_)
+        , version_(version_value_)
+        , type_()
+        , raw_()
+        , local_()
+    {
+        static_assert(168 == sizeof(HeaderRecord));
+    }
+};
+
+/// Converts a header stored in the legacy protobuf format
+///
+/// Throws std::runtime_error if the serialized header is not valid
+auto ConvertLegacy(const proto::BlockchainBlockHeader& in) noexcept(false)
+    -> HeaderRecord;
+/// Converts header metadata stored in the legacy protobuf format
+///
+/// Throws std::runtime_error if the serialized metadata is not valid
+auto ConvertLegacy(const proto::BlockchainBlockLocalData& in) noexcept(false)
+    -> LocalRecord;
+}  // namespace opentxs::blockchain::block::internal
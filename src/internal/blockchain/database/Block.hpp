@@ -43,9 +43,28 @@ public:
     virtual auto BlockLoadBitcoin(const block::Hash& block) const noexcept
         -> std::shared_ptr<const bitcoin::block::Block> = 0;
     virtual auto BlockPolicy() const noexcept -> database::BlockStorage = 0;
+    /// Returns true if the block was removed from storage by pruning
+    virtual auto BlockPruned(const block::Hash& block) const noexcept
+        -> bool = 0;
     virtual auto BlockTip() const noexcept -> block::Position = 0;
 
+    /// Remove old best chain blocks from storage
+    ///
+    /// Blocks are retained within depth blocks of the best chain tip and within
+    /// the most recent bytes of block data. A value of zero disables the
+    /// corresponding limit. Blocks which have not yet been processed by the
+    /// filter indexer or by every wallet subchain are never removed. At most
+    /// limit blocks are removed per call. Returns the number removed.
+    virtual auto BlockPrune(
+        const std::size_t depth,
+        const std::size_t bytes,
+        const std::size_t limit) noexcept -> std::size_t = 0;
     virtual auto BlockStore(const block::Block& block) noexcept -> bool = 0;
+    /// Reclaim space in the block storage shared by all chains
+    ///
+    /// At most limit items are moved. Returns the number moved.
+    virtual auto CompactStorage(const std::size_t limit) noexcept
+        -> std::size_t = 0;
     virtual auto SetBlockTip(const block::Position& position) noexcept
         -> bool = 0;
 
@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <tuple>
 
 #include "opentxs/blockchain/bitcoin/cfilter/Types.hpp"
@@ -66,6 +67,10 @@ public:
     virtual auto LoadFilterHeader(
         const cfilter::Type type,
         const ReadView block) const noexcept -> cfilter::Header = 0;
+    virtual auto LoadSerializedFilters(
+        const cfilter::Type type,
+        const Vector<block::Hash>& blocks,
+        alloc::Default alloc) const noexcept -> Vector<Vector<std::byte>> = 0;
 
     virtual auto SetFilterHeaderTip(
         const cfilter::Type type,
@@ -11,6 +11,7 @@
 #include "opentxs/blockchain/block/Position.hpp"
 #include "opentxs/blockchain/block/Types.hpp"
 #include "opentxs/util/Allocator.hpp"
+#include "opentxs/util/Container.hpp"
 
 // NOLINTBEGIN(modernize-concat-nested-namespaces)
 namespace opentxs  // NOLINT
@@ -50,6 +51,9 @@ public:
     // Throws std::out_of_range if no block at that position
     virtual auto BestBlock(const block::Height position) const noexcept(false)
         -> block::Hash = 0;
+    // Returns the hash of every block in the best chain ordered by height
+    virtual auto BestChain(alloc::Resource* alloc = alloc::System())
+        const noexcept -> HashVector = 0;
     virtual auto CurrentBest() const noexcept
         -> std::unique_ptr<block::Header> = 0;
     virtual auto CurrentCheckpoint() const noexcept -> block::Position = 0;
@@ -75,6 +79,12 @@ public:
 
     virtual auto ApplyUpdate(const node::UpdateTransaction& update) noexcept
         -> bool = 0;
+    // Appends headers to the best chain without reorg or checkpoint
+    // processing. The headers must be connected to their parents and must
+    // extend the current best chain in order.
+    virtual auto ImportHeaders(
+        const UnallocatedVector<std::unique_ptr<block::Header>>& headers)
+        noexcept -> bool = 0;
 
     virtual ~Header() = default;
 };
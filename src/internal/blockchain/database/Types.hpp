@@ -85,6 +85,7 @@ enum class Key : std::size_t {
     BestFullBlock = 4,
     SyncPosition = 5,
     WalletPosition = 6,
+    BlockPruneHeight = 7,
 };
 
 enum class BlockStorage : std::uint8_t {
@@ -62,6 +62,7 @@ namespace proto
 class BlockchainTransactionProposal;
 }  // namespace proto
 
+class Amount;
 class Identifier;
 // }  // namespace v1
 }  // namespace opentxs
@@ -201,6 +202,16 @@ public:
         const Identifier& proposal,
         node::internal::SpendPolicy& policy) noexcept
         -> std::optional<UTXO> = 0;
+    // Selects and reserves a set of outputs with a total effective value of
+    // at least target at the specified fee rate. Returns an empty vector if
+    // the spender does not have enough spendable outputs.
+    virtual auto ReserveUTXOs(
+        const identifier::Nym& spender,
+        const Identifier& proposal,
+        const Amount& target,
+        const Amount& feeRate,
+        node::internal::SpendPolicy& policy) noexcept
+        -> UnallocatedVector<UTXO> = 0;
     virtual auto StartReorg() noexcept -> storage::lmdb::LMDB::Transaction = 0;
     virtual auto SubchainAddElements(
         const SubchainIndex& index,
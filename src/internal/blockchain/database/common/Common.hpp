@@ -79,6 +79,9 @@ enum Table {
     FilterIndexBCH = 20,
     FilterIndexES = 21,
     TransactionIndex = 22,
+    BulkFreeSpace = 23,
+    SyncFreeSpace = 24,
+    BulkOwners = 25,
 };
 
 auto ChainToSyncTable(const opentxs::blockchain::Type chain) noexcept(false)
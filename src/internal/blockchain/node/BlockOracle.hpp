@@ -39,6 +39,8 @@ class BlockOracle final : public node::BlockOracle
 public:
     class Imp;
 
+    /// Current size of the in-memory block cache and per-consumer hit rates
+    auto CacheStatistics() const noexcept -> BlockCacheStatistics;
     auto DownloadQueue() const noexcept -> std::size_t final;
     auto Endpoint() const noexcept -> std::string_view;
     auto GetBlockBatch() const noexcept -> BlockBatch;
@@ -48,10 +50,28 @@ public:
     {
         return *this;
     }
+    /// Returns true if the block was removed from storage by pruning
+    auto IsPruned(const block::Hash& block) const noexcept -> bool;
     auto LoadBitcoin(const block::Hash& block) const noexcept
         -> BitcoinBlockResult final;
     auto LoadBitcoin(const Vector<block::Hash>& hashes) const noexcept
         -> BitcoinBlockResults final;
+    auto LoadBitcoin(
+        const block::Hash& block,
+        const BlockCacheConsumer consumer) const noexcept -> BitcoinBlockResult;
+    auto LoadBitcoin(
+        const Vector<block::Hash>& hashes,
+        const BlockCacheConsumer consumer) const noexcept
+        -> BitcoinBlockResults;
+    /// Returns futures for blocks the caller expects to need soon
+    ///
+    /// Blocks which are not already in memory are read from storage, or
+    /// downloaded if necessary, by the oracle in the order they were requested
+    /// rather than by the calling thread.
+    auto Prefetch(
+        const Vector<block::Hash>& hashes,
+        const BlockCacheConsumer consumer) const noexcept
+        -> BitcoinBlockResults;
     auto SubmitBlock(const ReadView in) const noexcept -> void;
     auto Tip() const noexcept -> block::Position final;
     auto Validate(const bitcoin::block::Block& block) const noexcept
@@ -5,7 +5,10 @@
 
 #pragma once
 
+#include <cstddef>
+
 #include "opentxs/util/Container.hpp"
+#include "util/ByteLiterals.hpp"
 
 namespace opentxs::blockchain::node::internal
 {
@@ -15,6 +18,10 @@ struct Config {
     bool provide_sync_server_{false};
     bool use_sync_server_{false};
     bool disable_wallet_{false};
+    std::size_t block_cache_bytes_{8_MiB};
+    std::size_t block_prune_depth_{0};
+    std::size_t block_prune_bytes_{0};
+    Set<CString> header_snapshots_{};
 
     auto print() const noexcept -> UnallocatedCString;
 };
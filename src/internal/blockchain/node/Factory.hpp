@@ -107,6 +107,7 @@ auto BlockchainWallet(
     -> std::unique_ptr<blockchain::node::internal::Wallet>;
 auto BlockOracle(
     const api::Session& api,
+    const blockchain::node::internal::Config& config,
     const blockchain::node::internal::Manager& node,
     const blockchain::node::HeaderOracle& header,
     blockchain::database::Block& db,
@@ -11,6 +11,7 @@
 
 #include "internal/util/Mutex.hpp"
 #include "opentxs/blockchain/node/HeaderOracle.hpp"
+#include "opentxs/util/Bytes.hpp"
 
 // NOLINTBEGIN(modernize-concat-nested-namespaces)
 namespace opentxs  // NOLINT
@@ -31,6 +32,14 @@ namespace cfilter
 {
 class Header;
 }  // namespace cfilter
+
+namespace node
+{
+namespace internal
+{
+struct Config;
+}  // namespace internal
+}  // namespace node
 }  // namespace blockchain
 
 namespace network
@@ -61,13 +70,33 @@ public:
     using node::HeaderOracle::CalculateReorg;
     virtual auto CalculateReorg(const Lock& lock, const block::Position& tip)
         const noexcept(false) -> Positions = 0;
+    // Writes the best chain from height 1 through last as a header snapshot
+    virtual auto ExportSnapshot(
+        const block::Height last,
+        const AllocateOutput destination) const noexcept -> bool = 0;
     virtual auto GetMutex() const noexcept -> std::mutex& = 0;
     using node::HeaderOracle::GetPosition;
     virtual auto GetPosition(const Lock& lock, const block::Height height)
         const noexcept -> block::Position = 0;
 
     virtual auto GetDefaultCheckpoint() const noexcept -> CheckpointData = 0;
-    virtual auto Init() noexcept -> void = 0;
+    // Bulk imports a header snapshot produced by ExportSnapshot
+    //
+    // The snapshot must be hash chained from the genesis block and must
+    // contain the default checkpoint. Only headers up to the checkpoint are
+    // imported, and only into a chain which does not yet extend past genesis.
+    // Headers are committed in batches so a failed import may leave a valid
+    // prefix of the snapshot in the best chain.
+    virtual auto ImportSnapshot(const ReadView snapshot) noexcept -> bool = 0;
+    // Bulk imports a header snapshot up to the specified checkpoint instead of
+    // the default checkpoint
+    virtual auto ImportSnapshot(
+        const ReadView snapshot,
+        const CheckpointData& checkpoint) noexcept -> bool = 0;
+    // Updates the stored checkpoint and, if the chain does not yet extend
+    // past genesis, imports the first header snapshot for this chain listed
+    // in the configuration
+    virtual auto Init(const Config& config) noexcept -> void = 0;
     virtual auto LoadBitcoinHeader(const block::Hash& hash) const noexcept
         -> std::unique_ptr<bitcoin::block::Header> = 0;
     virtual auto ProcessSyncData(
@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string_view>
 
@@ -14,6 +16,7 @@
 #include "opentxs/blockchain/bitcoin/cfilter/Types.hpp"
 #include "opentxs/blockchain/block/Position.hpp"
 #include "opentxs/blockchain/block/Types.hpp"
+#include "opentxs/util/Container.hpp"
 #include "opentxs/util/WorkType.hpp"
 #include "util/Blank.hpp"
 #include "util/Work.hpp"
@@ -80,6 +83,15 @@ struct make_blank<blockchain::block::Position> {
 
 namespace opentxs::blockchain::node
 {
+// WARNING update print function if new values are added or removed
+enum class BlockCacheConsumer : std::uint8_t {
+    unknown = 0,
+    wallet = 1,
+    filter_oracle = 2,
+    peer = 3,
+    manager = 4,
+};
+
 // WARNING update print function if new values are added or removed
 enum class BlockOracleJobs : OTZMQWorkType {
     shutdown = value(WorkType::Shutdown),
@@ -129,12 +141,31 @@ enum class PeerManagerJobs : OTZMQWorkType {
     StateMachine = OT_ZMQ_STATE_MACHINE_SIGNAL,
 };
 
+struct BlockCacheStatistics {
+    struct Consumer {
+        std::size_t hits_{};
+        std::size_t misses_{};
+        std::size_t hit_bytes_{};
+        std::size_t loaded_bytes_{};
+    };
+
+    std::size_t limit_{};
+    std::size_t blocks_{};
+    std::size_t bytes_{};
+    std::size_t recent_bytes_{};
+    std::size_t frequent_bytes_{};
+    std::size_t recent_target_{};
+    std::size_t evictions_{};
+    UnallocatedMap<BlockCacheConsumer, Consumer> consumers_{};
+};
+
 using BlockJob =
     download::Batch<std::shared_ptr<const bitcoin::block::Block>, int>;
 using CfheaderJob =
     download::Batch<cfilter::Hash, cfilter::Header, cfilter::Type>;
 using CfilterJob = download::Batch<GCS, cfilter::Header, cfilter::Type>;
 
+auto print(BlockCacheConsumer) noexcept -> std::string_view;
 auto print(ManagerJobs job) noexcept -> std::string_view;
 auto print(PeerManagerJobs job) noexcept -> std::string_view;
 auto print(BlockOracleJobs) noexcept -> std::string_view;
@@ -5,7 +5,11 @@
 
 #pragma once
 
+#include <cstddef>
+
+#include "internal/blockchain/bitcoin/cfilter/GCS.hpp"
 #include "internal/blockchain/node/Types.hpp"
+#include "internal/blockchain/node/filteroracle/Types.hpp"
 #include "opentxs/blockchain/bitcoin/cfilter/Types.hpp"
 #include "opentxs/blockchain/block/Position.hpp"
 #include "opentxs/blockchain/node/FilterOracle.hpp"
@@ -50,6 +54,8 @@ namespace opentxs::blockchain::node::internal
 class FilterOracle : virtual public node::FilterOracle
 {
 public:
+    /// Hit, miss, and memory usage counters for the shared cfilter cache
+    virtual auto CacheStats() const noexcept -> filteroracle::CacheStats = 0;
     virtual auto GetFilterJob() const noexcept -> CfilterJob = 0;
     virtual auto GetHeaderJob() const noexcept -> CfheaderJob = 0;
     virtual auto Heartbeat() const noexcept -> void = 0;
@@ -57,10 +63,30 @@ public:
     {
         return *this;
     }
+    /// Match prehashed targets against the cfilter for the specified block
+    ///
+    /// Concurrent calls for the same filter type and block are combined into a
+    /// single pass over the filter. The output contains one entry per set of
+    /// targets.
+    virtual auto MatchPrehashed(
+        const cfilter::Type type,
+        const block::Hash& block,
+        const GCS& filter,
+        const blockchain::internal::GCS::PrehashedSets& targets) const noexcept
+        -> Vector<blockchain::internal::GCS::PrehashedMatches> = 0;
     virtual auto LoadFilterOrResetTip(
         const cfilter::Type type,
         const block::Position& position,
         alloc::Default alloc) const noexcept -> GCS = 0;
+    /// Load the BIP-158 serialization of the filters for the specified blocks
+    ///
+    /// Intended for serving cfilters to peers: the filters are neither parsed
+    /// nor added to the cache. As with LoadFilters the output stops at the
+    /// first block for which no filter exists.
+    virtual auto LoadSerializedFilters(
+        const cfilter::Type type,
+        const Vector<block::Hash>& blocks,
+        alloc::Default alloc) const noexcept -> Vector<Vector<std::byte>> = 0;
     virtual auto ProcessBlock(const bitcoin::block::Block& block) const noexcept
         -> bool = 0;
     virtual auto ProcessBlock(
@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <functional>
 #include <string_view>
 
@@ -23,11 +24,19 @@ enum class BlockIndexerJob : OTZMQWorkType {
     shutdown = value(WorkType::Shutdown),
     header = value(WorkType::BlockchainNewHeader),
     reorg = value(WorkType::BlockchainReorg),
+    block_ready = value(WorkType::BlockchainBlockAvailable),
     reindex = OT_ZMQ_INTERNAL_SIGNAL + 0,
     full_block = OT_ZMQ_NEW_FULL_BLOCK_SIGNAL,
     init = OT_ZMQ_INIT_SIGNAL,
     statemachine = OT_ZMQ_STATE_MACHINE_SIGNAL,
 };
 
+struct CacheStats {
+    std::size_t bytes_{};
+    std::size_t count_{};
+    std::size_t hits_{};
+    std::size_t misses_{};
+};
+
 auto print(BlockIndexerJob) noexcept -> std::string_view;
 }  // namespace opentxs::blockchain::node::filteroracle
@@ -465,6 +465,14 @@ auto BitcoinP2PCfilter(
     const blockchain::block::Hash& hash,
     const blockchain::GCS& filter)
     -> blockchain::p2p::bitcoin::message::internal::Cfilter*;
+/// Construct a cfilter message from an existing BIP-158 serialized filter
+auto BitcoinP2PCfilter(
+    const api::Session& api,
+    const blockchain::Type network,
+    const blockchain::cfilter::Type type,
+    const blockchain::block::Hash& hash,
+    const ReadView serialized)
+    -> blockchain::p2p::bitcoin::message::internal::Cfilter*;
 auto BitcoinP2PCmpctblock(
     const api::Session& api,
     std::unique_ptr<blockchain::p2p::bitcoin::Header> pHeader,
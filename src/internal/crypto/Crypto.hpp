@@ -5,6 +5,12 @@
 
 #pragma once
 
+#include <cstddef>
+
+#include "opentxs/crypto/Bip32.hpp"
+#include "opentxs/crypto/Types.hpp"
+#include "opentxs/util/Container.hpp"
+
 // NOLINTBEGIN(modernize-concat-nested-namespaces)
 namespace opentxs  // NOLINT
 {
@@ -14,6 +20,16 @@ namespace api
 {
 class Factory;
 }  // namespace api
+
+namespace crypto
+{
+namespace key
+{
+class HD;
+}  // namespace key
+}  // namespace crypto
+
+class PasswordPrompt;
 // }  // namespace v1
 }  // namespace opentxs
 // NOLINTEND(modernize-concat-nested-namespaces)
@@ -21,6 +37,18 @@ class Factory;
 namespace opentxs::crypto::internal
 {
 struct Bip32 {
+    /// Derives the children [first, first + count) of parent
+    ///
+    /// Private keys are produced if parent contains a private key. Parent key
+    /// material is retrieved once for the entire batch.
+    ///
+    /// throws std::runtime_error on invalid inputs
+    virtual auto DeriveChildren(
+        const key::HD& parent,
+        const Bip32Index first,
+        const std::size_t count,
+        const PasswordPrompt& reason) const noexcept(false)
+        -> UnallocatedVector<crypto::Bip32::Key> = 0;
     virtual auto Init(const api::Factory& factory) noexcept -> void = 0;
 
     virtual ~Bip32() = default;
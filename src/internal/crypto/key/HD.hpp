@@ -0,0 +1,46 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+#include "opentxs/crypto/Types.hpp"
+#include "opentxs/util/Container.hpp"
+
+// NOLINTBEGIN(modernize-concat-nested-namespaces)
+namespace opentxs  // NOLINT
+{
+// inline namespace v1
+// {
+namespace crypto
+{
+namespace key
+{
+class HD;
+}  // namespace key
+}  // namespace crypto
+
+class PasswordPrompt;
+// }  // namespace v1
+}  // namespace opentxs
+// NOLINTEND(modernize-concat-nested-namespaces)
+
+namespace opentxs::crypto::key::internal
+{
+struct HD {
+    /// Derives the children [first, first + count)
+    ///
+    /// Returns an empty vector on failure
+    virtual auto ChildKeys(
+        const Bip32Index first,
+        const std::size_t count,
+        const PasswordPrompt& reason) const noexcept
+        -> UnallocatedVector<std::unique_ptr<key::HD>> = 0;
+
+    virtual ~HD() = default;
+};
+}  // namespace opentxs::crypto::key::internal
@@ -0,0 +1,28 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+
+#include "opentxs/util/Bytes.hpp"
+#include "opentxs/util/Container.hpp"
+
+namespace opentxs::crypto::sha256
+{
+static constexpr auto digest_size_ = std::size_t{32};
+
+/// Returns true if the cpu supports one of the accelerated kernels
+auto Accelerated() noexcept -> bool;
+/// Calculate the SHA-256 digest of every input
+///
+/// One digest per input is written to out, which must have room for
+/// digest_size_ * inputs.size() bytes. If twice is true each digest is hashed
+/// again to produce SHA-256d.
+auto Digest(
+    const Vector<ReadView>& inputs,
+    const bool twice,
+    std::byte* out) noexcept -> void;
+}  // namespace opentxs::crypto::sha256
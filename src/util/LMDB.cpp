@@ -674,6 +674,7 @@ LMDB::Transaction::Transaction(
     : success_(false)
     , lock_(std::move(lock))
     , ptr_(nullptr)
+    , on_commit_()
 {
     const Flags flags = rw ? 0u : MDB_RDONLY;
 
@@ -686,6 +687,7 @@ LMDB::Transaction::Transaction(Transaction&& rhs) noexcept
     : success_(rhs.success_)
     , lock_(std::move(rhs.lock_))
     , ptr_(rhs.ptr_)
+    , on_commit_(std::move(rhs.on_commit_))
 {
     rhs.ptr_ = nullptr;
 }
@@ -711,10 +713,18 @@ auto LMDB::Transaction::Finalize(const std::optional<bool> success) noexcept
         auto cleanup = Cleanup{ptr_};
 
         if (success_) {
+            const auto committed = (0 == ::mdb_txn_commit(ptr_));
 
-            return 0 == ::mdb_txn_commit(ptr_);
+            if (committed) {
+                for (auto& cb : on_commit_) { cb(); }
+            }
+
+            on_commit_.clear();
+
+            return committed;
         } else {
             ::mdb_txn_abort(ptr_);
+            on_commit_.clear();
 
             return true;
         }
@@ -723,6 +733,11 @@ auto LMDB::Transaction::Finalize(const std::optional<bool> success) noexcept
     return false;
 }
 
+auto LMDB::Transaction::OnCommit(std::function<void()>&& cb) noexcept -> void
+{
+    if (cb) { on_commit_.emplace_back(std::move(cb)); }
+}
+
 LMDB::Transaction::~Transaction() { Finalize(); }
 
 auto LMDB::Commit() const noexcept -> bool { return imp_->Commit(); }
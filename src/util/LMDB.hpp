@@ -50,6 +50,10 @@ public:
         operator MDB_txn*() noexcept { return ptr_; }
 
         auto Finalize(const std::optional<bool> success = {}) noexcept -> bool;
+        // The callback will be executed only if this transaction is
+        // successfully committed. It is discarded if the transaction is
+        // aborted.
+        auto OnCommit(std::function<void()>&& cb) noexcept -> void;
 
         Transaction(
             MDB_env* env,
@@ -66,6 +70,7 @@ public:
     private:
         std::unique_ptr<Lock> lock_;
         MDB_txn* ptr_;
+        UnallocatedVector<std::function<void()>> on_commit_;
     };
 
     auto Commit() const noexcept -> bool;
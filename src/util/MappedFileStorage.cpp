@@ -9,9 +9,12 @@
 
 #include <boost/filesystem.hpp>
 #include <boost/iostreams/device/mapped_file.hpp>
+#include <cs_plain_guarded.h>
 #include <algorithm>
 #include <cstring>
+#include <iterator>
 #include <memory>
+#include <optional>
 #include <stdexcept>
 #include <utility>
 
@@ -22,6 +25,13 @@
 #include "opentxs/util/Log.hpp"
 #include "util/FileSize.hpp"
 
+#if defined(__linux__)
+extern "C" {
+#include <sys/mman.h>
+#include <unistd.h>
+}
+#endif
+
 namespace fs = boost::filesystem;
 
 namespace opentxs::util
@@ -49,15 +59,95 @@ constexpr auto get_start_position(const std::size_t file) noexcept
 
 struct MappedFileStorage::Imp {
     using FileCounter = std::size_t;
+    using Position = IndexData::MemoryPosition;
+    using Size = IndexData::ItemSize;
+    using Extents = UnallocatedMap<Position, Size>;
+    using BySize = UnallocatedSet<std::pair<Size, Position>>;
+    using Committed = libguarded::plain_guarded<UnallocatedVector<IndexData>>;
+
+    // NOTE free extents smaller than this are not worth tracking
+    static constexpr auto min_extent_ = 64_uz;
+    // NOTE maximum number of free extents examined when looking for space
+    // closer to the start of the file
+    static constexpr auto relocate_search_ = 64_uz;
 
     LMDB& lmdb_;
     const UnallocatedCString path_prefix_;
     const UnallocatedCString filename_prefix_;
     const int table_;
     const std::size_t key_;
+    const int free_table_;
     mutable IndexData::MemoryPosition next_position_;
     mutable UnallocatedVector<boost::iostreams::mapped_file> files_;
+    // NOTE only extents freed by committed transactions are present in free_
+    // and by_size_. Extents freed by a transaction which is still in progress
+    // are added to committed_ by the commit callback and collected the next
+    // time free space is needed.
+    mutable Extents free_;
+    mutable BySize by_size_;
+    mutable std::size_t free_bytes_;
+    mutable Committed committed_;
+
+    static auto same_file(const Position first, const Position last) noexcept
+        -> bool
+    {
+        return get_offset(first).first == get_offset(last).first;
+    }
+
+    auto add_extent(const IndexData& extent) noexcept -> void
+    {
+        const auto added =
+            free_.try_emplace(extent.position_, extent.size_).second;
+
+        if (false == added) { return; }
+
+        by_size_.emplace(extent.size_, extent.position_);
+        free_bytes_ += extent.size_;
+    }
+    auto allocate(
+        LMDB::Transaction& tx,
+        const std::size_t bytes,
+        const std::optional<Position> below = std::nullopt) noexcept
+        -> std::optional<IndexData>
+    {
+        collect();
+        auto i = by_size_.lower_bound({bytes, 0_uz});
 
+        if (below.has_value()) {
+            for (auto n = 0_uz; n < relocate_search_; ++n, ++i) {
+                if ((by_size_.end() == i) || (i->second < below.value())) {
+                    break;
+                }
+            }
+        }
+
+        if (by_size_.end() == i) { return std::nullopt; }
+
+        const auto [size, position] = *i;
+
+        if (below.has_value() && (position >= below.value())) {
+            return std::nullopt;
+        }
+
+        if (false == lmdb_.Delete(free_table_, position, tx)) {
+            LogError()(OT_PRETTY_CLASS())("Failed to remove free extent")
+                .Flush();
+
+            return std::nullopt;
+        }
+
+        remove_extent(free_.find(position));
+
+        if (const auto remaining = size - bytes; remaining >= min_extent_) {
+            const auto rest = IndexData{position + bytes, remaining};
+            const auto stored =
+                lmdb_.Store(free_table_, rest.position_, tsv(rest.size_), tx);
+
+            if (stored.first) { on_commit(tx, rest); }
+        }
+
+        return IndexData{position, bytes};
+    }
     auto calculate_file_name(
         const UnallocatedCString& prefix,
         const FileCounter index) noexcept -> UnallocatedCString
@@ -78,6 +168,16 @@ struct MappedFileStorage::Imp {
             create_or_load(path_prefix_, files_.size(), files_);
         }
     }
+    auto collect() noexcept -> void
+    {
+        auto extents = UnallocatedVector<IndexData>{};
+        committed_.lock()->swap(extents);
+
+        for (const auto& extent : extents) {
+            punch(extent);
+            add_extent(extent);
+        }
+    }
     auto create_or_load(
         const UnallocatedCString& prefix,
         const FileCounter file,
@@ -149,15 +249,27 @@ struct MappedFileStorage::Imp {
             return output();
         }
 
-        increment_index(index, bytes);
-        LogDebug()(OT_PRETTY_CLASS())("Storing new item at position ")(
-            index.position_)
-            .Flush();
+        const auto old = index;
+        const auto reuse = allocate(tx, bytes);
+
+        if (reuse.has_value()) {
+            index = reuse.value();
+            LogDebug()(OT_PRETTY_CLASS())(
+                "Storing new item in free space at position ")(index.position_)
+                .Flush();
+        } else {
+            increment_index(tx, index, bytes);
+            LogDebug()(OT_PRETTY_CLASS())("Storing new item at position ")(
+                index.position_)
+                .Flush();
+        }
+
         const auto nextPosition = index.position_ + bytes;
 
         if (cb && (false == cb(tx))) { return {}; }
 
-        if (false == update_next_position(nextPosition, tx)) {
+        if ((false == reuse.has_value()) &&
+            (false == update_next_position(nextPosition, tx))) {
             LogError()(OT_PRETTY_CLASS())(
                 "Failed to update next write position")
                 .Flush();
@@ -165,9 +277,62 @@ struct MappedFileStorage::Imp {
             return {};
         }
 
+        if ((0 < old.size_) && (false == free_extent(tx, old))) {
+            LogError()(OT_PRETTY_CLASS())(
+                "Failed to record free space for replaced item")
+                .Flush();
+        }
+
         return output();
     }
-    auto increment_index(IndexData& index, std::size_t bytes) noexcept -> void
+    auto free_extent(LMDB::Transaction& tx, IndexData extent) noexcept -> bool
+    {
+        // NOTE merge with adjacent free extents but never across a file
+        // boundary since items may not span multiple files
+        if (auto next = free_.find(extent.position_ + extent.size_);
+            (free_.end() != next) &&
+            same_file(extent.position_, next->first + next->second - 1_uz)) {
+            if (false == lmdb_.Delete(free_table_, next->first, tx)) {
+                return false;
+            }
+
+            extent.size_ += next->second;
+            remove_extent(next);
+        }
+
+        if (auto i = free_.lower_bound(extent.position_); free_.begin() != i) {
+            auto prev = std::prev(i);
+            const auto adjacent =
+                (prev->first + prev->second) == extent.position_;
+
+            if (adjacent && same_file(
+                                prev->first,
+                                extent.position_ + extent.size_ - 1_uz)) {
+                if (false == lmdb_.Delete(free_table_, prev->first, tx)) {
+                    return false;
+                }
+
+                extent.position_ = prev->first;
+                extent.size_ += prev->second;
+                remove_extent(prev);
+            }
+        }
+
+        if (min_extent_ > extent.size_) { return true; }
+
+        const auto stored =
+            lmdb_.Store(free_table_, extent.position_, tsv(extent.size_), tx);
+
+        if (false == stored.first) { return false; }
+
+        on_commit(tx, extent);
+
+        return true;
+    }
+    auto increment_index(
+        LMDB::Transaction& tx,
+        IndexData& index,
+        std::size_t bytes) noexcept -> void
     {
         index.size_ = bytes;
         index.position_ = next_position_;
@@ -182,6 +347,12 @@ struct MappedFileStorage::Imp {
                 OT_ASSERT(end > start);
 
                 index.position_ = get_start_position(end);
+                // NOTE the unused space at the end of the previous file is
+                // available for smaller items
+                free_extent(
+                    tx,
+                    IndexData{
+                        next_position_, index.position_ - next_position_});
             }
         }
     }
@@ -200,6 +371,29 @@ struct MappedFileStorage::Imp {
 
         return output;
     }
+    auto load_free() noexcept -> void
+    {
+        const auto cb = [this](const auto key, const auto value) {
+            auto extent = IndexData{};
+
+            if ((sizeof(extent.position_) != key.size()) ||
+                (sizeof(extent.size_) != value.size())) {
+                LogError()(OT_PRETTY_CLASS())("Invalid free extent").Flush();
+
+                return true;
+            }
+
+            std::memcpy(&extent.position_, key.data(), key.size());
+            std::memcpy(&extent.size_, value.data(), value.size());
+
+            if ((extent.position_ + extent.size_) <= next_position_) {
+                add_extent(extent);
+            }
+
+            return true;
+        };
+        lmdb_.Read(free_table_, cb, LMDB::Dir::Forward);
+    }
     auto load_position(opentxs::storage::lmdb::LMDB& db) noexcept
         -> IndexData::MemoryPosition
     {
@@ -221,6 +415,169 @@ struct MappedFileStorage::Imp {
 
         return output;
     }
+    auto on_commit(LMDB::Transaction& tx, const IndexData& extent) noexcept
+        -> void
+    {
+        tx.OnCommit(
+            [this, extent] { committed_.lock()->emplace_back(extent); });
+    }
+    auto punch(const IndexData& index) noexcept -> void
+    {
+        if (0 == index.size_) { return; }
+
+        const auto [file, offset] = get_offset(index.position_);
+        check_file(file);
+#if defined(__linux__)
+        static const auto page =
+            static_cast<std::size_t>(std::max(::sysconf(_SC_PAGESIZE), 1l));
+        // NOTE only whole pages may be released since the neighboring items
+        // may share the first and last page of this one
+        const auto start = ((offset + page - 1_uz) / page) * page;
+        const auto end = ((offset + index.size_) / page) * page;
+
+        if (end <= start) { return; }
+
+        auto* data = files_.at(file).data() + start;
+
+        if (0 != ::madvise(data, end - start, MADV_REMOVE)) {
+            LogVerbose()(OT_PRETTY_CLASS())(
+                "unable to release storage for item at position ")(
+                index.position_)
+                .Flush();
+        }
+#endif
+    }
+    auto relocate(
+        LMDB::Transaction& tx,
+        IndexData& index,
+        UpdateCallback&& cb) noexcept -> bool
+    {
+        if (0 == index.size_) { return false; }
+
+        const auto old = index;
+        const auto extent = allocate(tx, old.size_, old.position_);
+
+        if (false == extent.has_value()) { return false; }
+
+        {
+            const auto from = get_read_view(old);
+            const auto [file, offset] = get_offset(extent->position_);
+            check_file(file);
+            auto* to = files_.at(file).data() + offset;
+            std::memcpy(to, from.data(), old.size_);
+        }
+
+        index = extent.value();
+
+        if (cb && (false == cb(tx))) {
+            index = old;
+
+            return false;
+        }
+
+        if (false == free_extent(tx, old)) {
+            LogError()(OT_PRETTY_CLASS())(
+                "Failed to record free space for relocated item")
+                .Flush();
+        }
+
+        return true;
+    }
+    auto release(LMDB::Transaction& tx, const IndexData& index) noexcept
+        -> void
+    {
+        if (0 == index.size_) { return; }
+
+        collect();
+
+        if (false == free_extent(tx, index)) {
+            LogError()(OT_PRETTY_CLASS())(
+                "Failed to record free space for item at position ")(
+                index.position_)
+                .Flush();
+        }
+    }
+    auto remove_extent(Extents::iterator i) noexcept -> void
+    {
+        OT_ASSERT(free_.end() != i);
+
+        by_size_.erase({i->second, i->first});
+        free_bytes_ -= i->second;
+        free_.erase(i);
+    }
+    auto lowest_free() noexcept -> std::optional<IndexData>
+    {
+        collect();
+
+        if (free_.empty()) { return std::nullopt; }
+
+        const auto& [position, size] = *free_.begin();
+
+        return IndexData{position, size};
+    }
+    auto trim(LMDB::Transaction& tx) noexcept -> std::size_t
+    {
+        collect();
+        auto end = next_position_;
+        auto removed = UnallocatedVector<IndexData>{};
+
+        while (false == free_.empty()) {
+            auto i = std::prev(free_.end());
+
+            if ((i->first + i->second) != end) { break; }
+
+            end = i->first;
+            removed.emplace_back(IndexData{i->first, i->second});
+            remove_extent(i);
+        }
+
+        if (removed.empty()) { return 0_uz; }
+
+        try {
+            for (const auto& extent : removed) {
+                if (false == lmdb_.Delete(free_table_, extent.position_, tx)) {
+                    throw std::runtime_error{"Failed to remove free extent"};
+                }
+            }
+
+            if (false == lmdb_.Store(table_, tsv(key_), tsv(end), tx).first) {
+                throw std::runtime_error{
+                    "Failed to update next write position"};
+            }
+
+            if (false == tx.Finalize(true)) {
+                throw std::runtime_error{"Failed to commit transaction"};
+            }
+        } catch (const std::exception& e) {
+            LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+            tx.Finalize(false);
+
+            for (const auto& extent : removed) { add_extent(extent); }
+
+            return 0_uz;
+        }
+
+        const auto output = next_position_ - end;
+        next_position_ = end;
+        const auto last = get_offset(next_position_).first;
+
+        while (files_.size() > (last + 1_uz)) {
+            const auto path =
+                calculate_file_name(path_prefix_, files_.size() - 1_uz);
+            files_.back().close();
+            files_.pop_back();
+
+            try {
+                fs::remove(path);
+            } catch (const std::exception& e) {
+                LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+            }
+        }
+
+        LogVerbose()(OT_PRETTY_CLASS())("reclaimed ")(output)(" bytes").Flush();
+
+        return output;
+    }
     auto update_next_position(
         IndexData::MemoryPosition position,
         LMDB::Transaction& tx) noexcept -> bool
@@ -243,14 +600,20 @@ struct MappedFileStorage::Imp {
         const UnallocatedCString& basePath,
         const UnallocatedCString filenamePrefix,
         int table,
-        std::size_t key) noexcept(false)
+        std::size_t key,
+        int freeTable) noexcept(false)
         : lmdb_(lmdb)
         , path_prefix_(basePath)
         , filename_prefix_(filenamePrefix)
         , table_(table)
         , key_(key)
+        , free_table_(freeTable)
         , next_position_(load_position(lmdb_))
         , files_(init_files(path_prefix_, next_position_))
+        , free_()
+        , by_size_()
+        , free_bytes_(0)
+        , committed_()
     {
         static_assert(1 == get_file_count(0));
         static_assert(1 == get_file_count(1));
@@ -276,6 +639,8 @@ struct MappedFileStorage::Imp {
 
             OT_ASSERT(files_.size() == (offset.first + 1));
         }
+
+        load_free();
     }
 };
 
@@ -284,14 +649,28 @@ MappedFileStorage::MappedFileStorage(
     const UnallocatedCString& basePath,
     const UnallocatedCString filenamePrefix,
     int table,
-    std::size_t key) noexcept(false)
+    std::size_t key,
+    int freeTable) noexcept(false)
     : lmdb_(lmdb)
-    , imp_p_(std::make_unique<Imp>(lmdb, basePath, filenamePrefix, table, key))
+    , imp_p_(std::make_unique<Imp>(
+          lmdb,
+          basePath,
+          filenamePrefix,
+          table,
+          key,
+          freeTable))
     , imp_(*imp_p_)
 {
     OT_ASSERT(imp_p_);
 }
 
+auto MappedFileStorage::free_bytes() const noexcept -> std::size_t
+{
+    imp_.collect();
+
+    return imp_.free_bytes_;
+}
+
 auto MappedFileStorage::get_read_view(const IndexData& index) const noexcept
     -> ReadView
 {
@@ -315,5 +694,37 @@ auto MappedFileStorage::get_write_view(
     return imp_.get_write_view(tx, index, {}, size);
 }
 
+auto MappedFileStorage::relocate(
+    LMDB::Transaction& tx,
+    IndexData& index,
+    UpdateCallback&& cb) const noexcept -> bool
+{
+    return imp_.relocate(tx, index, std::move(cb));
+}
+
+auto MappedFileStorage::release(
+    LMDB::Transaction& tx,
+    const IndexData& index) const noexcept -> void
+{
+    imp_.release(tx, index);
+}
+
+auto MappedFileStorage::lowest_free() const noexcept
+    -> std::optional<IndexData>
+{
+    return imp_.lowest_free();
+}
+
+auto MappedFileStorage::trim(LMDB::Transaction& tx) const noexcept
+    -> std::size_t
+{
+    return imp_.trim(tx);
+}
+
+auto MappedFileStorage::used_bytes() const noexcept -> std::size_t
+{
+    return imp_.next_position_;
+}
+
 MappedFileStorage::~MappedFileStorage() = default;
 }  // namespace opentxs::util
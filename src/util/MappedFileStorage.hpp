@@ -8,6 +8,7 @@
 #include <cstddef>
 #include <functional>
 #include <memory>
+#include <optional>
 
 #include "opentxs/Version.hpp"
 #include "opentxs/util/Bytes.hpp"
@@ -35,13 +36,21 @@ protected:
 
     // NOTE: this class performs no locking. Inheritors must ensure these
     // functions are not called simultaneously from multiple threads.
+
+    // Returns the number of bytes below the end of the file which are not
+    // referenced by any item
+    auto free_bytes() const noexcept -> std::size_t;
     auto get_read_view(const IndexData& index) const noexcept -> ReadView;
     // Default construct an IndexData if you just want to append a new item, or
     // supply an existing IndexData if you want to (potentially) replace the
     // existing item. An existing item will be overwritten if the size of the
     // old items matches the size of the new item; to do otherwise would be
-    // madness. If the size doesn't match then space will be allocated at the
-    // end of the file and we just forget about the old data.
+    // madness. If the size doesn't match then the old space is marked as free
+    // and the new item is written to a previously freed extent if one of
+    // sufficient size is available, or else appended to the end of the file.
+    //
+    // Space freed by a transaction can not be reused until that transaction
+    // has been committed.
     //
     // Regardless after this function is called the supplied index will be
     // updated to the location at which the return value points so you should
@@ -57,13 +66,46 @@ protected:
         LMDB::Transaction& tx,
         IndexData& index,
         std::size_t size) const noexcept -> WritableView;
+    // Returns the free extent closest to the start of the file, if any
+    auto lowest_free() const noexcept -> std::optional<IndexData>;
+    // Moves an item into free space closer to the start of the file, if a
+    // suitable extent is available, so that trailing space can be reclaimed by
+    // trim. The supplied index is updated and the callback is executed as for
+    // get_write_view. Returns false if the item was not moved.
+    auto relocate(
+        LMDB::Transaction& tx,
+        IndexData& index,
+        UpdateCallback&& cb) const noexcept -> bool;
+    // Marks the space used by an item which is no longer referenced as free.
+    // Once the transaction is committed the pages spanned by the item are
+    // returned to the operating system and, on platforms which support it, the
+    // backing file will no longer occupy disk space for those pages.
+    //
+    // The item must not be read after the transaction is committed.
+    auto release(LMDB::Transaction& tx, const IndexData& index) const noexcept
+        -> void;
+    // Moves the end of the file back past any trailing free space and removes
+    // backing files which are no longer needed. Returns the number of bytes
+    // reclaimed.
+    //
+    // The supplied transaction is finalized by this function if any space is
+    // reclaimed, otherwise it is left to the caller to discard. Callers which
+    // also hold a lock on this storage must begin the transaction before
+    // acquiring that lock since LMDB allows only one write transaction at a
+    // time.
+    //
+    // The caller must ensure no view into the removed space is in use.
+    auto trim(LMDB::Transaction& tx) const noexcept -> std::size_t;
+    // Returns the position of the end of the file
+    auto used_bytes() const noexcept -> std::size_t;
 
     MappedFileStorage(
         opentxs::storage::lmdb::LMDB& lmdb,
         const UnallocatedCString& basePath,
         const UnallocatedCString filenamePrefix,
         int table,
-        std::size_t key) noexcept(false);
+        std::size_t key,
+        int freeTable) noexcept(false);
 
     virtual ~MappedFileStorage();
 
@@ -36,6 +36,11 @@ struct Options::Imp::Parser {
     static constexpr auto blockchain_disable_{"disable_blockchain"};
     static constexpr auto blockchain_ipv4_bind_{"blockchain_bind_ipv4"};
     static constexpr auto blockchain_ipv6_bind_{"blockchain_bind_ipv6"};
+    static constexpr auto blockchain_block_cache_{"blockchain_block_cache"};
+    static constexpr auto blockchain_header_snapshot_{
+        "blockchain_header_snapshot"};
+    static constexpr auto blockchain_prune_bytes_{"blockchain_prune_bytes"};
+    static constexpr auto blockchain_prune_depth_{"blockchain_prune_depth"};
     static constexpr auto blockchain_storage_{"blockchain_storage"};
     static constexpr auto blockchain_sync_provide_{"provide_sync_server"};
     static constexpr auto blockchain_sync_connect_{"blockchain_sync_server"};
@@ -82,6 +87,26 @@ struct Options::Imp::Parser {
                 po::value<Multistring>()->multitoken()->composing(),
                 "Local ipv6 addresses to bind for incoming blockchain "
                 "connections");
+            out.add_options()(
+                blockchain_block_cache_,
+                po::value<std::size_t>(),
+                "Size limit in bytes of the in-memory block cache for each "
+                "blockchain");
+            out.add_options()(
+                blockchain_header_snapshot_,
+                po::value<Multistring>()->multitoken()->composing(),
+                "Header snapshot file(s) to import into blockchains which have "
+                "no headers past the genesis block");
+            out.add_options()(
+                blockchain_prune_bytes_,
+                po::value<std::size_t>(),
+                "Remove stored blocks from each blockchain once the most "
+                "recent blocks exceed this many bytes");
+            out.add_options()(
+                blockchain_prune_depth_,
+                po::value<std::size_t>(),
+                "Remove stored blocks from each blockchain which are buried "
+                "deeper than this many blocks (minimum 288)");
             out.add_options()(
                 blockchain_storage_,
                 po::value<int>(),
@@ -208,6 +233,10 @@ Options::Imp::Imp() noexcept
     : blockchain_disabled_chains_()
     , blockchain_ipv4_bind_()
     , blockchain_ipv6_bind_()
+    , blockchain_header_snapshots_()
+    , blockchain_block_cache_bytes_(std::nullopt)
+    , blockchain_prune_bytes_(std::nullopt)
+    , blockchain_prune_depth_(std::nullopt)
     , blockchain_storage_level_(std::nullopt)
     , blockchain_sync_server_enabled_(std::nullopt)
     , blockchain_sync_servers_()
@@ -308,6 +337,14 @@ auto Options::Imp::import_value(
             blockchain_ipv4_bind_.emplace(value);
         } else if (0 == key.compare(Parser::blockchain_ipv6_bind_)) {
             blockchain_ipv6_bind_.emplace(value);
+        } else if (0 == key.compare(Parser::blockchain_block_cache_)) {
+            blockchain_block_cache_bytes_ = std::stoull(sValue);
+        } else if (0 == key.compare(Parser::blockchain_header_snapshot_)) {
+            blockchain_header_snapshots_.emplace(value);
+        } else if (0 == key.compare(Parser::blockchain_prune_bytes_)) {
+            blockchain_prune_bytes_ = std::stoull(sValue);
+        } else if (0 == key.compare(Parser::blockchain_prune_depth_)) {
+            blockchain_prune_depth_ = std::stoull(sValue);
         } else if (0 == key.compare(Parser::blockchain_storage_)) {
             blockchain_storage_level_ = std::stoi(sValue);
         } else if (0 == key.compare(Parser::blockchain_sync_provide_)) {
@@ -424,6 +461,29 @@ auto Options::Imp::parse(int argc, char** argv) noexcept(false) -> void
                 }
             } catch (...) {
             }
+        } else if (name == Parser::blockchain_block_cache_) {
+            try {
+                blockchain_block_cache_bytes_ = value.as<std::size_t>();
+            } catch (...) {
+            }
+        } else if (name == Parser::blockchain_header_snapshot_) {
+            try {
+                const auto& paths = value.as<Parser::Multistring>();
+                auto& dest = blockchain_header_snapshots_;
+
+                for (const auto& path : paths) { dest.emplace(path.c_str()); }
+            } catch (...) {
+            }
+        } else if (name == Parser::blockchain_prune_bytes_) {
+            try {
+                blockchain_prune_bytes_ = value.as<std::size_t>();
+            } catch (...) {
+            }
+        } else if (name == Parser::blockchain_prune_depth_) {
+            try {
+                blockchain_prune_depth_ = value.as<std::size_t>();
+            } catch (...) {
+            }
         } else if (name == Parser::blockchain_storage_) {
             try {
                 blockchain_storage_level_ = value.as<int>();
@@ -615,6 +675,24 @@ auto operator+(const Options& lhs, const Options& rhs) noexcept -> Options
         r.blockchain_ipv6_bind_.begin(),
         r.blockchain_ipv6_bind_.end(),
         std::inserter(l.blockchain_ipv6_bind_, l.blockchain_ipv6_bind_.end()));
+    std::copy(
+        r.blockchain_header_snapshots_.begin(),
+        r.blockchain_header_snapshots_.end(),
+        std::inserter(
+            l.blockchain_header_snapshots_,
+            l.blockchain_header_snapshots_.end()));
+
+    if (const auto& v = r.blockchain_block_cache_bytes_; v.has_value()) {
+        l.blockchain_block_cache_bytes_ = v.value();
+    }
+
+    if (const auto& v = r.blockchain_prune_bytes_; v.has_value()) {
+        l.blockchain_prune_bytes_ = v.value();
+    }
+
+    if (const auto& v = r.blockchain_prune_depth_; v.has_value()) {
+        l.blockchain_prune_depth_ = v.value();
+    }
 
     if (const auto& v = r.blockchain_storage_level_; v.has_value()) {
         l.blockchain_storage_level_ = v.value();
@@ -760,6 +838,14 @@ auto Options::AddBlockchainIpv6Bind(std::string_view endpoint) noexcept
     return *this;
 }
 
+auto Options::AddBlockchainHeaderSnapshot(std::string_view path) noexcept
+    -> Options&
+{
+    imp_->blockchain_header_snapshots_.emplace(path);
+
+    return *this;
+}
+
 auto Options::AddBlockchainSyncServer(std::string_view endpoint) noexcept
     -> Options&
 {
@@ -806,6 +892,26 @@ auto Options::BlockchainBindIpv6() const noexcept -> const Set<CString>&
     return imp_->blockchain_ipv6_bind_;
 }
 
+auto Options::BlockchainBlockCacheBytes() const noexcept -> std::size_t
+{
+    return Imp::get(imp_->blockchain_block_cache_bytes_);
+}
+
+auto Options::BlockchainHeaderSnapshots() const noexcept -> const Set<CString>&
+{
+    return imp_->blockchain_header_snapshots_;
+}
+
+auto Options::BlockchainPruneBytes() const noexcept -> std::size_t
+{
+    return Imp::get(imp_->blockchain_prune_bytes_);
+}
+
+auto Options::BlockchainPruneDepth() const noexcept -> std::size_t
+{
+    return Imp::get(imp_->blockchain_prune_depth_);
+}
+
 auto Options::BlockchainStorageLevel() const noexcept -> int
 {
     return Imp::get(imp_->blockchain_storage_level_);
@@ -962,6 +1068,28 @@ auto Options::RemoteLogEndpoint() const noexcept -> std::string_view
     return Imp::get(imp_->log_endpoint_);
 }
 
+auto Options::SetBlockchainBlockCacheBytes(std::size_t bytes) noexcept
+    -> Options&
+{
+    imp_->blockchain_block_cache_bytes_ = bytes;
+
+    return *this;
+}
+
+auto Options::SetBlockchainPruneBytes(std::size_t bytes) noexcept -> Options&
+{
+    imp_->blockchain_prune_bytes_ = bytes;
+
+    return *this;
+}
+
+auto Options::SetBlockchainPruneDepth(std::size_t blocks) noexcept -> Options&
+{
+    imp_->blockchain_prune_depth_ = blocks;
+
+    return *this;
+}
+
 auto Options::SetBlockchainStorageLevel(int value) noexcept -> Options&
 {
     imp_->blockchain_storage_level_ = value;
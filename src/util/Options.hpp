@@ -24,6 +24,10 @@ struct Options::Imp final {
     Set<blockchain::Type> blockchain_disabled_chains_;
     Set<CString> blockchain_ipv4_bind_;
     Set<CString> blockchain_ipv6_bind_;
+    Set<CString> blockchain_header_snapshots_;
+    std::optional<std::size_t> blockchain_block_cache_bytes_;
+    std::optional<std::size_t> blockchain_prune_bytes_;
+    std::optional<std::size_t> blockchain_prune_depth_;
     std::optional<int> blockchain_storage_level_;
     std::optional<bool> blockchain_sync_server_enabled_;
     Set<CString> blockchain_sync_servers_;
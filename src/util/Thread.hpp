@@ -193,6 +193,16 @@ static_assert(
     subchainStateDataPrehash2ThreadName.size() <= MAX_THREAD_NAME_SIZE,
     "name is too long");
 
+constexpr std::string_view blockIndexerThreadName{"BlockIndexer\0"};
+static_assert(
+    blockIndexerThreadName.size() <= MAX_THREAD_NAME_SIZE,
+    "name is too long");
+
+constexpr std::string_view blockchainParallelThreadName{"BlockchainPar\0"};
+static_assert(
+    blockchainParallelThreadName.size() <= MAX_THREAD_NAME_SIZE,
+    "name is too long");
+
 constexpr std::string_view blockchainSyncThreadName{"BlockchainSync\0"};
 static_assert(
     blockchainSyncThreadName.size() <= MAX_THREAD_NAME_SIZE,
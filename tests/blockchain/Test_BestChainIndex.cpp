@@ -0,0 +1,99 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <opentxs/opentxs.hpp>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+
+#include "blockchain/node/BestChainIndex.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+using Index = ot::blockchain::node::BestChainIndex;
+using Hashes = ot::Vector<ot::blockchain::block::Hash>;
+using Height = ot::blockchain::block::Height;
+
+// NOTE larger than one segment so that both shared and partial segments are
+// exercised
+constexpr auto count_ = std::size_t{10000};
+
+auto make_hash(std::size_t height, std::size_t fork) noexcept
+    -> ot::blockchain::block::Hash
+{
+    auto bytes = std::array<std::byte, 32>{};
+    std::memcpy(bytes.data(), &height, sizeof(height));
+    std::memcpy(bytes.data() + sizeof(height), &fork, sizeof(fork));
+
+    return ot::ReadView{
+        reinterpret_cast<const char*>(bytes.data()), bytes.size()};
+}
+
+auto make_chain(std::size_t first, std::size_t last, std::size_t fork) noexcept
+    -> Hashes
+{
+    auto output = Hashes{};
+
+    for (auto i = first; i < last; ++i) {
+        output.emplace_back(make_hash(i, fork));
+    }
+
+    return output;
+}
+
+TEST(Test_BestChainIndex, empty)
+{
+    const auto index = Index{};
+
+    EXPECT_EQ(index.Height(), -1);
+    EXPECT_TRUE(index.Hash(0).IsNull());
+    EXPECT_TRUE(index.Hash(-1).IsNull());
+}
+
+TEST(Test_BestChainIndex, append)
+{
+    const auto base = Index{}.Update(0, make_chain(0, count_, 0));
+
+    ASSERT_EQ(base->Height(), static_cast<Height>(count_ - 1));
+
+    for (auto i = std::size_t{0}; i < count_; ++i) {
+        EXPECT_EQ(base->Hash(static_cast<Height>(i)), make_hash(i, 0));
+    }
+
+    EXPECT_TRUE(base->Hash(static_cast<Height>(count_)).IsNull());
+
+    const auto next = base->Update(count_, make_chain(count_, count_ + 5, 0));
+
+    ASSERT_EQ(next->Height(), static_cast<Height>(count_ + 4));
+    EXPECT_EQ(next->Position().hash_, make_hash(count_ + 4, 0));
+    EXPECT_EQ(base->Height(), static_cast<Height>(count_ - 1));
+    EXPECT_TRUE(base->Hash(static_cast<Height>(count_)).IsNull());
+}
+
+TEST(Test_BestChainIndex, reorg)
+{
+    constexpr auto fork = std::size_t{5000};
+    const auto base = Index{}.Update(0, make_chain(0, count_, 0));
+    const auto next = base->Update(fork, make_chain(fork, fork + 10, 1));
+
+    ASSERT_EQ(next->Height(), static_cast<Height>(fork + 9));
+
+    for (auto i = std::size_t{0}; i < fork; ++i) {
+        EXPECT_EQ(next->Hash(static_cast<Height>(i)), make_hash(i, 0));
+    }
+
+    for (auto i = fork; i < fork + 10; ++i) {
+        EXPECT_EQ(next->Hash(static_cast<Height>(i)), make_hash(i, 1));
+        EXPECT_EQ(base->Hash(static_cast<Height>(i)), make_hash(i, 0));
+    }
+
+    EXPECT_TRUE(next->Hash(static_cast<Height>(fork + 10)).IsNull());
+    EXPECT_EQ(base->Height(), static_cast<Height>(count_ - 1));
+}
+}  // namespace ottest
@@ -99,9 +99,14 @@ struct Test_BitcoinBlock : public ::testing::Test {
         -> ot::Vector<ot::OTData>
     {
         auto output = ot::Vector<ot::OTData>{};
+        const auto extracted = block.Internal().ExtractElements(
+            ot::blockchain::cfilter::Type::Basic_BIP158);
+
+        EXPECT_TRUE(extracted.has_value());
 
-        for (const auto& bytes : block.Internal().ExtractElements(
-                 ot::blockchain::cfilter::Type::Basic_BIP158)) {
+        if (false == extracted.has_value()) { return output; }
+
+        for (const auto& bytes : extracted.value()) {
             output.emplace_back(
                 api_.Factory().DataFromBytes(ot::reader(bytes)));
         }
@@ -461,6 +466,39 @@ TEST_F(Test_BitcoinBlock, serialization)
     }
 }
 
+TEST_F(Test_BitcoinBlock, transactions)
+{
+    using namespace opentxs::literals;
+
+    for (const auto& vector : GetBip158Vectors()) {
+        const auto raw = vector.Block(api_);
+        const auto pBlock = api_.Factory().BitcoinBlock(
+            ot::blockchain::Type::Bitcoin_testnet3, raw->Bytes());
+
+        ASSERT_TRUE(pBlock);
+
+        const auto& block = *pBlock;
+
+        ASSERT_LT(0u, block.size());
+
+        for (auto i = 0_uz; i < block.size(); ++i) {
+            const auto& pTx = block.at(i);
+
+            ASSERT_TRUE(pTx);
+
+            const auto& tx = *pTx;
+
+            EXPECT_EQ(block.at(tx.ID().Bytes()).get(), pTx.get());
+            EXPECT_EQ(block.at(i).get(), pTx.get());
+        }
+
+        auto serialized = api_.Factory().Data();
+
+        EXPECT_TRUE(block.Serialize(serialized->WriteInto()));
+        EXPECT_EQ(raw.get(), serialized);
+    }
+}
+
 TEST_F(Test_BitcoinBlock, bch_filter_1307544)
 {
     const auto& filter = GetBchCfilter1307544();
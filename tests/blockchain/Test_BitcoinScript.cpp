@@ -1921,4 +1921,36 @@ TEST(Test_BitcoinScript, input)
             std::memcmp(bytes.data(), serialized.data(), serialized.size()), 0);
     }
 }
+
+TEST(Test_BitcoinScript, truncated_push)
+{
+    const auto serialized = ot::Space{
+        std::byte{76}, std::byte{5}, std::byte{0xaa}, std::byte{0xbb}};
+    const auto script = ot::factory::BitcoinScript(
+        chain_, ot::reader(serialized), Position::Output, true);
+
+    ASSERT_TRUE(script);
+    EXPECT_EQ(Script::Pattern::Custom, script->Type());
+    ASSERT_EQ(1, script->size());
+    EXPECT_EQ(serialized.size(), script->CalculateSize());
+
+    {
+        const auto& [opcode, invalid, bytes, data] = script->at(0);
+
+        EXPECT_EQ(b::OP::PUSHDATA1, opcode);
+        EXPECT_FALSE(invalid);
+        ASSERT_TRUE(bytes);
+        ASSERT_EQ(1, bytes.value().size());
+        EXPECT_EQ(std::byte{5}, bytes.value().front());
+        ASSERT_TRUE(data);
+        ASSERT_EQ(2, data.value().size());
+        EXPECT_EQ(std::byte{0xaa}, data.value().front());
+        EXPECT_EQ(std::byte{0xbb}, data.value().back());
+    }
+
+    auto bytes = ot::Space{};
+
+    EXPECT_TRUE(script->Serialize(ot::writer(bytes)));
+    EXPECT_EQ(bytes, serialized);
+}
 }  // namespace
@@ -0,0 +1,272 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <opentxs/opentxs.hpp>
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <thread>
+
+#include "blockchain/node/blockoracle/MemDB.hpp"
+#include "internal/blockchain/Params.hpp"
+#include "internal/blockchain/block/Block.hpp"
+#include "internal/blockchain/node/BlockOracle.hpp"
+#include "internal/blockchain/node/Types.hpp"
+#include "ottest/fixtures/blockchain/Basic.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+using namespace std::literals::chrono_literals;
+using MemDB = ot::blockchain::node::blockoracle::MemDB;
+using Consumer = ot::blockchain::node::BlockCacheConsumer;
+
+// NOTE every entry uses the same block under a different id so that each
+// entry occupies exactly size_ bytes of the cache
+class Test_BlockCache : public ::testing::Test
+{
+public:
+    static constexpr auto cache_bytes_ = std::size_t{16u * 1024u * 1024u};
+
+    const ot::api::session::Client& api_;
+    const std::shared_ptr<const ot::blockchain::bitcoin::block::Block> block_;
+    const std::size_t size_;
+
+
+    auto find(MemDB& db, std::size_t index) const noexcept -> bool
+    {
+        const auto hash = BlockHash(index);
+
+        return db.find(hash.Bytes(), Consumer::wallet).valid();
+    }
+    auto push(MemDB& db, std::size_t index) const noexcept -> void
+    {
+        auto promise = std::promise<
+            std::shared_ptr<const ot::blockchain::bitcoin::block::Block>>{};
+        promise.set_value(block_);
+        db.push(
+            BlockHash(index), promise.get_future().share(), Consumer::wallet);
+    }
+
+    Test_BlockCache()
+        : api_(ot::Context().StartClientSession(
+              ot::Options{}
+                  .SetBlockchainWalletEnabled(false)
+                  .SetBlockchainBlockCacheBytes(cache_bytes_),
+              0))
+        , block_([&] {
+            constexpr auto chain = ot::blockchain::Type::UnitTest;
+            const auto& hex =
+                ot::blockchain::params::Chains().at(chain).genesis_block_hex_;
+            const auto bytes = api_.Factory().DataFromHex(hex);
+
+            return api_.Factory().BitcoinBlock(chain, bytes->Bytes());
+        }())
+        , size_([&]() -> std::size_t {
+            if (block_) { return block_->Internal().CalculateSize(); }
+
+            return 0;
+        }())
+    {
+    }
+};
+
+TEST_F(Test_BlockCache, promote_recent_to_frequent)
+{
+    ASSERT_TRUE(block_);
+    ASSERT_LT(0u, size_);
+
+    auto db = MemDB{4u * size_, {}};
+    push(db, 0);
+    push(db, 1);
+
+    {
+        const auto stats = db.Statistics();
+
+        EXPECT_EQ(stats.blocks_, 2u);
+        EXPECT_EQ(stats.recent_bytes_, 2u * size_);
+        EXPECT_EQ(stats.frequent_bytes_, 0u);
+    }
+
+    EXPECT_TRUE(find(db, 0));
+    EXPECT_TRUE(find(db, 0));
+    EXPECT_FALSE(find(db, 2));
+
+    {
+        const auto stats = db.Statistics();
+
+        EXPECT_EQ(stats.blocks_, 2u);
+        EXPECT_EQ(stats.recent_bytes_, size_);
+        EXPECT_EQ(stats.frequent_bytes_, size_);
+        EXPECT_EQ(stats.evictions_, 0u);
+
+        const auto& consumer = stats.consumers_.at(Consumer::wallet);
+
+        EXPECT_EQ(consumer.hits_, 2u);
+        EXPECT_EQ(consumer.misses_, 1u);
+        EXPECT_EQ(consumer.hit_bytes_, 2u * size_);
+        EXPECT_EQ(consumer.loaded_bytes_, 2u * size_);
+    }
+}
+
+TEST_F(Test_BlockCache, evict_at_byte_limit)
+{
+    ASSERT_TRUE(block_);
+
+    auto db = MemDB{4u * size_, {}};
+
+    for (auto i = std::size_t{0}; i < 5u; ++i) { push(db, i); }
+
+    const auto stats = db.Statistics();
+
+    EXPECT_EQ(stats.blocks_, 4u);
+    EXPECT_EQ(stats.bytes_, 4u * size_);
+    EXPECT_LE(stats.bytes_, stats.limit_);
+    EXPECT_EQ(stats.evictions_, 1u);
+    EXPECT_FALSE(find(db, 0));
+
+    for (auto i = std::size_t{1}; i < 5u; ++i) { EXPECT_TRUE(find(db, i)); }
+}
+
+TEST_F(Test_BlockCache, recent_ghost_hit)
+{
+    ASSERT_TRUE(block_);
+
+    auto db = MemDB{4u * size_, {}};
+    push(db, 0);
+
+    EXPECT_TRUE(find(db, 0));
+
+    for (auto i = std::size_t{1}; i < 5u; ++i) { push(db, i); }
+
+    EXPECT_EQ(db.Statistics().recent_target_, 0u);
+    EXPECT_EQ(db.Statistics().evictions_, 1u);
+    EXPECT_FALSE(find(db, 1));
+
+    // NOTE block 1 was evicted from the recent segment and left a ghost, so
+    // loading it again enlarges the recent segment and places the block in
+    // the frequent segment
+    push(db, 1);
+
+    const auto stats = db.Statistics();
+
+    EXPECT_EQ(stats.recent_target_, size_);
+    EXPECT_EQ(stats.frequent_bytes_, 2u * size_);
+    EXPECT_EQ(stats.recent_bytes_, 2u * size_);
+    EXPECT_EQ(stats.evictions_, 2u);
+    EXPECT_TRUE(find(db, 1));
+    EXPECT_FALSE(find(db, 2));
+}
+
+TEST_F(Test_BlockCache, frequent_ghost_hit)
+{
+    ASSERT_TRUE(block_);
+
+    auto db = MemDB{2u * size_, {}};
+    push(db, 0);
+
+    EXPECT_TRUE(find(db, 0));
+
+    push(db, 1);
+
+    EXPECT_TRUE(find(db, 1));
+
+    // NOTE the recent segment is above its target so block 2 is evicted
+    // from it immediately
+    push(db, 2);
+
+    EXPECT_EQ(db.Statistics().frequent_bytes_, 2u * size_);
+    EXPECT_EQ(db.Statistics().recent_bytes_, 0u);
+
+    // NOTE the recent ghost hit raises the target and the oldest frequent
+    // block is evicted to make room
+    push(db, 2);
+
+    EXPECT_EQ(db.Statistics().recent_target_, size_);
+    EXPECT_EQ(db.Statistics().evictions_, 2u);
+
+    // NOTE the frequent ghost hit lowers the target again
+    push(db, 0);
+
+    const auto stats = db.Statistics();
+
+    EXPECT_EQ(stats.recent_target_, 0u);
+    EXPECT_EQ(stats.frequent_bytes_, 2u * size_);
+    EXPECT_EQ(stats.evictions_, 3u);
+    EXPECT_TRUE(find(db, 0));
+    EXPECT_TRUE(find(db, 2));
+    EXPECT_FALSE(find(db, 1));
+}
+
+TEST_F(Test_BlockCache, scan_resistance)
+{
+    ASSERT_TRUE(block_);
+
+    auto db = MemDB{3u * size_, {}};
+    push(db, 0);
+
+    EXPECT_TRUE(find(db, 0));
+
+    // NOTE a scan loads every block exactly once
+    for (auto i = std::size_t{1}; i < 20u; ++i) {
+        push(db, i);
+
+        EXPECT_LE(db.Statistics().bytes_, 3u * size_);
+    }
+
+    EXPECT_TRUE(find(db, 0));
+    EXPECT_EQ(db.Statistics().frequent_bytes_, size_);
+}
+
+TEST_F(Test_BlockCache, clear)
+{
+    ASSERT_TRUE(block_);
+
+    auto db = MemDB{2u * size_, {}};
+
+    for (auto i = std::size_t{0}; i < 3u; ++i) { push(db, i); }
+
+    db.clear();
+    const auto stats = db.Statistics();
+
+    EXPECT_EQ(stats.blocks_, 0u);
+    EXPECT_EQ(stats.bytes_, 0u);
+    EXPECT_EQ(stats.recent_target_, 0u);
+    EXPECT_FALSE(find(db, 2));
+}
+
+TEST_F(Test_BlockCache, oracle_statistics)
+{
+    constexpr auto chain = ot::blockchain::Type::UnitTest;
+    auto& network = api_.Network().Blockchain();
+
+    ASSERT_TRUE(network.Start(chain, "do not init peers"));
+
+    const auto& oracle = network.GetChain(chain).BlockOracle().Internal();
+    const auto missing = BlockHash(1);
+    const auto recorded = [&] {
+        const auto stats = oracle.CacheStatistics();
+        const auto i = stats.consumers_.find(Consumer::wallet);
+
+        if (stats.consumers_.end() == i) { return false; }
+
+        return 0u < i->second.misses_;
+    };
+
+    EXPECT_EQ(oracle.CacheStatistics().limit_, cache_bytes_);
+
+    // NOTE requests are not counted until the oracle has finished starting
+    for (auto i = 0; (i < 100) && (false == recorded()); ++i) {
+        oracle.LoadBitcoin(missing, Consumer::wallet);
+        std::this_thread::sleep_for(100ms);
+    }
+
+    EXPECT_TRUE(recorded());
+    EXPECT_EQ(oracle.CacheStatistics().blocks_, 0u);
+}
+}  // namespace ottest
@@ -5,10 +5,14 @@
 
 #include <gtest/gtest.h>
 #include <opentxs/opentxs.hpp>
+#include <cstdint>
 #include <memory>
 
+#include "internal/blockchain/bitcoin/block/Factory.hpp"
 #include "internal/blockchain/block/Factory.hpp"
 #include "internal/blockchain/block/Header.hpp"
+#include "internal/blockchain/block/HeaderRecord.hpp"
+#include "serialization/protobuf/BlockchainBlockHeader.pb.h"
 #include "ottest/fixtures/blockchain/Basic.hpp"
 
 namespace b = ot::blockchain;
@@ -189,4 +193,67 @@ TEST_F(Test_BlockHeader, serialize_deserialize)
     EXPECT_EQ(restored->Valid(), header.Valid());
     EXPECT_EQ(restored->Work(), header.Work());
 }
+
+TEST_F(Test_BlockHeader, record)
+{
+    std::unique_ptr<const bb::Header> pHeader{
+        ot::factory::GenesisBlockHeader(api_, b::Type::Bitcoin)};
+
+    ASSERT_TRUE(pHeader);
+
+    const auto& header = *pHeader;
+    auto record = bb::internal::HeaderRecord{};
+    record.type_ = static_cast<std::uint32_t>(header.Type());
+
+    ASSERT_TRUE(header.Serialize(
+        ot::preallocated(record.raw_.size(), record.raw_.data()), true));
+    ASSERT_TRUE(header.Internal().SerializeLocal(record.local_));
+
+    const auto bytes = record.Bytes();
+
+    ASSERT_TRUE(bb::internal::HeaderRecord::Check(bytes));
+
+    const auto restored = ot::factory::BitcoinBlockHeader(
+        api_, bb::internal::HeaderRecord::Read(bytes));
+
+    ASSERT_TRUE(restored);
+    EXPECT_EQ(restored->Hash(), header.Hash());
+    EXPECT_EQ(restored->Height(), header.Height());
+    EXPECT_EQ(restored->Work(), header.Work());
+    EXPECT_EQ(restored->ParentWork(), header.ParentWork());
+    EXPECT_EQ(
+        restored->Internal().LocalState(), header.Internal().LocalState());
+    EXPECT_EQ(
+        restored->Internal().InheritedState(),
+        header.Internal().InheritedState());
+    EXPECT_EQ(restored->Print(), header.Print());
+}
+
+TEST_F(Test_BlockHeader, legacy_record)
+{
+    std::unique_ptr<const bb::Header> pHeader{
+        ot::factory::GenesisBlockHeader(api_, b::Type::Bitcoin)};
+
+    ASSERT_TRUE(pHeader);
+
+    const auto& header = *pHeader;
+    auto proto = bb::internal::Header::SerializedType{};
+
+    ASSERT_TRUE(header.Internal().Serialize(proto));
+
+    const auto record = bb::internal::ConvertLegacy(proto);
+    auto raw = ot::Space{};
+
+    ASSERT_TRUE(header.Serialize(ot::writer(raw), true));
+    EXPECT_EQ(record.Type(), header.Type());
+    EXPECT_EQ(record.Raw(), ot::reader(raw));
+
+    const auto restored = ot::factory::BitcoinBlockHeader(api_, record);
+
+    ASSERT_TRUE(restored);
+    EXPECT_EQ(restored->Hash(), header.Hash());
+    EXPECT_EQ(restored->Height(), header.Height());
+    EXPECT_EQ(restored->Work(), header.Work());
+    EXPECT_EQ(restored->ParentWork(), header.ParentWork());
+}
 }  // namespace ottest
@@ -0,0 +1,232 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <opentxs/opentxs.hpp>
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <optional>
+#include <tuple>
+
+#include "blockchain/node/blockoracle/Prefetcher.hpp"
+#include "blockchain/node/filteroracle/PrefetchWindow.hpp"
+#include "internal/blockchain/node/Types.hpp"
+#include "ottest/fixtures/blockchain/Basic.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+using namespace std::literals::chrono_literals;
+using Consumer = ot::blockchain::node::BlockCacheConsumer;
+using Hash = ot::blockchain::block::Hash;
+using Hashes = ot::Vector<Hash>;
+using Prefetcher = ot::blockchain::node::blockoracle::Prefetcher;
+using Window = ot::blockchain::node::filteroracle::PrefetchWindow;
+
+class Test_BlockPrefetch : public ::testing::Test
+{
+public:
+    static constexpr auto limit_ = std::size_t{4};
+
+    Hashes requested_;
+    std::size_t requests_;
+    const Window::Request request_;
+
+    static auto ids(std::size_t first, std::size_t count) noexcept -> Hashes
+    {
+        auto out = Hashes{};
+
+        for (auto i = first; i < first + count; ++i) {
+            out.emplace_back(BlockHash(i));
+        }
+
+        return out;
+    }
+    static auto check(const Window& window, const Hashes& expected) noexcept
+        -> void
+    {
+        ASSERT_EQ(window.size(), expected.size());
+
+        for (auto i = std::size_t{0}; i < expected.size(); ++i) {
+            EXPECT_EQ(window.at(i).first, expected[i]);
+            EXPECT_TRUE(window.at(i).second.valid());
+        }
+    }
+
+    Test_BlockPrefetch()
+        : requested_()
+        , requests_(0)
+        , request_([this](const Hashes& hashes) {
+            ++requests_;
+            requested_.insert(requested_.end(), hashes.begin(), hashes.end());
+            auto out = ot::blockchain::node::BitcoinBlockResults{};
+
+            for (auto i = std::size_t{0}; i < hashes.size(); ++i) {
+                auto promise = Prefetcher::Promise{};
+                promise.set_value(nullptr);
+                out.emplace_back(promise.get_future());
+            }
+
+            return out;
+        })
+    {
+    }
+};
+
+TEST_F(Test_BlockPrefetch, prefetcher_queues_once)
+{
+    auto prefetcher = Prefetcher{ot::alloc::Default{}};
+    const auto first = prefetcher.Add(BlockHash(0), Consumer::filter_oracle);
+    const auto second = prefetcher.Add(BlockHash(1), Consumer::filter_oracle);
+    const auto repeat = prefetcher.Add(BlockHash(0), Consumer::wallet);
+
+    ASSERT_TRUE(first.valid());
+    ASSERT_TRUE(repeat.valid());
+    EXPECT_EQ(prefetcher.size(), 2u);
+    EXPECT_TRUE(prefetcher.HaveQueued());
+    EXPECT_FALSE(prefetcher.Find(BlockHash(2)).valid());
+
+    // NOTE a block requested twice is loaded once and every requestor is
+    // waiting on the same future
+    EXPECT_EQ(prefetcher.Next().value_or(Hash{}), BlockHash(0));
+    EXPECT_EQ(prefetcher.Next().value_or(Hash{}), BlockHash(1));
+    EXPECT_FALSE(prefetcher.Next().has_value());
+    EXPECT_FALSE(prefetcher.HaveQueued());
+    EXPECT_EQ(prefetcher.size(), 2u);
+
+    auto item = prefetcher.Extract(BlockHash(0));
+
+    ASSERT_TRUE(item.has_value());
+    EXPECT_EQ(std::get<2>(*item), Consumer::filter_oracle);
+
+    std::get<0>(*item).set_value(nullptr);
+
+    EXPECT_EQ(first.wait_for(0s), std::future_status::ready);
+    EXPECT_EQ(repeat.wait_for(0s), std::future_status::ready);
+    EXPECT_EQ(second.wait_for(0s), std::future_status::timeout);
+}
+
+TEST_F(Test_BlockPrefetch, prefetcher_delivers_once)
+{
+    auto prefetcher = Prefetcher{ot::alloc::Default{}};
+    prefetcher.Add(BlockHash(0), Consumer::filter_oracle);
+    prefetcher.Add(BlockHash(1), Consumer::filter_oracle);
+
+    // NOTE a block which was delivered before the loader reached it must not
+    // be loaded or delivered again
+    EXPECT_TRUE(prefetcher.Extract(BlockHash(0)).has_value());
+    EXPECT_FALSE(prefetcher.Extract(BlockHash(0)).has_value());
+    EXPECT_FALSE(prefetcher.Find(BlockHash(0)).valid());
+    EXPECT_EQ(prefetcher.Next().value_or(Hash{}), BlockHash(1));
+    EXPECT_FALSE(prefetcher.Next().has_value());
+    EXPECT_TRUE(prefetcher.Extract(BlockHash(1)).has_value());
+    EXPECT_FALSE(prefetcher.Extract(BlockHash(1)).has_value());
+    EXPECT_EQ(prefetcher.size(), 0u);
+
+    // NOTE once delivered a block may be prefetched again
+    prefetcher.Add(BlockHash(0), Consumer::filter_oracle);
+
+    EXPECT_EQ(prefetcher.Next().value_or(Hash{}), BlockHash(0));
+}
+
+TEST_F(Test_BlockPrefetch, prefetcher_cancel)
+{
+    auto prefetcher = Prefetcher{ot::alloc::Default{}};
+    auto future = prefetcher.Add(BlockHash(0), Consumer::wallet);
+    prefetcher.Cancel();
+
+    ASSERT_EQ(future.wait_for(0s), std::future_status::ready);
+    EXPECT_FALSE(future.get());
+    EXPECT_EQ(prefetcher.size(), 0u);
+    EXPECT_FALSE(prefetcher.HaveQueued());
+    EXPECT_FALSE(prefetcher.Next().has_value());
+}
+
+TEST_F(Test_BlockPrefetch, window_bound)
+{
+    auto window = Window{limit_, {}};
+    window.Update(ids(0, 2 * limit_), request_);
+
+    EXPECT_EQ(requests_, 1u);
+    EXPECT_EQ(requested_, ids(0, limit_));
+    check(window, ids(0, limit_));
+}
+
+TEST_F(Test_BlockPrefetch, window_requests_missing_blocks_once)
+{
+    auto window = Window{limit_, {}};
+    window.Update(ids(0, 2), request_);
+
+    EXPECT_EQ(requested_, ids(0, 2));
+
+    window.Update(ids(0, 2), request_);
+
+    EXPECT_EQ(requests_, 1u);
+
+    window.Update(ids(0, limit_), request_);
+
+    EXPECT_EQ(requests_, 2u);
+    EXPECT_EQ(requested_, ids(0, limit_));
+    check(window, ids(0, limit_));
+
+    // NOTE advancing the window only requests the blocks at the end
+    window.pop_front(2);
+    check(window, ids(2, 2));
+    window.Update(ids(2, limit_), request_);
+
+    EXPECT_EQ(requests_, 3u);
+    EXPECT_EQ(requested_, ids(0, limit_ + 2));
+    check(window, ids(2, limit_));
+}
+
+TEST_F(Test_BlockPrefetch, window_reorg)
+{
+    auto window = Window{limit_, {}};
+    window.Update(ids(0, limit_), request_);
+    requested_.clear();
+
+    // NOTE the last two blocks were replaced by a reorg
+    auto reorg = ids(0, 2);
+    reorg.emplace_back(BlockHash(100));
+    reorg.emplace_back(BlockHash(101));
+    window.Update(reorg, request_);
+
+    EXPECT_EQ(requests_, 2u);
+    EXPECT_EQ(requested_, ids(100, 2));
+    check(window, reorg);
+
+    // NOTE the new chain is shorter than the window
+    requested_.clear();
+    window.Update(ids(0, 1), request_);
+
+    EXPECT_EQ(requests_, 2u);
+    EXPECT_TRUE(requested_.empty());
+    check(window, ids(0, 1));
+
+    window.clear();
+
+    EXPECT_TRUE(window.empty());
+
+    window.Update(ids(0, 1), request_);
+
+    EXPECT_EQ(requests_, 3u);
+    check(window, ids(0, 1));
+}
+
+TEST_F(Test_BlockPrefetch, window_pop_front)
+{
+    auto window = Window{limit_, {}};
+    window.Update(ids(0, limit_), request_);
+    window.pop_front(1);
+
+    EXPECT_EQ(window.front().first, BlockHash(1));
+
+    window.pop_front(2 * limit_);
+
+    EXPECT_TRUE(window.empty());
+}
+}  // namespace ottest
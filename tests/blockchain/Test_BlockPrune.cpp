@@ -0,0 +1,197 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+extern "C" {
+#include <lmdb.h>
+}
+
+#include <gtest/gtest.h>
+#include <opentxs/opentxs.hpp>
+#include <cstddef>
+#include <cstring>
+#include <optional>
+
+#include "blockchain/database/Blocks.hpp"
+#include "blockchain/database/PruneIndex.hpp"
+#include "blockchain/database/common/Database.hpp"
+#include "internal/api/network/Blockchain.hpp"
+#include "internal/blockchain/Params.hpp"
+#include "internal/blockchain/database/Types.hpp"
+#include "ottest/fixtures/blockchain/Basic.hpp"
+#include "util/LMDB.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+using Height = ot::blockchain::block::Height;
+using Hash = ot::blockchain::block::Hash;
+using PruneIndex = ot::blockchain::database::PruneIndex;
+
+class Test_BlockPrune : public ::testing::Test
+{
+public:
+    static constexpr auto chain_ = ot::blockchain::Type::UnitTest;
+    static constexpr auto size_ = std::size_t{100};
+
+    const ot::api::session::Client& api_;
+    const ot::blockchain::database::common::Database& common_;
+    ot::storage::lmdb::LMDB lmdb_;
+    ot::blockchain::database::Blocks blocks_;
+    PruneIndex index_;
+
+
+    // NOTE records blocks 1 through count, each of which is size_ bytes
+    auto fill(Height count) noexcept -> void
+    {
+        for (auto height = Height{1}; height <= count; ++height) {
+            const auto added = index_.Add(
+                height, BlockHash(static_cast<std::size_t>(height)), size_);
+
+            ASSERT_TRUE(added);
+        }
+    }
+
+    Test_BlockPrune()
+        : api_(ot::Context().StartClientSession(0))
+        , common_(api_.Network().Blockchain().Internal().Database())
+        , lmdb_(
+              {{ot::blockchain::database::Config, "config"}},
+              common_.AllocateStorageFolder("prune_test"),
+              {{ot::blockchain::database::Config, MDB_INTEGERKEY}},
+              0)
+        , blocks_(api_, common_, lmdb_, chain_)
+        , index_()
+    {
+    }
+};
+
+TEST_F(Test_BlockPrune, ceiling)
+{
+    EXPECT_EQ(PruneIndex::Ceiling(100, 90, std::nullopt), 90);
+    EXPECT_EQ(PruneIndex::Ceiling(80, 90, std::nullopt), 80);
+    EXPECT_EQ(PruneIndex::Ceiling(100, 90, 50), 50);
+    EXPECT_EQ(PruneIndex::Ceiling(100, 40, 50), 40);
+    // NOTE a subchain which has not been scanned reports height zero
+    EXPECT_EQ(PruneIndex::Ceiling(100, 90, 0), 0);
+    // NOTE blank positions never produce a negative ceiling
+    EXPECT_EQ(PruneIndex::Ceiling(100, -1, std::nullopt), 0);
+    EXPECT_EQ(PruneIndex::Ceiling(100, 90, -1), 0);
+}
+
+TEST_F(Test_BlockPrune, depth_target)
+{
+    EXPECT_EQ(index_.Target(1000, 1000, 0, 0), 0);
+    EXPECT_EQ(index_.Target(1000, 1000, 500, 0), 500);
+    EXPECT_EQ(index_.Target(1000, 400, 500, 0), 400);
+    EXPECT_EQ(index_.Target(300, 300, 500, 0), 0);
+}
+
+TEST_F(Test_BlockPrune, byte_target)
+{
+    // NOTE the tip is far enough past the recorded blocks that the retention
+    // floor does not apply
+    const auto tip = Height{10} + PruneIndex::minimum_retained_;
+    fill(10);
+
+    EXPECT_EQ(index_.Bytes(), 10u * size_);
+    EXPECT_EQ(index_.Target(tip, tip, 0, 10u * size_), 0);
+    EXPECT_EQ(index_.Target(tip, tip, 0, 350u), 7);
+    EXPECT_EQ(index_.Target(tip, tip, 0, 300u), 7);
+    EXPECT_EQ(index_.Target(tip, tip, 293, 350u), 7);
+    EXPECT_EQ(index_.Target(tip, tip, 290, 350u), 8);
+    EXPECT_EQ(index_.Target(tip, 4, 0, 350u), 4);
+}
+
+TEST_F(Test_BlockPrune, retention_floor)
+{
+    const auto tip = Height{300};
+    const auto retained = tip - PruneIndex::minimum_retained_;
+    fill(tip);
+
+    // NOTE limits which would keep fewer than 288 blocks are raised
+    EXPECT_EQ(index_.Target(tip, tip, 10, 0), retained);
+    EXPECT_EQ(index_.Target(tip, tip, 0, size_), retained);
+    EXPECT_EQ(index_.Target(tip, tip, 10, size_), retained);
+    EXPECT_EQ(index_.Target(tip, 5, 10, size_), 5);
+    EXPECT_EQ(index_.Target(tip, tip, 0, 0), 0);
+    // NOTE a chain shorter than the floor is never pruned
+    EXPECT_EQ(index_.Target(100, 100, 10, size_), 0);
+}
+
+TEST_F(Test_BlockPrune, running_total)
+{
+    fill(10);
+
+    EXPECT_FALSE(index_.Add(12, BlockHash(12), size_));
+    EXPECT_EQ(index_.Next(), 11);
+
+    index_.Forget(3);
+
+    EXPECT_EQ(index_.Bytes(), 7u * size_);
+
+    // NOTE a reorg replaced blocks 9 and 10
+    index_.Rewind(8);
+
+    ASSERT_TRUE(index_.Last().has_value());
+    EXPECT_EQ(index_.Last()->height_, 8);
+    EXPECT_EQ(index_.Bytes(), 5u * size_);
+    EXPECT_TRUE(index_.Add(9, BlockHash(109), size_));
+
+    // NOTE a block recorded before it was downloaded is resized when stored
+    index_.Resize(BlockHash(5), 3u * size_);
+
+    EXPECT_EQ(index_.Bytes(), 8u * size_);
+
+    index_.Resize(BlockHash(2), 3u * size_);
+    index_.Resize(BlockHash(10), 3u * size_);
+
+    EXPECT_EQ(index_.Bytes(), 8u * size_);
+
+    index_.clear();
+
+    EXPECT_TRUE(index_.empty());
+    EXPECT_EQ(index_.Bytes(), 0u);
+    EXPECT_FALSE(index_.Next().has_value());
+}
+
+TEST_F(Test_BlockPrune, prune_height)
+{
+    EXPECT_EQ(blocks_.PruneHeight(), 0);
+    EXPECT_TRUE(blocks_.SetPruneHeight(42));
+    EXPECT_EQ(blocks_.PruneHeight(), 42);
+    EXPECT_TRUE(blocks_.SetPruneHeight(-1));
+    EXPECT_EQ(blocks_.PruneHeight(), 0);
+}
+
+TEST_F(Test_BlockPrune, forget)
+{
+    const auto& hex =
+        ot::blockchain::params::Chains().at(chain_).genesis_hash_hex_;
+    auto genesis = Hash{};
+
+    ASSERT_TRUE(genesis.DecodeHex(hex));
+    EXPECT_FALSE(blocks_.Forget(genesis));
+    EXPECT_TRUE(blocks_.Forget(BlockHash(1)));
+
+    const auto block = BlockHash(2);
+
+    {
+        auto writer = common_.BlockStore(block, size_);
+
+        ASSERT_TRUE(writer.get().valid(size_));
+
+        std::memset(writer.get().data(), 0x01, size_);
+    }
+
+    EXPECT_TRUE(common_.BlockExists(block));
+    EXPECT_EQ(blocks_.Size(block), size_);
+    EXPECT_TRUE(blocks_.Forget(block));
+    EXPECT_FALSE(common_.BlockExists(block));
+    EXPECT_EQ(blocks_.Size(block), 0u);
+    EXPECT_FALSE(blocks_.LoadBitcoin(block));
+    EXPECT_TRUE(blocks_.Forget(block));
+}
+}  // namespace ottest
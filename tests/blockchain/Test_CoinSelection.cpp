@@ -0,0 +1,165 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <opentxs/opentxs.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+
+#include "blockchain/node/CoinSelection.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+using Selector = ot::blockchain::node::CoinSelection;
+using Candidates = Selector::Candidates;
+using Selection = Selector::Selection;
+
+auto make_candidates(std::size_t count, std::int64_t fee) noexcept
+    -> Candidates
+{
+    auto output = Candidates{};
+
+    for (auto i = std::size_t{0}; i < count; ++i) {
+        const auto value = static_cast<std::int64_t>((i + 1u) * 1000u);
+        output.push_back({i, value, value - fee});
+    }
+
+    return output;
+}
+
+// NOTE every effective value is a multiple of 1000 so no set can land within
+// less than 1000 above a target which is one more than a multiple of 1000,
+// which forces Select past branch and bound to the fallback strategies
+auto make_rounded(std::size_t count, std::int64_t fee) noexcept -> Candidates
+{
+    auto rng = std::mt19937_64{count};
+    auto output = Candidates{};
+
+    for (auto i = std::size_t{0}; i < count; ++i) {
+        const auto effective = static_cast<std::int64_t>(
+            1000u * (1u + (rng() % 10u)));
+        output.push_back({i, effective + fee, effective});
+    }
+
+    return output;
+}
+
+auto total(const Candidates& candidates, const Selection& selection) noexcept
+    -> std::int64_t
+{
+    auto output = std::int64_t{0};
+
+    for (const auto i : selection) { output += candidates.at(i).effective_; }
+
+    return output;
+}
+
+TEST(Test_CoinSelection, empty)
+{
+    const auto selector = Selector{{}};
+
+    EXPECT_EQ(selector.Count(), 0u);
+    EXPECT_FALSE(selector.Select(1, 0).has_value());
+}
+
+TEST(Test_CoinSelection, uneconomical)
+{
+    const auto candidates = Candidates{{0, 100, -48}, {1, 1000, 852}};
+    const auto selector = Selector{candidates};
+
+    EXPECT_EQ(selector.Count(), 1u);
+    EXPECT_EQ(selector.Total(), 852);
+
+    const auto selection = selector.Select(500, 0);
+
+    ASSERT_TRUE(selection.has_value());
+    ASSERT_EQ(selection->size(), 1u);
+    EXPECT_EQ(selection->front(), 1u);
+}
+
+TEST(Test_CoinSelection, insufficient)
+{
+    const auto candidates = make_candidates(10, 0);
+    const auto selector = Selector{candidates};
+
+    EXPECT_EQ(selector.Total(), 55000);
+    EXPECT_FALSE(selector.Select(55001, 0).has_value());
+
+    const auto selection = selector.Select(55000, 0);
+
+    ASSERT_TRUE(selection.has_value());
+    EXPECT_EQ(selection->size(), 10u);
+}
+
+TEST(Test_CoinSelection, exact_match)
+{
+    const auto candidates = make_candidates(10, 0);
+    const auto selection = Selector{candidates}.Select(7000, 0);
+
+    ASSERT_TRUE(selection.has_value());
+    EXPECT_EQ(total(candidates, *selection), 7000);
+    EXPECT_EQ(selection->size(), 1u);
+}
+
+TEST(Test_CoinSelection, no_change)
+{
+    const auto candidates = make_candidates(10, 0);
+    const auto selection = Selector{candidates}.Select(7500, 600);
+
+    ASSERT_TRUE(selection.has_value());
+
+    const auto value = total(candidates, *selection);
+
+    EXPECT_GE(value, 7500);
+    EXPECT_LE(value, 8100);
+}
+
+TEST(Test_CoinSelection, fee_rate)
+{
+    const auto candidates = make_candidates(10, 148);
+    const auto selection = Selector{candidates}.Select(9000, 0);
+
+    ASSERT_TRUE(selection.has_value());
+
+    const auto fees = static_cast<std::int64_t>(148u * selection->size());
+    auto value = std::int64_t{0};
+
+    for (const auto i : *selection) { value += candidates.at(i).value_; }
+
+    EXPECT_GE(value, 9000 + fees);
+}
+
+TEST(Test_CoinSelection, knapsack)
+{
+    constexpr auto change = std::int64_t{600};
+    const auto candidates = make_rounded(500, 137);
+    const auto selector = Selector{candidates};
+    const auto target = ((selector.Total() / 3) / 1000) * 1000 + 1;
+    const auto selection = selector.Select(target, change);
+
+    ASSERT_TRUE(selection.has_value());
+    EXPECT_GE(total(candidates, *selection), target + change);
+}
+
+TEST(Test_CoinSelection, largest_first)
+{
+    constexpr auto count = std::size_t{50000};
+    constexpr auto change = std::int64_t{600};
+
+    static_assert(Selector::knapsack_limit_ < count);
+
+    const auto candidates = make_rounded(count, 500);
+    const auto selector = Selector{candidates};
+    const auto target = ((selector.Total() / 10) / 1000) * 1000 + 1;
+    const auto selection = selector.Select(target, change);
+
+    ASSERT_TRUE(selection.has_value());
+    EXPECT_GE(total(candidates, *selection), target + change);
+    EXPECT_LT(selection->size(), count / 10u);
+}
+}  // namespace ottest
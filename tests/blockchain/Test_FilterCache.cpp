@@ -0,0 +1,162 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <opentxs/opentxs.hpp>
+#include <array>
+#include <cstddef>
+#include <cstring>
+
+#include "blockchain/node/filteroracle/FilterCache.hpp"
+#include "internal/blockchain/Blockchain.hpp"
+#include "internal/blockchain/bitcoin/cfilter/GCS.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+using Cache = ot::blockchain::node::filteroracle::FilterCache;
+
+class Test_FilterCache : public ::testing::Test
+{
+public:
+    static constexpr auto count_ = std::size_t{4};
+
+    const ot::api::session::Client& api_;
+    const ot::Vector<ot::blockchain::block::Hash> blocks_;
+    const ot::Vector<ot::blockchain::GCS> filters_;
+
+    static auto size(const ot::blockchain::GCS& filter) noexcept
+        -> std::size_t
+    {
+        return filter.Internal().CalculateSize();
+    }
+
+    Test_FilterCache()
+        : api_(ot::Context().StartClientSession(0))
+        , blocks_([] {
+            auto out = ot::Vector<ot::blockchain::block::Hash>{};
+
+            for (auto i = std::size_t{0}; i < count_; ++i) {
+                auto bytes = std::array<std::byte, 32>{};
+                std::memcpy(bytes.data(), &i, sizeof(i));
+                out.emplace_back(ot::ReadView{
+                    reinterpret_cast<const char*>(bytes.data()),
+                    bytes.size()});
+            }
+
+            return out;
+        }())
+        , filters_([&] {
+            const auto params = ot::blockchain::internal::GetFilterParams(
+                ot::blockchain::cfilter::Type::Basic_BIP158);
+            auto out = ot::Vector<ot::blockchain::GCS>{};
+
+            for (const auto& block : blocks_) {
+                auto elements = ot::Vector<ot::OTData>{};
+
+                for (auto i = std::size_t{0}; i < 16; ++i) {
+                    elements.emplace_back(api_.Factory().DataFromBytes(
+                        block.Bytes()));
+                    elements.back()->Concatenate(&i, sizeof(i));
+                }
+
+                out.emplace_back(ot::factory::GCS(
+                    api_,
+                    params.first,
+                    params.second,
+                    ot::blockchain::internal::BlockHashToFilterKey(
+                        block.Bytes()),
+                    elements,
+                    {}));
+            }
+
+            return out;
+        }())
+    {
+    }
+};
+
+TEST_F(Test_FilterCache, hit_miss_accounting)
+{
+    auto cache = Cache{1024 * 1024, {}};
+
+    for (const auto& filter : filters_) { ASSERT_TRUE(filter.IsValid()); }
+
+    EXPECT_FALSE(cache.find(blocks_[0], {}).IsValid());
+    EXPECT_EQ(cache.Stats().hits_, 0u);
+    EXPECT_EQ(cache.Stats().misses_, 1u);
+
+    cache.push(blocks_[0], filters_[0]);
+
+    // NOTE inserting a filter is not a lookup and must not count as a miss
+    EXPECT_EQ(cache.Stats().misses_, 1u);
+    EXPECT_EQ(cache.Stats().count_, 1u);
+    EXPECT_EQ(cache.Stats().bytes_, size(filters_[0]));
+
+    const auto found = cache.find(blocks_[0], {});
+
+    ASSERT_TRUE(found.IsValid());
+    EXPECT_EQ(found.Hash(), filters_[0].Hash());
+    EXPECT_EQ(cache.Stats().hits_, 1u);
+    EXPECT_EQ(cache.Stats().misses_, 1u);
+
+    EXPECT_FALSE(cache.find(blocks_[1], {}).IsValid());
+    EXPECT_EQ(cache.Stats().hits_, 1u);
+    EXPECT_EQ(cache.Stats().misses_, 2u);
+
+    cache.push(blocks_[0], filters_[0]);
+
+    EXPECT_EQ(cache.Stats().count_, 1u);
+    EXPECT_EQ(cache.Stats().bytes_, size(filters_[0]));
+
+    cache.push(blocks_[1], ot::blockchain::GCS{});
+
+    EXPECT_FALSE(cache.contains(blocks_[1]));
+    EXPECT_EQ(cache.Stats().count_, 1u);
+}
+
+TEST_F(Test_FilterCache, lru_eviction_by_bytes)
+{
+    const auto limit =
+        size(filters_[0]) + size(filters_[1]) + size(filters_[2]);
+    auto cache = Cache{limit, {}};
+
+    for (auto i = std::size_t{0}; i < 3; ++i) {
+        cache.push(blocks_[i], filters_[i]);
+    }
+
+    EXPECT_EQ(cache.Stats().count_, 3u);
+    EXPECT_EQ(cache.Stats().bytes_, limit);
+
+    // NOTE touching the oldest entry makes blocks_[1] the eviction candidate
+    EXPECT_TRUE(cache.find(blocks_[0], {}).IsValid());
+
+    cache.push(blocks_[3], filters_[3]);
+
+    EXPECT_TRUE(cache.contains(blocks_[0]));
+    EXPECT_FALSE(cache.contains(blocks_[1]));
+    EXPECT_TRUE(cache.contains(blocks_[3]));
+    EXPECT_LE(cache.Stats().bytes_, limit);
+
+    auto expected = std::size_t{0};
+
+    for (auto i = std::size_t{0}; i < count_; ++i) {
+        if (cache.contains(blocks_[i])) { expected += size(filters_[i]); }
+    }
+
+    EXPECT_EQ(cache.Stats().bytes_, expected);
+}
+
+TEST_F(Test_FilterCache, oversized_filter)
+{
+    auto cache = Cache{size(filters_[0]) - 1, {}};
+    cache.push(blocks_[0], filters_[0]);
+
+    EXPECT_FALSE(cache.contains(blocks_[0]));
+    EXPECT_EQ(cache.Stats().count_, 0u);
+    EXPECT_EQ(cache.Stats().bytes_, 0u);
+}
+}  // namespace ottest
@@ -0,0 +1,170 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <opentxs/opentxs.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <thread>
+#include <utility>
+
+#include "blockchain/bitcoin/cfilter/GCS.hpp"
+#include "blockchain/node/filteroracle/Matcher.hpp"
+#include "internal/blockchain/bitcoin/cfilter/GCS.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+using namespace std::literals::chrono_literals;
+using Matcher = ot::blockchain::node::filteroracle::Matcher;
+using Sets = Matcher::Sets;
+using Results = Matcher::Results;
+using Hashes = ot::blockchain::gcs::Hashes;
+
+// NOTE matches every target and records the shape of each pass. The first
+// pass blocks until the test releases it so that other requests for the same
+// filter are forced to queue behind it.
+class MockFilter final : public ot::blockchain::GCS::Imp
+{
+public:
+    mutable std::atomic<std::size_t> passes_;
+    mutable std::atomic<std::size_t> last_batch_;
+    mutable std::promise<void> started_;
+    std::shared_future<void> gate_;
+
+    auto IsValid() const noexcept -> bool final { return true; }
+    auto Match(const PrehashedSets& sets, allocator_type alloc) const noexcept
+        -> ot::Vector<PrehashedMatches> final
+    {
+        if (0u == passes_++) {
+            started_.set_value();
+            gate_.wait();
+        }
+
+        last_batch_.store(sets.size());
+        auto out = ot::Vector<PrehashedMatches>{alloc};
+
+        for (const auto* set : sets) {
+            auto& matches = out.emplace_back();
+
+            for (auto i = set->cbegin(); i != set->cend(); ++i) {
+                matches.emplace_back(i);
+            }
+        }
+
+        return out;
+    }
+
+    MockFilter(std::shared_future<void> gate) noexcept
+        : Imp({})
+        , passes_(0)
+        , last_batch_(0)
+        , started_()
+        , gate_(std::move(gate))
+    {
+    }
+};
+
+class Test_FilterMatcher : public ::testing::Test
+{
+public:
+    const ot::blockchain::block::Hash block_;
+    const Hashes a_;
+    const Hashes b_;
+    const Hashes c_;
+    const Hashes d_;
+    std::promise<void> release_;
+    MockFilter* mock_;
+    const ot::blockchain::GCS filter_;
+    const Matcher matcher_;
+
+    static auto check(const Results& results, const Hashes& targets) noexcept
+        -> void
+    {
+        ASSERT_EQ(results.size(), 1u);
+
+        const auto& matches = results.front();
+
+        ASSERT_EQ(matches.size(), targets.size());
+
+        auto expected = targets.cbegin();
+
+        for (const auto& match : matches) { EXPECT_EQ(match, expected++); }
+    }
+
+    auto match(const Hashes& targets, ot::blockchain::cfilter::Type type)
+        const noexcept -> std::future<Results>
+    {
+        return std::async(std::launch::async, [this, &targets, type] {
+            return matcher_.Match(type, block_, filter_, Sets{&targets});
+        });
+    }
+
+    Test_FilterMatcher()
+        : block_()
+        , a_{1, 2, 3}
+        , b_{4, 5}
+        , c_{6}
+        , d_{7, 8, 9, 10}
+        , release_()
+        , mock_(new MockFilter{release_.get_future().share()})
+        , filter_(mock_)
+        , matcher_()
+    {
+    }
+};
+
+TEST_F(Test_FilterMatcher, combine_queued_requests)
+{
+    using Type = ot::blockchain::cfilter::Type;
+    auto started = mock_->started_.get_future();
+    auto first = match(a_, Type::Basic_BIP158);
+
+    ASSERT_EQ(started.wait_for(10s), std::future_status::ready);
+
+    auto second = match(b_, Type::Basic_BIP158);
+    auto third = match(c_, Type::Basic_BIP158);
+    // NOTE requests for a different filter type must not wait for the pass
+    // which is in progress
+    auto other = match(d_, Type::ES);
+
+    ASSERT_EQ(other.wait_for(10s), std::future_status::ready);
+
+    check(other.get(), d_);
+
+    EXPECT_EQ(mock_->passes_.load(), 2u);
+    EXPECT_EQ(mock_->last_batch_.load(), 1u);
+
+    // NOTE give the queued requests time to register before the first pass
+    // is released
+    std::this_thread::sleep_for(250ms);
+
+    EXPECT_EQ(second.wait_for(0s), std::future_status::timeout);
+    EXPECT_EQ(third.wait_for(0s), std::future_status::timeout);
+
+    release_.set_value();
+    check(first.get(), a_);
+    check(second.get(), b_);
+    check(third.get(), c_);
+
+    EXPECT_EQ(mock_->passes_.load(), 3u);
+    EXPECT_EQ(mock_->last_batch_.load(), 2u);
+}
+
+TEST_F(Test_FilterMatcher, sequential_requests)
+{
+    using Type = ot::blockchain::cfilter::Type;
+    release_.set_value();
+
+    check(matcher_.Match(Type::Basic_BIP158, block_, filter_, Sets{&a_}), a_);
+    check(matcher_.Match(Type::Basic_BIP158, block_, filter_, Sets{&b_}), b_);
+
+    EXPECT_EQ(mock_->passes_.load(), 2u);
+    EXPECT_EQ(mock_->last_batch_.load(), 1u);
+}
+}  // namespace ottest
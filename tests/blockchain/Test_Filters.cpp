@@ -10,6 +10,7 @@
 #include <cstdint>
 #include <cstdlib>
 #include <iterator>
+#include <stdexcept>
 #include <string_view>
 #include <utility>
 
@@ -343,6 +344,82 @@ TEST_F(Test_Filters, golomb_coding)
     }
 }
 
+TEST_F(Test_Filters, golomb_decode_bitreader)
+{
+    const auto P = std::uint8_t{19};
+    const auto N = std::uint32_t{1000};
+    const auto elements = [&] {
+        auto out = ot::Vector<std::uint64_t>{};
+        auto last = std::uint64_t{0};
+
+        for (auto i = 0_uz; i < N; ++i) {
+            // NOLINTNEXTLINE(cert-msc30-c,cert-msc50-cpp)
+            last += 1u + (static_cast<std::uint64_t>(rand()) % (1u << 22u));
+            out.emplace_back(last);
+        }
+
+        return out;
+    }();
+    const auto encoded = ot::gcs::GolombEncode(P, elements, {});
+    const auto check = [&](const auto& bytes, const auto count) {
+        auto stream = ot::blockchain::internal::BitReader{bytes};
+        auto last = std::uint64_t{0};
+        const auto decoded = ot::gcs::GolombDecode(count, P, bytes, {});
+
+        ASSERT_EQ(decoded.size(), count);
+
+        for (auto i = 0_uz; i < count; ++i) {
+            auto quotient = std::uint64_t{0};
+
+            while (1 == stream.read(1)) { ++quotient; }
+
+            last += (quotient << P) + stream.read(P);
+
+            EXPECT_EQ(decoded.at(i), last);
+        }
+    };
+
+    check(encoded, N);
+
+    // elements past the end of a truncated filter must decode identically
+    const auto truncated = ot::Vector<std::byte>{
+        encoded.begin(), std::next(encoded.begin(), encoded.size() / 2)};
+    check(truncated, N);
+}
+
+TEST_F(Test_Filters, golomb_intersect)
+{
+    const auto elements = ot::Vector<std::uint64_t>{2, 3, 5, 8, 13, 21, 34};
+    const auto N = static_cast<std::uint32_t>(elements.size());
+    const auto P = std::uint8_t{19};
+    const auto encoded = ot::gcs::GolombEncode(P, elements, {});
+    const auto targets = ot::Vector<std::uint64_t>{1, 3, 4, 13, 33, 34, 35};
+    const auto expected = ot::Vector<std::uint64_t>{3, 13, 34};
+
+    {
+        auto matches = ot::Vector<std::uint64_t>{};
+        ot::gcs::GolombIntersect(N, P, encoded, targets, false, matches);
+
+        EXPECT_EQ(matches, expected);
+    }
+
+    {
+        auto matches = ot::Vector<std::uint64_t>{};
+        ot::gcs::GolombIntersect(N, P, encoded, targets, true, matches);
+
+        ASSERT_EQ(matches.size(), 1);
+        EXPECT_EQ(matches.front(), expected.front());
+    }
+
+    {
+        const auto none = ot::Vector<std::uint64_t>{0, 1, 4, 40};
+        auto matches = ot::Vector<std::uint64_t>{};
+        ot::gcs::GolombIntersect(N, P, encoded, none, false, matches);
+
+        EXPECT_EQ(matches.size(), 0);
+    }
+}
+
 TEST_F(Test_Filters, gcs)
 {
     const auto s1 = ot::UnallocatedCString{"blah"};
@@ -389,6 +466,109 @@ TEST_F(Test_Filters, gcs)
     }
 }
 
+TEST_F(Test_Filters, gcs_prehashed_batch)
+{
+    const auto make = [](const auto& value) {
+        return ot::Data::Factory(value.data(), value.size());
+    };
+    const auto included = ot::Vector<ot::OTData>{
+        make(std::string_view{"blah"}),
+        make(std::string_view{"foo"}),
+        make(std::string_view{"justus"}),
+        make(std::string_view{"fellowtraveler"})};
+    const auto excluded = ot::Vector<ot::OTData>{
+        make(std::string_view{"islajames"}),
+        make(std::string_view{"timewaitsfornoman"})};
+    const auto key = ot::UnallocatedCString{"0123456789abcdef"};
+    const auto gcs = ot::factory::GCS(
+        api_, params_.first, params_.second, key, included, {});
+
+    ASSERT_TRUE(gcs.IsValid());
+
+    const auto hash = [&](const auto& items) {
+        auto out = ot::gcs::Hashes{};
+
+        for (const auto& item : items) {
+            out.emplace_back(ot::gcs::Siphash(api_, key, item->Bytes()));
+        }
+
+        std::sort(out.begin(), out.end());
+
+        return out;
+    };
+    const auto set1 = hash(ot::Vector<ot::OTData>{
+        included.at(0), excluded.at(0), included.at(3)});
+    const auto set2 = hash(excluded);
+    const auto set3 = hash(included);
+    const auto empty = ot::gcs::Hashes{};
+    const auto sets = ot::blockchain::internal::GCS::PrehashedSets{
+        &set1, &set2, &empty, &set3};
+    const auto& internal = gcs.Internal();
+    const auto batch = internal.Match(sets, {});
+
+    ASSERT_EQ(batch.size(), sets.size());
+
+    for (auto i = 0_uz; i < sets.size(); ++i) {
+        auto expected = internal.Match(*sets.at(i));
+        auto actual = batch.at(i);
+        const auto compare = [](const auto& lhs, const auto& rhs) {
+            return *lhs < *rhs;
+        };
+        std::sort(expected.begin(), expected.end(), compare);
+        std::sort(actual.begin(), actual.end(), compare);
+
+        EXPECT_EQ(actual, expected);
+    }
+
+    EXPECT_EQ(batch.at(0).size(), 2);
+    EXPECT_EQ(batch.at(1).size(), 0);
+    EXPECT_EQ(batch.at(2).size(), 0);
+    EXPECT_EQ(batch.at(3).size(), included.size());
+}
+
+TEST_F(Test_Filters, siphash_batch)
+{
+    auto key = ot::UnallocatedCString{};
+    auto message = ot::UnallocatedCString{};
+
+    for (auto i = 0; i < 16; ++i) { key.push_back(static_cast<char>(i)); }
+
+    for (auto i = 0; i < 64; ++i) { message.push_back(static_cast<char>(i)); }
+
+    auto items = ot::blockchain::GCS::Targets{};
+
+    for (auto i = 0_uz; i < message.size(); ++i) {
+        items.emplace_back(message.data(), i);
+    }
+
+    // NOTE add runs of equal length items so every lane is exercised
+    for (auto i = 0_uz; i < 4_uz * 9_uz; ++i) {
+        items.emplace_back(std::next(message.data(), i % 16), 20_uz + (i / 4));
+    }
+
+    const auto hashes = ot::gcs::Siphash(key, items, {});
+
+    ASSERT_EQ(hashes.size(), items.size());
+    // test vectors from the SipHash reference implementation
+    EXPECT_EQ(hashes.at(0), 0x726fdb47dd0e0e31);
+    EXPECT_EQ(hashes.at(15), 0xa129ca6149be45e5);
+    EXPECT_EQ(hashes.at(63), 0x958a324ceb064572);
+
+    for (auto i = 0_uz; i < items.size(); ++i) {
+        EXPECT_EQ(hashes.at(i), ot::gcs::Siphash(api_, key, items.at(i)));
+    }
+
+    const auto range = ot::gcs::Range{784931};
+    const auto elements = ot::gcs::HashToRange(range, hashes, {});
+
+    ASSERT_EQ(elements.size(), hashes.size());
+
+    for (auto i = 0_uz; i < hashes.size(); ++i) {
+        EXPECT_EQ(elements.at(i), ot::gcs::HashToRange(range, hashes.at(i)));
+        EXPECT_LT(elements.at(i), range);
+    }
+}
+
 TEST_F(Test_Filters, bip158_case_0) { EXPECT_TRUE(TestGCSBlock(0)); }
 
 TEST_F(Test_Filters, bip158_case_49291) { EXPECT_TRUE(TestGCSBlock(49291)); }
@@ -476,6 +656,61 @@ TEST_F(Test_Filters, bip158_headers)
     EXPECT_EQ(calculated_a, expected_3.get());
 }
 
+TEST_F(Test_Filters, bip158_headers_batch)
+{
+    namespace bc = ot::blockchain::internal;
+    using namespace std::literals;
+
+    const auto filters = ot::UnallocatedVector<ot::OTData>{
+        api_.Factory().DataFromHex("0x019dfca8"),
+        api_.Factory().DataFromHex("0x015d5000"),
+        api_.Factory().DataFromHex("0x0174a170"),
+        api_.Factory().DataFromHex("0x016cf7a0"),
+    };
+    const auto expected = ot::UnallocatedVector<ot::OTData>{
+        api_.Factory().DataFromHex("0x50b781aed7b7129012a6d20e2d040027937f3af"
+                                   "faee573779908ebb779455821"),
+        api_.Factory().DataFromHex("0xe14fc288fdbf3c8d84f31bfc45892e44a0f152e"
+                                   "82c0ddd1a5b749da513acbdd7"),
+        api_.Factory().DataFromHex("0xf06c381b7d46b1f8df603de51f25fda128dff8c"
+                                   "be8f204357e5e2bef11fd6a18"),
+        api_.Factory().DataFromHex("0x2a9d721212af044cec24f188631cff7b516fb15"
+                                   "76a31d2b67c25b75adfaa638d"),
+    };
+    auto views = ot::Vector<ot::ReadView>{};
+
+    for (const auto& filter : filters) { views.emplace_back(filter->Bytes()); }
+
+    const auto hashes = bc::FiltersToHashes(api_, views, {});
+
+    ASSERT_EQ(hashes.size(), filters.size());
+
+    for (auto i = 0_uz; i < filters.size(); ++i) {
+        EXPECT_EQ(hashes[i], bc::FilterToHash(api_, filters[i]->Bytes()));
+    }
+
+    const auto headers = bc::FilterHashesToHeaders(api_, hashes, {}, {});
+
+    ASSERT_EQ(headers.size(), expected.size());
+
+    for (auto i = 0_uz; i < expected.size(); ++i) {
+        EXPECT_EQ(headers[i], expected[i].get());
+    }
+
+    const auto tail = ot::Vector<ot::blockchain::cfilter::Hash>{
+        std::next(hashes.begin(), 2), hashes.end()};
+    const auto resumed =
+        bc::FilterHashesToHeaders(api_, tail, expected[1]->Bytes(), {});
+
+    ASSERT_EQ(resumed.size(), 2u);
+    EXPECT_EQ(resumed[0], expected[2].get());
+    EXPECT_EQ(resumed[1], expected[3].get());
+    EXPECT_TRUE(bc::FilterHashesToHeaders(api_, {}, {}, {}).empty());
+    EXPECT_THROW(
+        bc::FilterHashesToHeaders(api_, hashes, "short"sv, {}),
+        std::invalid_argument);
+}
+
 TEST_F(Test_Filters, hash)
 {
     namespace bc = ot::blockchain::internal;
@@ -0,0 +1,297 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+extern "C" {
+#include <lmdb.h>
+}
+
+#include <gtest/gtest.h>
+#include <opentxs/opentxs.hpp>
+#include <cstddef>
+#include <cstring>
+#include <optional>
+#include <utility>
+
+#include "blockchain/database/common/Database.hpp"
+#include "internal/api/network/Blockchain.hpp"
+#include "util/LMDB.hpp"
+#include "util/MappedFileStorage.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+using IndexData = ot::util::IndexData;
+using LMDB = ot::storage::lmdb::LMDB;
+
+class Storage final : public ot::util::MappedFileStorage
+{
+public:
+    static constexpr auto config_ = 0;
+    static constexpr auto free_ = 1;
+
+    using MappedFileStorage::free_bytes;
+    using MappedFileStorage::get_read_view;
+    using MappedFileStorage::lowest_free;
+    using MappedFileStorage::used_bytes;
+
+    auto Read(const IndexData& index) const noexcept -> std::byte
+    {
+        const auto view = get_read_view(index);
+
+        if (view.empty()) { return {}; }
+
+        return static_cast<std::byte>(view.front());
+    }
+    auto Relocate(IndexData& index) const noexcept -> bool
+    {
+        auto tx = lmdb_.TransactionRW();
+
+        if (false == relocate(tx, index, {})) { return false; }
+
+        return tx.Finalize(true);
+    }
+    auto Release(const IndexData& index, bool commit = true) const noexcept
+        -> bool
+    {
+        auto tx = lmdb_.TransactionRW();
+        release(tx, index);
+
+        return tx.Finalize(commit);
+    }
+    auto Trim() const noexcept -> std::size_t
+    {
+        auto tx = lmdb_.TransactionRW();
+
+        return trim(tx);
+    }
+    // NOTE fills the item with a single value so that it can be recognized
+    // after it is moved
+    auto Write(IndexData& index, std::size_t bytes, std::byte value)
+        const noexcept -> bool
+    {
+        auto tx = lmdb_.TransactionRW();
+        auto view = get_write_view(tx, index, bytes);
+
+        if (false == view.valid(bytes)) { return false; }
+
+        std::memset(view.data(), std::to_integer<int>(value), bytes);
+
+        return tx.Finalize(true);
+    }
+
+    Storage(LMDB& lmdb, const ot::UnallocatedCString& path) noexcept(false)
+        : MappedFileStorage(lmdb, path, "test", config_, 0, free_)
+    {
+    }
+};
+
+class Test_MappedFileStorage : public ::testing::Test
+{
+public:
+    const ot::api::session::Client& api_;
+    const ot::UnallocatedCString folder_;
+    LMDB lmdb_;
+    std::optional<Storage> storage_;
+
+    auto get() noexcept -> Storage& { return storage_.value(); }
+    auto restart() noexcept -> void
+    {
+        storage_.reset();
+        storage_.emplace(lmdb_, folder_);
+    }
+
+    Test_MappedFileStorage()
+        : api_(ot::Context().StartClientSession(0))
+        , folder_(api_.Network()
+                      .Blockchain()
+                      .Internal()
+                      .Database()
+                      .AllocateStorageFolder(
+                          ot::UnallocatedCString{"mapped_file_"} +
+                          ::testing::UnitTest::GetInstance()
+                              ->current_test_info()
+                              ->name()))
+        , lmdb_(
+              {{Storage::config_, "config"}, {Storage::free_, "free"}},
+              folder_,
+              {{Storage::config_, MDB_INTEGERKEY},
+               {Storage::free_, MDB_INTEGERKEY}},
+              0)
+        , storage_(std::in_place, lmdb_, folder_)
+    {
+    }
+};
+
+TEST_F(Test_MappedFileStorage, append)
+{
+    auto& storage = get();
+    auto a = IndexData{};
+    auto b = IndexData{};
+
+    ASSERT_TRUE(storage.Write(a, 100, std::byte{0x01}));
+    ASSERT_TRUE(storage.Write(b, 200, std::byte{0x02}));
+
+    EXPECT_EQ(a.position_, 0u);
+    EXPECT_EQ(a.size_, 100u);
+    EXPECT_EQ(b.position_, 100u);
+    EXPECT_EQ(b.size_, 200u);
+    EXPECT_EQ(storage.used_bytes(), 300u);
+    EXPECT_EQ(storage.free_bytes(), 0u);
+    EXPECT_FALSE(storage.lowest_free().has_value());
+    EXPECT_EQ(storage.Read(a), std::byte{0x01});
+    EXPECT_EQ(storage.Read(b), std::byte{0x02});
+
+    // NOTE an item of the same size is replaced in place
+    ASSERT_TRUE(storage.Write(a, 100, std::byte{0x03}));
+
+    EXPECT_EQ(a.position_, 0u);
+    EXPECT_EQ(storage.used_bytes(), 300u);
+    EXPECT_EQ(storage.Read(a), std::byte{0x03});
+}
+
+TEST_F(Test_MappedFileStorage, free_and_merge)
+{
+    auto& storage = get();
+    auto items = ot::UnallocatedVector<IndexData>(4);
+
+    for (auto& item : items) {
+        ASSERT_TRUE(storage.Write(item, 100, std::byte{0x01}));
+    }
+
+    // NOTE space freed by an aborted transaction is not reused
+    ASSERT_TRUE(storage.Release(items[1], false));
+
+    EXPECT_EQ(storage.free_bytes(), 0u);
+
+    ASSERT_TRUE(storage.Release(items[1]));
+
+    EXPECT_EQ(storage.free_bytes(), 100u);
+
+    ASSERT_TRUE(storage.Release(items[2]));
+
+    EXPECT_EQ(storage.free_bytes(), 200u);
+
+    const auto merged = storage.lowest_free();
+
+    ASSERT_TRUE(merged.has_value());
+    EXPECT_EQ(merged->position_, 100u);
+    EXPECT_EQ(merged->size_, 200u);
+
+    ASSERT_TRUE(storage.Release(items[0]));
+
+    const auto all = storage.lowest_free();
+
+    ASSERT_TRUE(all.has_value());
+    EXPECT_EQ(all->position_, 0u);
+    EXPECT_EQ(all->size_, 300u);
+    EXPECT_EQ(storage.free_bytes(), 300u);
+
+    // NOTE free extents are reloaded from the database
+    restart();
+
+    EXPECT_EQ(get().free_bytes(), 300u);
+    EXPECT_EQ(get().used_bytes(), 400u);
+}
+
+TEST_F(Test_MappedFileStorage, allocate)
+{
+    auto& storage = get();
+    auto a = IndexData{};
+    auto b = IndexData{};
+    auto c = IndexData{};
+    auto d = IndexData{};
+
+    ASSERT_TRUE(storage.Write(a, 200, std::byte{0x01}));
+    ASSERT_TRUE(storage.Write(b, 100, std::byte{0x02}));
+    ASSERT_TRUE(storage.Write(c, 100, std::byte{0x03}));
+    ASSERT_TRUE(storage.Write(d, 100, std::byte{0x04}));
+    ASSERT_TRUE(storage.Release(a));
+    ASSERT_TRUE(storage.Release(c));
+
+    // NOTE the smallest sufficient extent is used first
+    auto e = IndexData{};
+
+    ASSERT_TRUE(storage.Write(e, 100, std::byte{0x05}));
+
+    EXPECT_EQ(e.position_, 300u);
+    EXPECT_EQ(storage.free_bytes(), 200u);
+
+    // NOTE the remainder of a larger extent is kept if it is large enough to
+    // be worth tracking
+    auto f = IndexData{};
+
+    ASSERT_TRUE(storage.Write(f, 120, std::byte{0x06}));
+
+    EXPECT_EQ(f.position_, 0u);
+    EXPECT_EQ(storage.free_bytes(), 80u);
+
+    const auto rest = storage.lowest_free();
+
+    ASSERT_TRUE(rest.has_value());
+    EXPECT_EQ(rest->position_, 120u);
+    EXPECT_EQ(rest->size_, 80u);
+
+    // NOTE items which do not fit in any extent are appended
+    auto g = IndexData{};
+
+    ASSERT_TRUE(storage.Write(g, 100, std::byte{0x07}));
+
+    EXPECT_EQ(g.position_, 500u);
+    EXPECT_EQ(storage.used_bytes(), 600u);
+
+    // NOTE replacing an item with a different size frees the old space. The
+    // remainder of the extent it was moved into is too small to keep.
+    ASSERT_TRUE(storage.Write(b, 50, std::byte{0x08}));
+
+    EXPECT_EQ(b.position_, 120u);
+    EXPECT_EQ(storage.Read(b), std::byte{0x08});
+    EXPECT_EQ(storage.free_bytes(), 100u);
+    EXPECT_EQ(storage.Read(d), std::byte{0x04});
+    EXPECT_EQ(storage.Read(e), std::byte{0x05});
+    EXPECT_EQ(storage.Read(f), std::byte{0x06});
+}
+
+TEST_F(Test_MappedFileStorage, relocate_and_trim)
+{
+    auto& storage = get();
+    auto a = IndexData{};
+    auto b = IndexData{};
+    auto c = IndexData{};
+
+    ASSERT_TRUE(storage.Write(a, 100, std::byte{0x01}));
+    ASSERT_TRUE(storage.Write(b, 100, std::byte{0x02}));
+    ASSERT_TRUE(storage.Write(c, 100, std::byte{0x03}));
+
+    // NOTE there is no free space below any item
+    EXPECT_FALSE(storage.Relocate(c));
+    EXPECT_EQ(storage.Trim(), 0u);
+
+    ASSERT_TRUE(storage.Release(a));
+    ASSERT_TRUE(storage.Relocate(c));
+
+    EXPECT_EQ(c.position_, 0u);
+    EXPECT_EQ(storage.Read(c), std::byte{0x03});
+    EXPECT_EQ(storage.free_bytes(), 100u);
+
+    // NOTE items are never moved further from the start of the file
+    EXPECT_FALSE(storage.Relocate(c));
+    EXPECT_EQ(storage.Trim(), 100u);
+    EXPECT_EQ(storage.used_bytes(), 200u);
+    EXPECT_EQ(storage.free_bytes(), 0u);
+    EXPECT_EQ(storage.Read(b), std::byte{0x02});
+
+    // NOTE the end of the file is persistent
+    restart();
+
+    EXPECT_EQ(get().used_bytes(), 200u);
+
+    auto d = IndexData{};
+
+    ASSERT_TRUE(get().Write(d, 100, std::byte{0x04}));
+
+    EXPECT_EQ(d.position_, 200u);
+}
+}  // namespace ottest
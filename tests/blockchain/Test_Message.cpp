@@ -5,12 +5,15 @@
 
 #include <gtest/gtest.h>
 #include <opentxs/opentxs.hpp>
+#include <cstddef>
 #include <memory>
+#include <string_view>
 #include <utility>
 
 #include "1_Internal.hpp"  // IWYU pragma: keep
 #include "blockchain/bitcoin/p2p/Header.hpp"
 #include "blockchain/bitcoin/p2p/message/Getblocks.hpp"
+#include "internal/blockchain/Blockchain.hpp"
 #include "internal/blockchain/p2p/bitcoin/Bitcoin.hpp"
 #include "internal/blockchain/p2p/bitcoin/Factory.hpp"
 #include "internal/blockchain/p2p/bitcoin/message/Message.hpp"
@@ -139,4 +142,155 @@ TEST_F(Test_Message, getblocks)
         ASSERT_TRUE(pMessage->payload() == pLoadedMsg->payload());
     }
 }
+
+TEST_F(Test_Message, cfilter_serialized)
+{
+    namespace bitcoin = ot::blockchain::p2p::bitcoin;
+    using namespace std::literals;
+
+    const auto chain = ot::blockchain::Type::Bitcoin;
+    const auto type = ot::blockchain::cfilter::Type::Basic_BIP158;
+    const auto params = ot::blockchain::internal::GetFilterParams(type);
+    const auto block = ot::blockchain::block::Hash{};
+    auto elements = ot::Vector<ot::OTData>{};
+
+    for (auto i = 0; i < 100; ++i) {
+        auto& element = elements.emplace_back(ot::Data::Factory());
+        element->Randomize(33);
+    }
+
+    const auto gcs = ot::factory::GCS(
+        api_,
+        params.first,
+        params.second,
+        ot::blockchain::internal::BlockHashToFilterKey(block.Bytes()),
+        elements,
+        {});
+
+    ASSERT_TRUE(gcs.IsValid());
+
+    auto serialized = ot::Space{};
+
+    ASSERT_TRUE(gcs.Encode(ot::writer(serialized)));
+
+    std::unique_ptr<bitcoin::message::internal::Cfilter> pExpected{
+        ot::factory::BitcoinP2PCfilter(api_, chain, type, block, gcs)};
+    std::unique_ptr<bitcoin::message::internal::Cfilter> pMessage{
+        ot::factory::BitcoinP2PCfilter(
+            api_, chain, type, block, ot::reader(serialized))};
+
+    ASSERT_TRUE(pExpected);
+    ASSERT_TRUE(pMessage);
+
+    const auto& expected = *pExpected;
+    const auto& message = *pMessage;
+
+    EXPECT_EQ(message.ElementCount(), gcs.ElementCount());
+    EXPECT_EQ(message.Filter(), expected.Filter());
+    EXPECT_TRUE(message.payload() == expected.payload());
+
+    auto frame = [&] {
+        auto out = opentxs::network::zeromq::Message{};
+        message.header().Serialize(out.AppendBytes());
+
+        return out;
+    }();
+    std::unique_ptr<bitcoin::Header> pHeader{
+        ot::factory::BitcoinP2PHeader(api_, chain, frame.at(0))};
+
+    ASSERT_TRUE(pHeader);
+
+    const auto payload = message.payload();
+    std::unique_ptr<bitcoin::message::internal::Cfilter> pLoaded{
+        ot::factory::BitcoinP2PCfilter(
+            api_,
+            std::move(pHeader),
+            70015,
+            payload->data(),
+            payload->size())};
+
+    ASSERT_TRUE(pLoaded);
+    EXPECT_EQ(pLoaded->ElementCount(), gcs.ElementCount());
+    EXPECT_EQ(pLoaded->Filter(), expected.Filter());
+    EXPECT_TRUE(pLoaded->payload() == expected.payload());
+
+    std::unique_ptr<bitcoin::message::internal::Cfilter> pInvalid{
+        ot::factory::BitcoinP2PCfilter(api_, chain, type, block, ""sv)};
+
+    EXPECT_FALSE(pInvalid);
+}
+
+TEST_F(Test_Message, cfilter_noncanonical)
+{
+    namespace bitcoin = ot::blockchain::p2p::bitcoin;
+
+    const auto chain = ot::blockchain::Type::Bitcoin;
+    const auto type = ot::blockchain::cfilter::Type::Basic_BIP158;
+    const auto params = ot::blockchain::internal::GetFilterParams(type);
+    const auto block = ot::blockchain::block::Hash{};
+    auto elements = ot::Vector<ot::OTData>{};
+
+    for (auto i = 0; i < 100; ++i) {
+        auto& element = elements.emplace_back(ot::Data::Factory());
+        element->Randomize(33);
+    }
+
+    const auto gcs = ot::factory::GCS(
+        api_,
+        params.first,
+        params.second,
+        ot::blockchain::internal::BlockHashToFilterKey(block.Bytes()),
+        elements,
+        {});
+
+    ASSERT_TRUE(gcs.IsValid());
+
+    auto serialized = ot::Space{};
+
+    ASSERT_TRUE(gcs.Encode(ot::writer(serialized)));
+
+    const auto [count, filter] =
+        ot::blockchain::internal::DecodeSerializedCfilter(
+            ot::reader(serialized));
+
+    ASSERT_EQ(count, 100u);
+
+    // NOTE encode the element count with three bytes even though one would do
+    auto nonCanonical =
+        ot::Space{std::byte{0xfd}, std::byte{100}, std::byte{0}};
+    const auto* start = reinterpret_cast<const std::byte*>(filter.data());
+    nonCanonical.insert(nonCanonical.end(), start, start + filter.size());
+
+    std::unique_ptr<bitcoin::message::internal::Cfilter> pMessage{
+        ot::factory::BitcoinP2PCfilter(
+            api_, chain, type, block, ot::reader(nonCanonical))};
+
+    ASSERT_TRUE(pMessage);
+    EXPECT_EQ(pMessage->ElementCount(), count);
+    EXPECT_EQ(pMessage->Filter(), filter);
+
+    auto frame = [&] {
+        auto out = opentxs::network::zeromq::Message{};
+        pMessage->header().Serialize(out.AppendBytes());
+
+        return out;
+    }();
+    std::unique_ptr<bitcoin::Header> pHeader{
+        ot::factory::BitcoinP2PHeader(api_, chain, frame.at(0))};
+
+    ASSERT_TRUE(pHeader);
+
+    const auto payload = pMessage->payload();
+    std::unique_ptr<bitcoin::message::internal::Cfilter> pLoaded{
+        ot::factory::BitcoinP2PCfilter(
+            api_,
+            std::move(pHeader),
+            70015,
+            payload->data(),
+            payload->size())};
+
+    ASSERT_TRUE(pLoaded);
+    EXPECT_EQ(pLoaded->ElementCount(), count);
+    EXPECT_EQ(pLoaded->Filter(), filter);
+}
 }  // namespace ottest
@@ -161,4 +161,32 @@ TEST_F(Test_NumericHash, nBits_5)
     EXPECT_EQ(hex, number->asHex());
     EXPECT_STREQ("1", work->Decimal().c_str());
 }
+
+TEST_F(Test_NumericHash, nBits_overflow)
+{
+    const std::int32_t nBits{587202561};  // 0x23000001
+    const ot::UnallocatedCString hex{
+        "0000000000000000000000000000000000000000000000000000000000000000"};
+
+    const ot::OTNumericHash number{ot::factory::NumericHashNBits(nBits)};
+
+    EXPECT_STREQ("0", number->Decimal().c_str());
+    EXPECT_EQ(hex, number->asHex());
+}
+
+TEST_F(Test_NumericHash, work)
+{
+    const std::int32_t nBits{453248203};  // 0x1b0404cb
+    const ot::OTNumericHash number{ot::factory::NumericHashNBits(nBits)};
+    const auto work = ot::OTWork{
+        ot::factory::Work(ot::blockchain::Type::Bitcoin, number)};
+    const auto restored = ot::OTWork{ot::factory::Work(work->asHex())};
+    const auto sum = work + restored;
+
+    EXPECT_STREQ("16307", work->Decimal().c_str());
+    EXPECT_STREQ("3fb3", work->asHex().c_str());
+    EXPECT_EQ(work, restored);
+    EXPECT_STREQ("32614", sum->Decimal().c_str());
+    EXPECT_TRUE(sum > work);
+}
 }  // namespace ottest
@@ -0,0 +1,258 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+extern "C" {
+#include <lmdb.h>
+}
+
+#include <gtest/gtest.h>
+#include <opentxs/opentxs.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <utility>
+
+#include "1_Internal.hpp"  // IWYU pragma: keep
+#include "blockchain/database/common/Database.hpp"
+#include "blockchain/database/wallet/OutputCache.hpp"
+#include "internal/api/network/Blockchain.hpp"
+#include "internal/blockchain/bitcoin/block/Factory.hpp"
+#include "internal/blockchain/bitcoin/block/Output.hpp"
+#include "internal/blockchain/bitcoin/block/Script.hpp"
+#include "internal/blockchain/database/Types.hpp"
+#include "util/LMDB.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+namespace db = ot::blockchain::database;
+
+using Balance = ot::blockchain::Balance;
+using Key = ot::blockchain::crypto::Key;
+using OutputCache = db::wallet::OutputCache;
+using Outpoint = ot::blockchain::block::Outpoint;
+using Outpoints = db::wallet::Outpoints;
+using State = ot::blockchain::node::TxoState;
+using Subchain = ot::blockchain::crypto::Subchain;
+
+class Test_OutputCache : public ::testing::Test
+{
+public:
+    static constexpr auto chain_ = ot::blockchain::Type::UnitTest;
+
+    const ot::api::session::Client& api_;
+    const db::common::Database& common_;
+    const ot::blockchain::block::Position blank_;
+    ot::storage::lmdb::LMDB lmdb_;
+    OutputCache cache_;
+
+    static auto outpoint(std::uint32_t index) noexcept -> Outpoint
+    {
+        auto txid = std::array<std::byte, 32>{};
+        std::memcpy(txid.data(), &index, sizeof(index));
+
+        return {
+            ot::ReadView{
+                reinterpret_cast<const char*>(txid.data()), txid.size()},
+            index};
+    }
+
+    // NOTE the balance as it was computed before running totals were kept:
+    // every output in the relevant states, optionally restricted to an index
+    auto fold(const Outpoints* filter) const noexcept -> Balance
+    {
+        const auto total = [&](State state) {
+            auto out = ot::Amount{0};
+
+            for (const auto& id : cache_.GetState(state)) {
+                if ((nullptr != filter) && (0u == filter->count(id))) {
+                    continue;
+                }
+
+                out += cache_.GetOutput(id).Value();
+            }
+
+            return out;
+        };
+        const auto confirmedNew = total(State::ConfirmedNew);
+        const auto unconfirmedNew = total(State::UnconfirmedNew);
+        const auto unconfirmedSpend = total(State::UnconfirmedSpend);
+
+        return {
+            confirmedNew + unconfirmedSpend, confirmedNew + unconfirmedNew};
+    }
+
+    auto make_output(
+        std::uint32_t index,
+        std::int64_t value,
+        const ot::UnallocatedSet<Key>& keys) const noexcept
+        -> std::unique_ptr<ot::blockchain::bitcoin::block::Output>
+    {
+        // NOTE a p2pkh script with an arbitrary hash
+        auto bytes = ot::Space{
+            std::byte{0x76}, std::byte{0xa9}, std::byte{0x14}};
+        bytes.insert(bytes.end(), 20u, std::byte(index));
+        bytes.emplace_back(std::byte{0x88});
+        bytes.emplace_back(std::byte{0xac});
+        auto script = ot::factory::BitcoinScript(
+            chain_,
+            ot::reader(bytes),
+            ot::blockchain::bitcoin::block::Script::Position::Output);
+
+        return ot::factory::BitcoinTransactionOutput(
+            api_, chain_, index, value, std::move(script), keys);
+    }
+
+    Test_OutputCache()
+        : api_(ot::Context().StartClientSession(0))
+        , common_(api_.Network().Blockchain().Internal().Database())
+        , blank_()
+        , lmdb_(
+              {
+                  {db::Config, "config"},
+                  {db::WalletOutputs, "wallet_outputs"},
+                  {db::AccountOutputs, "account_outputs"},
+                  {db::NymOutputs, "nym_outputs"},
+                  {db::PositionOutputs, "position_outputs"},
+                  {db::StateOutputs, "state_outputs"},
+                  {db::SubchainOutputs, "subchain_outputs"},
+                  {db::KeyOutputs, "key_outputs"},
+              },
+              common_.AllocateStorageFolder("output_cache_test"),
+              {
+                  {db::Config, MDB_INTEGERKEY},
+                  {db::WalletOutputs, 0},
+                  {db::AccountOutputs, MDB_DUPSORT},
+                  {db::NymOutputs, MDB_DUPSORT},
+                  {db::PositionOutputs, MDB_DUPSORT | MDB_DUPFIXED},
+                  {db::StateOutputs, MDB_DUPSORT | MDB_DUPFIXED},
+                  {db::SubchainOutputs, MDB_DUPSORT},
+                  {db::KeyOutputs, MDB_DUPSORT},
+              },
+              0)
+        , cache_(api_, lmdb_, chain_, blank_)
+    {
+    }
+};
+
+TEST_F(Test_OutputCache, running_totals)
+{
+    const auto accountA = ot::Identifier::Random();
+    const auto accountB = ot::Identifier::Random();
+    const auto subchainA = ot::Identifier::Random();
+    const auto subchainB = ot::Identifier::Random();
+    const auto nymA = [&] {
+        auto out = api_.Factory().NymID();
+        out->Randomize();
+
+        return out;
+    }();
+    const auto nymB = [&] {
+        auto out = api_.Factory().NymID();
+        out->Randomize();
+
+        return out;
+    }();
+    const auto keyA0 = Key{accountA->str(), Subchain::External, 0};
+    const auto keyA1 = Key{accountA->str(), Subchain::Internal, 1};
+    const auto keyB0 = Key{accountB->str(), Subchain::External, 0};
+    const auto keyB1 = Key{accountB->str(), Subchain::External, 1};
+    const auto o1 = outpoint(1);
+    const auto o2 = outpoint(2);
+    const auto o3 = outpoint(3);
+    const auto o4 = outpoint(4);
+    const auto verify = [&] {
+        EXPECT_EQ(cache_.GetBalance(), fold(nullptr));
+
+        for (const auto& id : {accountA, accountB}) {
+            EXPECT_EQ(
+                cache_.GetAccountBalance(id), fold(&cache_.GetAccount(id)));
+        }
+
+        for (const auto& id : {nymA, nymB}) {
+            EXPECT_EQ(cache_.GetNymBalance(id), fold(&cache_.GetNym(id)));
+        }
+
+        for (const auto& id : {keyA0, keyA1, keyB0, keyB1}) {
+            EXPECT_EQ(cache_.GetKeyBalance(id), fold(&cache_.GetKey(id)));
+        }
+    };
+
+    cache_.Populate();
+
+    EXPECT_EQ(cache_.GetBalance(), Balance{});
+
+    {
+        auto tx = lmdb_.TransactionRW();
+        const auto add = [&](const auto& id,
+                             std::int64_t value,
+                             const auto& key,
+                             const auto& account,
+                             const auto& subchain) {
+            return cache_.AddOutput(
+                id,
+                State::UnconfirmedNew,
+                blank_,
+                account,
+                subchain,
+                tx,
+                make_output(id.Index(), value, {key}));
+        };
+
+        ASSERT_TRUE(add(o1, 1000, keyA0, accountA, subchainA));
+        ASSERT_TRUE(add(o2, 2000, keyA1, accountA, subchainA));
+        ASSERT_TRUE(add(o3, 4000, keyB0, accountB, subchainB));
+        ASSERT_TRUE(add(o4, 8000, keyA0, accountA, subchainA));
+        verify();
+
+        // NOTE indices added after the output must pick up its current state
+        ASSERT_TRUE(cache_.AddToNym(nymA, o1, tx));
+        ASSERT_TRUE(cache_.AddToNym(nymA, o2, tx));
+        ASSERT_TRUE(cache_.AddToNym(nymA, o4, tx));
+        ASSERT_TRUE(cache_.AddToNym(nymB, o3, tx));
+        ASSERT_TRUE(cache_.AddToKey(keyB1, o3, tx));
+        // NOTE adding an output to an index twice must not count it twice
+        ASSERT_TRUE(cache_.AddToKey(keyA0, o1, tx));
+        verify();
+
+        EXPECT_EQ(cache_.GetBalance(), (Balance{0, 15000}));
+        EXPECT_EQ(cache_.GetKeyBalance(keyA0), (Balance{0, 9000}));
+
+        ASSERT_TRUE(cache_.ChangeState(
+            State::UnconfirmedNew, State::ConfirmedNew, o1, tx));
+        ASSERT_TRUE(cache_.ChangeState(
+            State::UnconfirmedNew, State::ConfirmedNew, o3, tx));
+        verify();
+
+        EXPECT_EQ(cache_.GetBalance(), (Balance{5000, 15000}));
+
+        ASSERT_TRUE(cache_.ChangeState(
+            State::ConfirmedNew, State::UnconfirmedSpend, o1, tx));
+        verify();
+
+        EXPECT_EQ(cache_.GetNymBalance(nymA), (Balance{1000, 10000}));
+
+        ASSERT_TRUE(cache_.ChangeState(
+            State::UnconfirmedSpend, State::ConfirmedSpend, o1, tx));
+        verify();
+
+        EXPECT_EQ(cache_.GetBalance(), (Balance{4000, 14000}));
+        EXPECT_EQ(cache_.GetAccountBalance(accountA), (Balance{0, 10000}));
+        EXPECT_EQ(cache_.GetKeyBalance(keyB1), (Balance{4000, 4000}));
+        ASSERT_TRUE(tx.Finalize(true));
+    }
+
+    const auto before = cache_.GetBalance();
+    cache_.Clear();
+    cache_.Populate();
+    verify();
+
+    EXPECT_EQ(cache_.GetBalance(), before);
+    EXPECT_EQ(cache_.GetKeyBalance(keyA0), (Balance{0, 8000}));
+}
+}  // namespace ottest
@@ -0,0 +1,118 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <opentxs/opentxs.hpp>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <utility>
+
+#include "blockchain/node/filteroracle/ProcessBatch.hpp"
+#include "util/JobCounter.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+using ot::blockchain::node::filteroracle::BatchJob;
+using ot::blockchain::node::filteroracle::BatchPost;
+using ot::blockchain::node::filteroracle::ProcessBatch;
+
+class Test_ProcessBatch : public ::testing::Test
+{
+public:
+    static constexpr auto batch_ = std::size_t{10};
+
+    ot::JobCounter counter_;
+    std::atomic<std::size_t> posted_;
+    std::array<std::atomic<std::size_t>, batch_> calls_;
+    const BatchJob process_;
+
+    auto check() const noexcept -> void
+    {
+        for (const auto& calls : calls_) { EXPECT_EQ(calls.load(), 1u); }
+    }
+    auto run(std::size_t batch, std::size_t jobs, const BatchPost& post)
+        -> void
+    {
+        ProcessBatch(batch, jobs, counter_, post, process_);
+    }
+
+    Test_ProcessBatch()
+        : counter_()
+        , posted_(0)
+        , calls_()
+        , process_([this](std::size_t i) { ++calls_.at(i); })
+    {
+    }
+};
+
+TEST_F(Test_ProcessBatch, single_job)
+{
+    // NOTE a multi-block batch on a single core host must not post anything
+    // and must still process every block
+    run(batch_, 1, [this](auto) {
+        ++posted_;
+
+        return false;
+    });
+
+    EXPECT_EQ(posted_.load(), 0u);
+    check();
+}
+
+TEST_F(Test_ProcessBatch, unknown_concurrency)
+{
+    run(batch_, 0, [this](auto) {
+        ++posted_;
+
+        return false;
+    });
+
+    EXPECT_EQ(posted_.load(), 0u);
+    check();
+}
+
+TEST_F(Test_ProcessBatch, parallel)
+{
+    run(batch_, 3, [this](auto job) {
+        ++posted_;
+        std::thread{std::move(job)}.detach();
+
+        return true;
+    });
+
+    EXPECT_EQ(posted_.load(), 3u);
+    check();
+}
+
+TEST_F(Test_ProcessBatch, more_jobs_than_blocks)
+{
+    run(batch_, 2u * batch_, [this](auto job) {
+        ++posted_;
+        std::thread{std::move(job)}.detach();
+
+        return true;
+    });
+
+    EXPECT_EQ(posted_.load(), batch_);
+    check();
+}
+
+TEST_F(Test_ProcessBatch, post_failure)
+{
+    // NOTE tasks which can not be posted run on the calling thread
+    run(batch_, 4, [this](auto) {
+        ++posted_;
+
+        return false;
+    });
+
+    EXPECT_EQ(posted_.load(), 4u);
+    check();
+}
+}  // namespace ottest
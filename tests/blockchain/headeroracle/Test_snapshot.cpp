@@ -0,0 +1,78 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <opentxs/opentxs.hpp>
+#include <memory>
+#include <utility>
+
+#include "internal/blockchain/node/HeaderOracle.hpp"
+#include "ottest/fixtures/blockchain/HeaderOracle.hpp"
+
+ot::UnallocatedVector<std::unique_ptr<bb::Header>> headers_{};
+ot::Space snapshot_{};
+
+namespace ottest
+{
+TEST_F(Test_HeaderOracle_btc, init_opentxs) {}
+
+TEST_F(Test_HeaderOracle_btc, stage_headers)
+{
+    for (const auto& hex : bitcoin_) {
+        const auto raw = [&] {
+            auto out = ot::Data::Factory();
+            out->DecodeHex(hex);
+
+            return out;
+        }();
+        auto pHeader = api_.Factory().BlockHeader(type_, raw->Bytes());
+
+        ASSERT_TRUE(pHeader);
+
+        headers_.emplace_back(std::move(pHeader));
+    }
+
+    EXPECT_TRUE(header_oracle_.AddHeaders(headers_));
+}
+
+TEST_F(Test_HeaderOracle_btc, export_snapshot)
+{
+    const auto& oracle = header_oracle_.Internal();
+    const auto last = static_cast<bb::Height>(bitcoin_.size());
+
+    EXPECT_FALSE(oracle.ExportSnapshot(0, ot::writer(snapshot_)));
+    EXPECT_FALSE(oracle.ExportSnapshot(last + 1, ot::writer(snapshot_)));
+    ASSERT_TRUE(oracle.ExportSnapshot(last, ot::writer(snapshot_)));
+    EXPECT_EQ(snapshot_.size(), 16u + (80u * bitcoin_.size()));
+
+    for (auto i = 0u; i < bitcoin_.size(); ++i) {
+        const auto raw = [&] {
+            auto out = ot::Data::Factory();
+            out->DecodeHex(bitcoin_[i]);
+
+            return out;
+        }();
+        const auto view = ot::ReadView{
+            reinterpret_cast<const char*>(snapshot_.data()) + 16u + (80u * i),
+            80u};
+
+        EXPECT_EQ(view, raw->Bytes());
+    }
+}
+
+TEST_F(Test_HeaderOracle_btc, import_snapshot)
+{
+    auto& oracle = header_oracle_.Internal();
+    const auto bytes = ot::reader(snapshot_);
+
+    // NOTE the snapshot does not reach the default checkpoint
+    EXPECT_FALSE(oracle.ImportSnapshot(bytes));
+    EXPECT_FALSE(oracle.ImportSnapshot(bytes.substr(0, bytes.size() - 1u)));
+    EXPECT_FALSE(oracle.ImportSnapshot(bytes.substr(0, 8u)));
+    EXPECT_EQ(
+        header_oracle_.BestChain().height_,
+        static_cast<bb::Height>(bitcoin_.size()));
+}
+}  // namespace ottest
@@ -0,0 +1,156 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <opentxs/opentxs.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "internal/blockchain/node/Config.hpp"
+#include "internal/blockchain/node/HeaderOracle.hpp"
+#include "ottest/Basic.hpp"
+#include "ottest/fixtures/blockchain/HeaderOracle.hpp"
+
+ot::UnallocatedVector<std::unique_ptr<bb::Header>> headers_{};
+ot::Space snapshot_{};
+
+namespace ottest
+{
+using CheckpointData = bc::internal::HeaderOracle::CheckpointData;
+
+// NOTE snapshots are built by hand since the chain in this process is empty
+// until the import succeeds
+static auto append(std::uint32_t value) noexcept -> void
+{
+    for (auto i = 0u; i < sizeof(value); ++i) {
+        snapshot_.emplace_back(std::byte(value >> (8u * i)));
+    }
+}
+
+TEST_F(Test_HeaderOracle_btc, init_opentxs) {}
+
+TEST_F(Test_HeaderOracle_btc, stage_snapshot)
+{
+    append(0x5348544f);
+    append(1u);
+    append(static_cast<std::uint32_t>(type_));
+    append(static_cast<std::uint32_t>(bitcoin_.size()));
+
+    for (const auto& hex : bitcoin_) {
+        const auto raw = [&] {
+            auto out = ot::Data::Factory();
+            out->DecodeHex(hex);
+
+            return out;
+        }();
+        auto pHeader = api_.Factory().BlockHeader(type_, raw->Bytes());
+
+        ASSERT_TRUE(pHeader);
+
+        headers_.emplace_back(std::move(pHeader));
+        const auto bytes = raw->Bytes();
+        const auto* it = reinterpret_cast<const std::byte*>(bytes.data());
+        snapshot_.insert(snapshot_.end(), it, it + bytes.size());
+    }
+
+    EXPECT_EQ(snapshot_.size(), 16u + (80u * bitcoin_.size()));
+}
+
+TEST_F(Test_HeaderOracle_btc, reject_wrong_checkpoint)
+{
+    ASSERT_FALSE(headers_.empty());
+
+    auto& oracle = header_oracle_.Internal();
+    const auto height = static_cast<bb::Height>(bitcoin_.size());
+    const auto& last = *headers_.back();
+    const auto wrong = CheckpointData{
+        height, last.ParentHash(), last.ParentHash(), b::cfilter::Header{}};
+
+    // NOTE the snapshot is verified before anything is written
+    EXPECT_FALSE(oracle.ImportSnapshot(ot::reader(snapshot_), wrong));
+    EXPECT_EQ(header_oracle_.BestChain().height_, 0);
+    EXPECT_FALSE(header_oracle_.LoadHeader(headers_.front()->Hash()));
+}
+
+TEST_F(Test_HeaderOracle_btc, startup_snapshot)
+{
+    ASSERT_FALSE(snapshot_.empty());
+
+    const auto path = Home() + "/bitcoin.snapshot";
+    const auto missing = Home() + "/missing.snapshot";
+
+    {
+        auto file = std::ofstream{path, std::ios::binary};
+        file.write(
+            reinterpret_cast<const char*>(snapshot_.data()),
+            static_cast<std::streamsize>(snapshot_.size()));
+
+        ASSERT_TRUE(file.good());
+    }
+
+    auto config = bc::internal::Config{};
+    config.header_snapshots_.emplace(missing);
+    config.header_snapshots_.emplace(path);
+    header_oracle_.Internal().Init(config);
+
+    // NOTE the file is read but does not reach the default checkpoint, so
+    // nothing is imported and the chain is left for the normal sync process
+    EXPECT_EQ(header_oracle_.BestChain().height_, 0);
+
+    // NOTE Init restores the default checkpoint
+    header_oracle_.DeleteCheckpoint();
+}
+
+TEST_F(Test_HeaderOracle_btc, import_snapshot)
+{
+    ASSERT_FALSE(headers_.empty());
+
+    auto& oracle = header_oracle_.Internal();
+    const auto height = static_cast<bb::Height>(bitcoin_.size());
+    const auto& last = *headers_.back();
+    const auto checkpoint = CheckpointData{
+        height, last.Hash(), last.ParentHash(), b::cfilter::Header{}};
+
+    ASSERT_TRUE(oracle.ImportSnapshot(ot::reader(snapshot_), checkpoint));
+
+    const auto best = header_oracle_.BestChain();
+
+    EXPECT_EQ(best.height_, height);
+    EXPECT_EQ(best.hash_, last.Hash());
+
+    for (auto i = 0u; i < headers_.size(); ++i) {
+        const auto& expected = *headers_[i];
+        const auto position = static_cast<bb::Height>(i + 1u);
+
+        EXPECT_EQ(header_oracle_.BestHash(position), expected.Hash());
+        EXPECT_TRUE(header_oracle_.IsInBestChain(expected.Hash()));
+
+        const auto header = header_oracle_.LoadHeader(expected.Hash());
+
+        ASSERT_TRUE(header);
+        EXPECT_EQ(header->Height(), position);
+        EXPECT_EQ(header->ParentHash(), expected.ParentHash());
+        EXPECT_EQ(header->Work()->Decimal(), std::to_string(i + 2u));
+    }
+
+    // NOTE snapshots may only be imported into an empty chain
+    EXPECT_FALSE(oracle.ImportSnapshot(ot::reader(snapshot_), checkpoint));
+    EXPECT_EQ(header_oracle_.BestChain(), best);
+}
+
+TEST_F(Test_HeaderOracle_btc, export_imported)
+{
+    const auto& oracle = header_oracle_.Internal();
+    const auto last = static_cast<bb::Height>(bitcoin_.size());
+    auto exported = ot::Space{};
+
+    ASSERT_TRUE(oracle.ExportSnapshot(last, ot::writer(exported)));
+    EXPECT_EQ(exported, snapshot_);
+}
+}  // namespace ottest
@@ -0,0 +1,221 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <opentxs/opentxs.hpp>
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <iostream>
+#include <memory>
+#include <utility>
+
+#include "internal/util/LogMacros.hpp"
+#include "ottest/data/crypto/PaymentCodeV3.hpp"
+#include "ottest/fixtures/blockchain/Regtest.hpp"
+
+namespace ottest
+{
+// NOTE measures the time required to build and sign a single transaction which
+// spends a large number of small outputs
+constexpr auto outputs_ = std::uint64_t{1000u};
+constexpr auto amount_ = std::uint64_t{100000u};
+
+class Regtest_consolidate : public Regtest_fixture_normal
+{
+protected:
+    using Subchain = ot::blockchain::crypto::Subchain;
+
+    static ot::Nym_p alice_p_;
+    static std::unique_ptr<ScanListener> listener_alice_p_;
+
+    const ot::identity::Nym& alice_;
+    const ot::blockchain::crypto::HD& alice_account_;
+    const Generator mine_to_alice_;
+    ScanListener& listener_alice_;
+
+    auto GetAddress() noexcept -> ot::UnallocatedCString
+    {
+        const auto reason = client_1_.Factory().PasswordPrompt(__func__);
+        const auto indices =
+            alice_account_.Reserve(Subchain::External, 1u, reason);
+
+        OT_ASSERT(1u == indices.size());
+
+        const auto& element =
+            alice_account_.BalanceElement(Subchain::External, indices.at(0));
+        using Style = ot::blockchain::crypto::AddressStyle;
+
+        return element.Address(Style::P2PKH);
+    }
+
+    auto Shutdown() noexcept -> void final
+    {
+        listener_alice_p_.reset();
+        alice_p_.reset();
+        Regtest_fixture_normal::Shutdown();
+    }
+
+    Regtest_consolidate()
+        : Regtest_fixture_normal(1)
+        , alice_([&]() -> const ot::identity::Nym& {
+            if (!alice_p_) {
+                const auto reason =
+                    client_1_.Factory().PasswordPrompt(__func__);
+                const auto& vector = GetPaymentCodeVector3().alice_;
+                const auto seedID = [&] {
+                    const auto words =
+                        client_1_.Factory().SecretFromText(vector.words_);
+                    const auto phrase = client_1_.Factory().Secret(0);
+
+                    return client_1_.Crypto().Seed().ImportSeed(
+                        words,
+                        phrase,
+                        ot::crypto::SeedStyle::BIP39,
+                        ot::crypto::Language::en,
+                        reason);
+                }();
+
+                alice_p_ = client_1_.Wallet().Nym({seedID, 0}, reason, "Alice");
+
+                OT_ASSERT(alice_p_)
+
+                client_1_.Crypto().Blockchain().NewHDSubaccount(
+                    alice_p_->ID(),
+                    ot::blockchain::crypto::HDProtocol::BIP_44,
+                    test_chain_,
+                    reason);
+            }
+
+            OT_ASSERT(alice_p_)
+
+            return *alice_p_;
+        }())
+        , alice_account_(client_1_.Crypto()
+                             .Blockchain()
+                             .Account(alice_.ID(), test_chain_)
+                             .GetHD()
+                             .at(0))
+        , mine_to_alice_([&](Height height) -> Transaction {
+            using OutputBuilder = ot::api::session::Factory::OutputBuilder;
+
+            auto output = miner_.Factory().BitcoinGenerationTransaction(
+                test_chain_,
+                height,
+                [&] {
+                    auto output = ot::UnallocatedVector<OutputBuilder>{};
+                    const auto reason =
+                        client_1_.Factory().PasswordPrompt(__func__);
+                    const auto keys =
+                        ot::UnallocatedSet<ot::blockchain::crypto::Key>{};
+                    const auto indices = alice_account_.Reserve(
+                        Subchain::External, outputs_, reason);
+
+                    OT_ASSERT(indices.size() == outputs_);
+
+                    for (const auto index : indices) {
+                        const auto& element = alice_account_.BalanceElement(
+                            Subchain::External, index);
+                        const auto key = element.Key();
+
+                        OT_ASSERT(key);
+
+                        output.emplace_back(
+                            amount_,
+                            miner_.Factory().BitcoinScriptP2PK(
+                                test_chain_, *key),
+                            keys);
+                    }
+
+                    return output;
+                }(),
+                coinbase_fun_);
+
+            OT_ASSERT(output);
+
+            return output;
+        })
+        , listener_alice_([&]() -> ScanListener& {
+            if (!listener_alice_p_) {
+                listener_alice_p_ = std::make_unique<ScanListener>(client_1_);
+            }
+
+            OT_ASSERT(listener_alice_p_);
+
+            return *listener_alice_p_;
+        }())
+    {
+    }
+};
+
+ot::Nym_p Regtest_consolidate::alice_p_{};
+std::unique_ptr<ScanListener> Regtest_consolidate::listener_alice_p_{};
+
+TEST_F(Regtest_consolidate, init_opentxs) {}
+
+TEST_F(Regtest_consolidate, start_chains) { EXPECT_TRUE(Start()); }
+
+TEST_F(Regtest_consolidate, connect_peers) { EXPECT_TRUE(Connect()); }
+
+TEST_F(Regtest_consolidate, mine_initial_balance)
+{
+    auto future1 =
+        listener_alice_.get_future(alice_account_, Subchain::External, 1);
+    auto future2 =
+        listener_alice_.get_future(alice_account_, Subchain::Internal, 1);
+
+    EXPECT_TRUE(Mine(0, 1, mine_to_alice_));
+    EXPECT_TRUE(listener_alice_.wait(future1));
+    EXPECT_TRUE(listener_alice_.wait(future2));
+
+    const auto& wallet =
+        client_1_.Network().Blockchain().GetChain(test_chain_).Wallet();
+    using TxoState = ot::blockchain::node::TxoState;
+
+    EXPECT_EQ(
+        wallet.GetOutputs(alice_.ID(), TxoState::ConfirmedNew).size(),
+        outputs_);
+}
+
+TEST_F(Regtest_consolidate, consolidate)
+{
+    namespace c = std::chrono;
+    const auto& network =
+        client_1_.Network().Blockchain().GetChain(test_chain_);
+    const auto destination = GetAddress();
+    // NOTE leave enough value unspent to cover the fee so that nearly every
+    // output must be spent
+    const auto amount = (outputs_ - 10u) * amount_;
+    const auto start = ot::Clock::now();
+    auto future = network.SendToAddress(alice_.ID(), destination, amount);
+
+    using State = std::future_status;
+    constexpr auto limit = std::chrono::minutes{10};
+
+    ASSERT_EQ(future.wait_for(limit), State::ready);
+
+    const auto [code, txid] = future.get();
+    const auto sent = ot::Clock::now();
+
+    EXPECT_EQ(code, ot::blockchain::node::SendResult::Sent);
+    EXPECT_FALSE(txid->empty());
+
+    const auto pTX =
+        client_1_.Crypto().Blockchain().LoadTransactionBitcoin(txid);
+
+    ASSERT_TRUE(pTX);
+
+    const auto inputs = pTX->Inputs().size();
+
+    EXPECT_GT(inputs, outputs_ - 10u);
+
+    std::cout << std::to_string(
+                     c::duration_cast<c::milliseconds>(sent - start).count())
+              << " ms to build and sign a transaction with "
+              << std::to_string(inputs) << " inputs\n";
+}
+
+TEST_F(Regtest_consolidate, shutdown) { Shutdown(); }
+}  // namespace ottest
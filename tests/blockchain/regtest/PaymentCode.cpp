@@ -991,7 +991,11 @@ TEST_F(Regtest_payment_code, second_block)
     }
 
     {
-        auto elements = block.Internal().ExtractElements(FilterType::ES);
+        auto extracted = block.Internal().ExtractElements(FilterType::ES);
+
+        ASSERT_TRUE(extracted.has_value());
+
+        auto& elements = extracted.value();
         std::sort(elements.begin(), elements.end());
         std::sort(expected.begin(), expected.end());
 
@@ -5,8 +5,10 @@
 
 #include <gtest/gtest.h>
 #include <opentxs/opentxs.hpp>
+#include <cstddef>
 #include <memory>
 
+#include "internal/crypto/key/HD.hpp"
 #include "ottest/data/crypto/Bip32.hpp"
 
 namespace ot = opentxs;
@@ -105,4 +107,51 @@ TEST_F(Test_BIP32, stress)
         EXPECT_EQ(child.xprv_, key.Xprv(reason_));
     }
 }
+
+TEST_F(Test_BIP32, child_keys)
+{
+    constexpr auto first = ot::Bip32Index{5u};
+    constexpr auto count = std::size_t{32u};
+    const auto& item = Bip32TestCases().at(0u);
+    const auto& child = item.children_.at(2u);
+    const auto seedID = [&] {
+        const auto bytes = api_.Factory().DataFromHex(item.seed_);
+        const auto seed = api_.Factory().SecretFromBytes(bytes->Bytes());
+
+        return api_.Crypto().Seed().ImportRaw(seed, reason_);
+    }();
+
+    ASSERT_FALSE(seedID.empty());
+
+    auto id{seedID};
+    const auto pParent = api_.Crypto().Seed().GetHDKey(
+        id,
+        ot::crypto::EcdsaCurve::secp256k1,
+        make_path(child.path_),
+        reason_);
+
+    ASSERT_TRUE(pParent);
+
+    const auto& parent = *pParent;
+    const auto* internal =
+        dynamic_cast<const ot::crypto::key::internal::HD*>(pParent.get());
+
+    ASSERT_NE(internal, nullptr);
+
+    const auto batch = internal->ChildKeys(first, count, reason_);
+
+    ASSERT_EQ(batch.size(), count);
+
+    for (auto i = std::size_t{0}; i < count; ++i) {
+        const auto index = first + static_cast<ot::Bip32Index>(i);
+        const auto pExpected = parent.ChildKey(index, reason_);
+        const auto& pKey = batch.at(i);
+
+        ASSERT_TRUE(pExpected);
+        ASSERT_TRUE(pKey);
+        EXPECT_EQ(pKey->Xpub(reason_), pExpected->Xpub(reason_));
+        EXPECT_EQ(pKey->Xprv(reason_), pExpected->Xprv(reason_));
+        EXPECT_EQ(pKey->Parent(), parent.Fingerprint());
+    }
+}
 }  // namespace ottest
@@ -7,10 +7,13 @@
 #include <opentxs/opentxs.hpp>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <iterator>
 #include <tuple>
 #include <type_traits>
 #include <utility>
 
+#include "internal/api/crypto/Hash.hpp"
 #include "internal/util/P0330.hpp"
 
 namespace ot = opentxs;
@@ -598,6 +601,44 @@ TEST_F(Test_Hash, nist_short)
     }
 }
 
+TEST_F(Test_Hash, batch_sha256)
+{
+    // NOTE lengths straddle the padding boundaries and include runs of equal
+    // length messages so every kernel path is exercised
+    auto messages = ot::UnallocatedVector<ot::UnallocatedCString>{};
+
+    for (auto i = 0_uz; i < 200_uz; ++i) {
+        messages.emplace_back(i, static_cast<char>(i));
+    }
+
+    for (auto i = 0_uz; i < 20_uz; ++i) { messages.emplace_back(64_uz, 'a'); }
+
+    auto inputs = ot::Vector<ot::ReadView>{};
+
+    for (const auto& message : messages) { inputs.emplace_back(message); }
+
+    for (const auto type :
+         {ot::crypto::HashType::Sha256, ot::crypto::HashType::Sha256D}) {
+        auto batch = ot::Space{};
+
+        EXPECT_TRUE(crypto_.Hash().InternalHash().Digest(
+            type, inputs, ot::writer(batch)));
+        ASSERT_EQ(batch.size(), 32_uz * inputs.size());
+
+        for (auto i = 0_uz; i < inputs.size(); ++i) {
+            auto single = ot::Space{};
+
+            EXPECT_TRUE(
+                crypto_.Hash().Digest(type, inputs[i], ot::writer(single)));
+            ASSERT_EQ(single.size(), 32_uz);
+            EXPECT_EQ(
+                0,
+                std::memcmp(
+                    single.data(), std::next(batch.data(), 32_uz * i), 32_uz));
+        }
+    }
+}
+
 TEST_F(Test_Hash, nist_million_characters)
 {
     const auto& [input, sha1, sha256, sha512] = nist_one_million_;
@@ -7,7 +7,10 @@
 
 #include <boost/move/algo/move.hpp>
 #include <opentxs/opentxs.hpp>
+#include <array>
 #include <chrono>
+#include <cstddef>
+#include <cstring>
 #include <future>
 #include <iosfwd>
 #include <mutex>
@@ -120,6 +123,15 @@ auto Listener::get(std::size_t index) noexcept(false) -> const Message&
 
 Listener::~Listener() = default;
 
+auto BlockHash(std::size_t index) noexcept -> ot::blockchain::block::Hash
+{
+    auto bytes = std::array<std::byte, 32>{};
+    std::memcpy(bytes.data(), &index, sizeof(index));
+
+    return ot::ReadView{
+        reinterpret_cast<const char*>(bytes.data()), bytes.size()};
+}
+
 const boost::container::flat_map<ot::blockchain::Type, ChainVector>
     genesis_block_data_{
         {ot::blockchain::Type::UnitTest,
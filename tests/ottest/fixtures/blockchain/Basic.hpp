@@ -64,6 +64,9 @@ private:
     std::unique_ptr<Imp> imp_;
 };
 
+// NOTE returns a distinct placeholder hash for every index
+auto BlockHash(std::size_t index) noexcept -> ot::blockchain::block::Hash;
+
 constexpr auto blank_hash_{
     "0x0000000000000000000000000000000000000000000000000000000000000000"};
 constexpr auto btc_genesis_hash_numeric_{